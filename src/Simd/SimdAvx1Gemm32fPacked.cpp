@@ -0,0 +1,53 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdGemm32fPacked.h"
+#include "Simd/SimdSynetConvolution32f.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx
+    {
+        Gemm32fPackedNN::Gemm32fPackedNN(const GemmPackedParam32f & p)
+            : Sse2::Gemm32fPackedNN(p)
+        {
+            _type = Avx::Gemm32fNNcbKernelType(p.M, p.N, p.K, GemmKernelAny, false);
+            _bufferSize = Avx::Gemm32fNNcbBufferSize;
+            _reorderB = Avx::Gemm32fNNcbReorderB;
+            _run = Avx::Gemm32fNNcbRun;
+            _biasAndActivation = Avx::ConvolutionBiasAndActivation;
+        }
+
+        //---------------------------------------------------------------------
+
+        void * Gemm32fPackedInit(size_t M, size_t N, size_t K, SimdConvolutionActivationType activation)
+        {
+            GemmPackedParam32f param(M, N, K, activation);
+            if (!param.Valid())
+                return NULL;
+            return new Gemm32fPackedNN(param);
+        }
+    }
+#endif//SIMD_AVX_ENABLE
+}
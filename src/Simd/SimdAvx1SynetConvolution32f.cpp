@@ -733,7 +733,7 @@ namespace Simd
         SynetConvolution32fNhwcDirect::SynetConvolution32fNhwcDirect(const ConvParam32f& p)
             : Sse2::SynetConvolution32fNhwcDirect(p)
         {
-            if (p.dstC <= Sse2::F)
+            if (p.dstC / p.group <= Sse2::F)
                 return;
             //_old.enable = true;
             if (_old.enable)
@@ -768,14 +768,9 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
-        void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
+        static SynetConvolution32f * SynetConvolution32fDenseInit(const ConvParam32f & param)
         {
-            if (conv->activation == SimdConvolutionActivationElu)
-                return Sse2::SynetConvolution32fInit(batch, conv, gemm);
-            ConvParam32f param(batch, conv, gemm);
-            if (!param.Valid())
-                return NULL;
-            else if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
+            if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
                 return new SynetConvolution32fDepthwiseDotProduct(param);
             else if (SynetConvolution32fWinograd::Preferable(param))
                 return new SynetConvolution32fWinograd(param);
@@ -790,6 +785,28 @@ namespace Simd
             else
                 return new SynetConvolution32fGemmNN(param);
         }
+
+        void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
+        {
+            if (conv->activation == SimdConvolutionActivationElu)
+                return Sse2::SynetConvolution32fInit(batch, conv, gemm);
+            ConvParam32f param(batch, conv, gemm);
+            if (!param.Valid())
+                return NULL;
+            else if (Sse2::SynetConvolution32fSparse::Preferable(param))
+                return new Sse2::SynetConvolution32fSparse(param, SynetConvolution32fDenseInit(param));
+            else
+                return SynetConvolution32fDenseInit(param);
+        }
+
+        void * SynetConvolution32fInitV2(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType)
+        {
+            ConvParam32f param(batch, conv, gemm);
+            if (param.Valid() && Base::SynetConvolution32fProd16::Preferable(param, weightType))
+                return new Base::SynetConvolution32fProd16(param, weightType);
+            else
+                return SynetConvolution32fInit(batch, conv, gemm);
+        }
     }
 #endif//SIMD_AVX_ENABLE
 }
@@ -42,7 +42,7 @@ namespace Simd
         {
             __m256 d00, d01, d02, s0, w0, w1, w2;
             size_t srcH = p.srcH, srcW = p.srcW, dilY = p.dilationY, dilX = p.dilationX;
-            size_t dY = p.srcW * p.srcC, dX = p.srcC, dS = p.srcC * p.strideX, dW = p.srcC * F;
+            size_t dY = p.srcW * p.srcC, dX = p.srcC, dS = p.srcC * p.strideX, dW = a.srcC * F;
             size_t sy = dy * p.strideY - p.padY, sx = dx * p.strideX - p.padX;
             size_t kY = p.kernelY * p.dilationY, kX = p.kernelX * p.dilationX;
             const float* weight1 = weight0 + a.stepW;
@@ -141,7 +141,7 @@ namespace Simd
         {
             __m256 d00, d01, d02, d10, d11, d12, d20, d21, d22, d30, d31, d32, s0, w0, w1, w2;
             size_t srcH = p.srcH, srcW = p.srcW, dilY = p.dilationY, dilX = p.dilationX;
-            size_t dY = p.srcW * p.srcC, dX = p.srcC, dS = p.srcC * p.strideX, dW = p.srcC * F, dWz = p.kernelX * p.srcC * F, dD = p.dstC;
+            size_t dY = p.srcW * p.srcC, dX = p.srcC, dS = p.srcC * p.strideX, dW = a.srcC * F, dWz = p.kernelX * a.srcC * F, dD = p.dstC;
             size_t sy = dy * p.strideY - p.padY, sx = dx * p.strideX - p.padX;
             size_t kY = p.kernelY * p.dilationY, kX = p.kernelX * p.dilationX;
             const float* weight1 = weight0 + a.stepW;
@@ -375,7 +375,7 @@ namespace Simd
                     for (; dx < tailW; dx++, d += p.dstC)
                         convolutionNhwcDirect_3x1(src, p, a, dy, dx, srcC, dC, weight, _bias, _params, d, first);
                 }
-                weight += p.kernelY * p.kernelX * p.srcC * a.microD;
+                weight += p.kernelY * p.kernelX * a.srcC * a.microD;
             }
         }
 
@@ -562,7 +562,7 @@ namespace Simd
                     convolutionNhwcDirect1x1_3xN(ps, p, a, srcC, dC, weight, _bias, _params, pd, first);
                 for (; i < n1; i += m, ps += m * p.srcC, pd += m * p.dstC)
                     convolutionNhwcDirect1x1_3xM(ps, p, a, srcC, dC, weight, _bias, _params, pd, first);
-                weight += p.srcC * a.microD;
+                weight += a.srcC * a.microD;
             }
         }
 
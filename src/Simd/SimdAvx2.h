@@ -465,20 +465,41 @@ namespace Simd
         void SynetAdd8i(const uint8_t* aData, const float* aScale, const float* aShift, const uint8_t* bData, const float* bScale, const float* bShift,
             uint8_t* cData, const float* cScale, const float* cShift, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
 
+        void SynetBinaryOperation32fLayerForward(const float* a, const size_t* aShape, size_t aCount, const float* b, const size_t* bShape, size_t bCount,
+            SimdSynetBinaryOperation32fType type, float* dst);
+
         void SynetConvert32fTo8u(const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, 
             const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility);
 
         void SynetConvert8uTo32f(const uint8_t* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format,
             const float* scale, const float* shift, float* dst, SimdSynetCompatibilityType compatibility);
 
+        void SynetDecodeSsd32f(const float* loc, const float* prior, const float* variance, size_t count, float* dst);
+
+        void SynetDecodeYolo32f(const float* src, size_t anchors, size_t classes, size_t height, size_t width, const float* sizes, float* boxes, float* scores);
+
+        size_t SynetDetectionOutput32f(const float* boxes, const float* scores, size_t count, size_t classes, size_t background,
+            const float* confidence, const float* overlap, size_t topK, size_t keepTopK, float* dst);
+
         void SynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
 
         void SynetElu32f(const float * src, size_t size, const float * alpha, float * dst);
 
+        void SynetGroupNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst);
+
         void SynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
 
         void SynetInnerProduct8i(size_t M, size_t N, size_t K, const uint8_t* src, const int8_t* weight, int32_t* dst, SimdSynetCompatibilityType compatibility);
 
+        void SynetL2Normalize32f(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+            SimdBool acrossSpatial, const float* eps, float* dst);
+
+        void SynetLayerNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst);
+
+        void SynetLogSoftmaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst);
+
         void SynetLrnLayerCrossChannels(const float * src, size_t half, size_t channels, size_t spatial, const float * k, float * dst, SimdTensorFormatType format);
 
         void SynetMish32f(const float* src, size_t size, const float* threshold, float* dst);
@@ -486,16 +507,33 @@ namespace Simd
         void SynetPoolingForwardMax32f(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
             size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
 
+        void SynetPoolingForwardAverage8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+            size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
+
         void SynetPoolingForwardMax8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
             size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
 
+        void SynetReduceLayerForward(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+            SimdSynetReduceType type, SimdBool reduceChannels, SimdBool reduceSpatial, float* dst);
+
+        void SynetRoiAlign32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+            size_t pooledH, size_t pooledW, const float* spatialScale, size_t samplingRatio, SimdBool aligned, float* dst);
+
+        void SynetRoiPooling32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+            size_t pooledH, size_t pooledW, const float* spatialScale, float* dst);
+
         void SynetScaleLayerForward(const float* src, const float* scale, const float* bias, size_t channels, size_t height, size_t width, float* dst, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
 
+        void SynetScaledDotProductAttention32f(size_t batch, size_t queries, size_t keys, size_t depth, size_t valueDepth,
+            const float* query, const float* key, const float* value, const float* scale, float* dst);
+
         void SynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
             const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat);
 
         void SynetSigmoid32f(const float* src, size_t size, const float* slope, float* dst);
 
+        void SynetSoftmaxArgMaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst, uint32_t* index);
+
         void SynetSoftmaxLayerForward(const float * src, size_t outer, size_t size, size_t inner, float * dst);
 
         void SynetSoftplus32f(const float* src, size_t size, const float* beta, const float* threshold, float* dst);
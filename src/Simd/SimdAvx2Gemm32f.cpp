@@ -572,10 +572,86 @@ namespace Simd
             return NULL;
         }
 
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m256i GemmSmallMask(size_t tail)
+        {
+            const int32_t mask[DF] = { -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0 };
+            return _mm256_loadu_si256((__m256i*)(mask + F - tail));
+        }
+
+        template<size_t M, size_t V> SIMD_INLINE void GemmSmallKernel(size_t K, float alpha, const float * A, size_t lda, const float * B, size_t ldb, float beta, float * C, size_t ldc, __m256i tail)
+        {
+            __m256 c[M][V], b[V];
+            for (size_t i = 0; i < M; ++i)
+                for (size_t v = 0; v < V; ++v)
+                    c[i][v] = _mm256_setzero_ps();
+            for (size_t k = 0; k < K; ++k, B += ldb)
+            {
+                for (size_t v = 0; v < V - 1; ++v)
+                    b[v] = _mm256_loadu_ps(B + v * F);
+                b[V - 1] = _mm256_maskload_ps(B + (V - 1) * F, tail);
+                for (size_t i = 0; i < M; ++i)
+                {
+                    __m256 a = _mm256_set1_ps(A[i * lda + k]);
+                    for (size_t v = 0; v < V; ++v)
+                        c[i][v] = _mm256_fmadd_ps(a, b[v], c[i][v]);
+                }
+            }
+            __m256 _alpha = _mm256_set1_ps(alpha), _beta = _mm256_set1_ps(beta);
+            for (size_t i = 0; i < M; ++i, C += ldc)
+            {
+                for (size_t v = 0; v < V - 1; ++v)
+                {
+                    __m256 dst = _mm256_mul_ps(_alpha, c[i][v]);
+                    if (beta != 0.0f)
+                        dst = _mm256_fmadd_ps(_beta, _mm256_loadu_ps(C + v * F), dst);
+                    _mm256_storeu_ps(C + v * F, dst);
+                }
+                __m256 dst = _mm256_mul_ps(_alpha, c[i][V - 1]);
+                if (beta != 0.0f)
+                    dst = _mm256_fmadd_ps(_beta, _mm256_maskload_ps(C + (V - 1) * F, tail), dst);
+                _mm256_maskstore_ps(C + (V - 1) * F, tail, dst);
+            }
+        }
+
+        template<size_t M> void GemmSmallRows(size_t N, size_t K, float alpha, const float * A, size_t lda, const float * B, size_t ldb, float beta, float * C, size_t ldc)
+        {
+            size_t NDF = AlignLo(N, DF), j = 0;
+            __m256i full = GemmSmallMask(F);
+            for (; j < NDF; j += DF)
+                GemmSmallKernel<M, 2>(K, alpha, A, lda, B + j, ldb, beta, C + j, ldc, full);
+            if (j + F < N)
+                GemmSmallKernel<M, 2>(K, alpha, A, lda, B + j, ldb, beta, C + j, ldc, GemmSmallMask(N - j - F));
+            else if (j < N)
+                GemmSmallKernel<M, 1>(K, alpha, A, lda, B + j, ldb, beta, C + j, ldc, GemmSmallMask(N - j));
+        }
+
+        void GemmSmallNN(size_t M, size_t N, size_t K, float alpha, const float * A, size_t lda, const float * B, size_t ldb, float beta, float * C, size_t ldc)
+        {
+            size_t M6 = AlignLoAny(M, 6), i = 0;
+            for (; i < M6; i += 6)
+                GemmSmallRows<6>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc);
+            switch (M - i)
+            {
+            case 1: GemmSmallRows<1>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc); break;
+            case 2: GemmSmallRows<2>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc); break;
+            case 3: GemmSmallRows<3>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc); break;
+            case 4: GemmSmallRows<4>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc); break;
+            case 5: GemmSmallRows<5>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc); break;
+            }
+        }
+
         void Gemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
         {
             //SIMD_PERF_BEGF(Simd::ToStr(M) + "-" + Simd::ToStr(N) + "-" + Simd::ToStr(K), M*N*K*2);
 
+            if (GemmSmall(M, N, K))
+            {
+                GemmSmallNN(M, N, K, *alpha, A, lda, B, ldb, *beta, C, ldc);
+                return;
+            }
+
             typedef Simd::GemmNN<float, F, size_t> GemmNN;
             GemmNN::Main kernelMM, kernelMT;
             GemmNN::Tail kernelTM, kernelTT;
@@ -621,7 +697,7 @@ namespace Simd
 
         typedef Simd::GemmNNcb<float, F, size_t> Gemm32fNNcb;
 
-        SIMD_INLINE Gemm32fNNcb CreateGemm32fNNcb(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility)
+        SIMD_INLINE Gemm32fNNcb CreateGemm32fNNcb(size_t M, size_t N, size_t K, GemmKernelType & type, bool compatibility)
         {
             Gemm32fNNcb::Main kernelMM, kernelMT;
             Gemm32fNNcb::Tail kernelTM, kernelTT;
@@ -689,6 +765,18 @@ namespace Simd
             gemm.Run(A, K, pB, C, N);
         }
 
+        void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, size_t lda, const float * pB, float * C, size_t ldc, const GemmPost<float> & post, GemmKernelType type, bool compatibility)
+        {
+            Gemm32fNNcb gemm = CreateGemm32fNNcb(M, N, K, type, compatibility);
+            gemm.Run(M, A, lda, pB, C, ldc, post);
+        }
+
+        GemmKernelType Gemm32fNNcbKernelType(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility)
+        {
+            CreateGemm32fNNcb(M, N, K, type, compatibility);
+            return type;
+        }
+
         //---------------------------------------------------------------------
 
         SIMD_INLINE __m256 Tail(size_t tail)
@@ -28,6 +28,7 @@
 #include "Simd/SimdLog.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdExtract.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -216,7 +217,7 @@ namespace Simd
                 }
             }
             else
-                assert(0);
+                Base::SynetConvert32fTo8u(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
         }
 
         //---------------------------------------------------------------------
@@ -332,7 +333,7 @@ namespace Simd
                 }
             }
             else
-                assert(0);
+                Base::SynetConvert8uTo32f(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
         }
 
         //---------------------------------------------------------------------
@@ -327,7 +327,7 @@ namespace Simd
         SynetConvolution32fNhwcDirect::SynetConvolution32fNhwcDirect(const ConvParam32f& p)
             : Avx::SynetConvolution32fNhwcDirect(p)
         {
-            if (p.dstC <= Sse2::F)
+            if (p.dstC / p.group <= Sse2::F)
                 return;
             //_old.enable = true;
             if (_old.enable)
@@ -362,12 +362,9 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
-        void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
+        static SynetConvolution32f * SynetConvolution32fDenseInit(const ConvParam32f & param)
         {
-            ConvParam32f param(batch, conv, gemm);
-            if (!param.Valid())
-                return NULL;
-            else if (Avx::SynetConvolution32fDepthwiseDotProduct::Preferable(param))
+            if (Avx::SynetConvolution32fDepthwiseDotProduct::Preferable(param))
                 return new Avx::SynetConvolution32fDepthwiseDotProduct(param);
             else if (SynetConvolution32fWinograd::Preferable(param))
                 return new SynetConvolution32fWinograd(param);
@@ -382,6 +379,26 @@ namespace Simd
             else
                 return new SynetConvolution32fGemmNN(param);
         }
+
+        void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
+        {
+            ConvParam32f param(batch, conv, gemm);
+            if (!param.Valid())
+                return NULL;
+            else if (SynetConvolution32fSparse::Preferable(param))
+                return new SynetConvolution32fSparse(param, SynetConvolution32fDenseInit(param));
+            else
+                return SynetConvolution32fDenseInit(param);
+        }
+
+        void * SynetConvolution32fInitV2(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType)
+        {
+            ConvParam32f param(batch, conv, gemm);
+            if (param.Valid() && SynetConvolution32fProd16::Preferable(param, weightType))
+                return new SynetConvolution32fProd16(param, weightType);
+            else
+                return SynetConvolution32fInit(batch, conv, gemm);
+        }
     }
 #endif//SIMD_AVX2_ENABLE
 }
@@ -0,0 +1,306 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdSynetNormalize.h"
+#include "Simd/SimdSynetConvolution32fCommon.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Avx2
+    {
+        template<SimdConvolutionActivationType type> SIMD_INLINE void NormalizeParams(const float* params, size_t channel, __m256* _params)
+        {
+            if (type == SimdConvolutionActivationPrelu)
+                _params[0] = _mm256_set1_ps(params[channel]);
+            else if (type != SimdConvolutionActivationIdentity && type != SimdConvolutionActivationRelu)
+            {
+                _params[0] = _mm256_set1_ps(params[0]);
+                if (type == SimdConvolutionActivationRestrictRange || type == SimdConvolutionActivationHswish || type == SimdConvolutionActivationHardSigmoid)
+                    _params[1] = _mm256_set1_ps(params[1]);
+            }
+        }
+
+        SIMD_INLINE void NormalizeStatistics(const __m256& count, const __m256& eps, float* mean, float* norm)
+        {
+            __m256 _mean = _mm256_div_ps(_mm256_loadu_ps(mean), count);
+            __m256 _var = _mm256_max_ps(_mm256_sub_ps(_mm256_div_ps(_mm256_loadu_ps(norm), count), _mm256_mul_ps(_mean, _mean)), _mm256_setzero_ps());
+            _mm256_storeu_ps(mean, _mean);
+            _mm256_storeu_ps(norm, _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(_mm256_add_ps(_var, eps))));
+        }
+
+        template<SimdConvolutionActivationType type> void SynetLayerNormalize32fNchw(const float* src, size_t batch, size_t channels, size_t spatial,
+            const float* scale, const float* shift, float eps, const float* params, float* dst)
+        {
+            size_t spatialF = AlignLo(spatial, F);
+            Array32f buf(spatial * 2);
+            float* mean = buf.data, * norm = mean + spatial;
+            __m256 _count = _mm256_set1_ps(float(channels)), _eps = _mm256_set1_ps(eps), _params[2];
+            for (size_t b = 0; b < batch; ++b)
+            {
+                buf.Clear();
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    const float* ps = src + c * spatial;
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                    {
+                        __m256 _src = _mm256_loadu_ps(ps + s);
+                        _mm256_storeu_ps(mean + s, _mm256_add_ps(_mm256_loadu_ps(mean + s), _src));
+                        _mm256_storeu_ps(norm + s, _mm256_fmadd_ps(_src, _src, _mm256_loadu_ps(norm + s)));
+                    }
+                    for (; s < spatial; ++s)
+                    {
+                        mean[s] += ps[s];
+                        norm[s] += Simd::Square(ps[s]);
+                    }
+                }
+                size_t s = 0;
+                for (; s < spatialF; s += F)
+                    NormalizeStatistics(_count, _eps, mean + s, norm + s);
+                for (; s < spatial; ++s)
+                    Base::NormalizeStatistics(mean[s], norm[s], channels, eps, mean[s], norm[s]);
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    __m256 _scale = _mm256_set1_ps(scale[c]);
+                    __m256 _shift = _mm256_set1_ps(shift[c]);
+                    NormalizeParams<type>(params, c, _params);
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                    {
+                        __m256 _dst = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(src + s), _mm256_loadu_ps(mean + s)), _mm256_loadu_ps(norm + s));
+                        _mm256_storeu_ps(dst + s, Activate<type>(_mm256_fmadd_ps(_dst, _scale, _shift), _params, 0));
+                    }
+                    for (; s < spatial; ++s)
+                        dst[s] = Base::Activate<type>((src[s] - mean[s]) * norm[s] * scale[c] + shift[c], params, c);
+                    src += spatial;
+                    dst += spatial;
+                }
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void SynetLayerNormalize32fNhwc(const float* src, size_t batch, size_t channels, size_t spatial,
+            const float* scale, const float* shift, float eps, const float* params, float* dst)
+        {
+            size_t channelsF = AlignLo(channels, F);
+            for (size_t i = 0, n = batch * spatial; i < n; ++i)
+            {
+                __m256 _sum = _mm256_setzero_ps(), _sqsum = _mm256_setzero_ps();
+                size_t c = 0;
+                for (; c < channelsF; c += F)
+                {
+                    __m256 _src = _mm256_loadu_ps(src + c);
+                    _sum = _mm256_add_ps(_sum, _src);
+                    _sqsum = _mm256_fmadd_ps(_src, _src, _sqsum);
+                }
+                float sum = Avx::ExtractSum(_sum), sqsum = Avx::ExtractSum(_sqsum), mean, norm;
+                for (; c < channels; ++c)
+                {
+                    sum += src[c];
+                    sqsum += Simd::Square(src[c]);
+                }
+                Base::NormalizeStatistics(sum, sqsum, channels, eps, mean, norm);
+                __m256 _mean = _mm256_set1_ps(mean), _norm = _mm256_set1_ps(norm);
+                for (c = 0; c < channelsF; c += F)
+                {
+                    __m256 _dst = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(src + c), _mean), _norm);
+                    _dst = _mm256_fmadd_ps(_dst, _mm256_loadu_ps(scale + c), _mm256_loadu_ps(shift + c));
+                    _mm256_storeu_ps(dst + c, Activate<type>(_dst, params, c));
+                }
+                for (; c < channels; ++c)
+                    dst[c] = Base::Activate<type>((src[c] - mean) * norm * scale[c] + shift[c], params, c);
+                src += channels;
+                dst += channels;
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void SynetLayerNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial,
+            const float* scale, const float* shift, float eps, SimdTensorFormatType format, const float* params, float* dst)
+        {
+            if (format == SimdTensorFormatNchw)
+                SynetLayerNormalize32fNchw<type>(src, batch, channels, spatial, scale, shift, eps, params, dst);
+            else if (format == SimdTensorFormatNhwc)
+                SynetLayerNormalize32fNhwc<type>(src, batch, channels, spatial, scale, shift, eps, params, dst);
+            else
+                assert(0);
+        }
+
+        void SynetLayerNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst)
+        {
+            Array32f affine;
+            Base::NormalizeAffine(channels, scale, shift, affine);
+            switch (activation)
+            {
+            case SimdConvolutionActivationIdentity: SynetLayerNormalize32f<SimdConvolutionActivationIdentity>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationRelu: SynetLayerNormalize32f<SimdConvolutionActivationRelu>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationLeakyRelu: SynetLayerNormalize32f<SimdConvolutionActivationLeakyRelu>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationRestrictRange: SynetLayerNormalize32f<SimdConvolutionActivationRestrictRange>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationPrelu: SynetLayerNormalize32f<SimdConvolutionActivationPrelu>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationElu: SynetLayerNormalize32f<SimdConvolutionActivationElu>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationHswish: SynetLayerNormalize32f<SimdConvolutionActivationHswish>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationMish: SynetLayerNormalize32f<SimdConvolutionActivationMish>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationHardSigmoid: SynetLayerNormalize32f<SimdConvolutionActivationHardSigmoid>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<SimdConvolutionActivationType type> void SynetGroupNormalize32fNchw(const float* src, size_t batch, size_t channels, size_t spatial,
+            size_t group, const float* scale, const float* shift, float eps, const float* params, float* dst)
+        {
+            size_t groupC = channels / group, size = groupC * spatial, sizeF = AlignLo(size, F), spatialF = AlignLo(spatial, F);
+            __m256 _params[2];
+            for (size_t b = 0; b < batch; ++b)
+            {
+                for (size_t g = 0, c = 0; g < group; ++g)
+                {
+                    __m256 _sum = _mm256_setzero_ps(), _sqsum = _mm256_setzero_ps();
+                    size_t i = 0;
+                    for (; i < sizeF; i += F)
+                    {
+                        __m256 _src = _mm256_loadu_ps(src + i);
+                        _sum = _mm256_add_ps(_sum, _src);
+                        _sqsum = _mm256_fmadd_ps(_src, _src, _sqsum);
+                    }
+                    float sum = Avx::ExtractSum(_sum), sqsum = Avx::ExtractSum(_sqsum), mean, norm;
+                    for (; i < size; ++i)
+                    {
+                        sum += src[i];
+                        sqsum += Simd::Square(src[i]);
+                    }
+                    Base::NormalizeStatistics(sum, sqsum, size, eps, mean, norm);
+                    for (size_t e = c + groupC; c < e; ++c)
+                    {
+                        float k = norm * scale[c], s = shift[c] - mean * k;
+                        __m256 _k = _mm256_set1_ps(k), _s = _mm256_set1_ps(s);
+                        NormalizeParams<type>(params, c, _params);
+                        for (i = 0; i < spatialF; i += F)
+                            _mm256_storeu_ps(dst + i, Activate<type>(_mm256_fmadd_ps(_mm256_loadu_ps(src + i), _k, _s), _params, 0));
+                        for (; i < spatial; ++i)
+                            dst[i] = Base::Activate<type>(src[i] * k + s, params, c);
+                        src += spatial;
+                        dst += spatial;
+                    }
+                }
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void SynetGroupNormalize32fNhwc(const float* src, size_t batch, size_t channels, size_t spatial,
+            size_t group, const float* scale, const float* shift, float eps, const float* params, float* dst)
+        {
+            size_t groupC = channels / group, size = groupC * spatial, channelsF = AlignLo(channels, F);
+            Array32f buf(channels * 2);
+            float* k = buf.data, * s = k + channels;
+            for (size_t b = 0; b < batch; ++b)
+            {
+                buf.Clear();
+                for (size_t i = 0; i < spatial; ++i)
+                {
+                    const float* ps = src + i * channels;
+                    size_t c = 0;
+                    for (; c < channelsF; c += F)
+                    {
+                        __m256 _src = _mm256_loadu_ps(ps + c);
+                        _mm256_storeu_ps(k + c, _mm256_add_ps(_mm256_loadu_ps(k + c), _src));
+                        _mm256_storeu_ps(s + c, _mm256_fmadd_ps(_src, _src, _mm256_loadu_ps(s + c)));
+                    }
+                    for (; c < channels; ++c)
+                    {
+                        k[c] += ps[c];
+                        s[c] += Simd::Square(ps[c]);
+                    }
+                }
+                for (size_t g = 0, c = 0; g < group; ++g)
+                {
+                    float sum = 0.0f, sqsum = 0.0f, mean, norm;
+                    for (size_t i = c, e = c + groupC; i < e; ++i)
+                    {
+                        sum += k[i];
+                        sqsum += s[i];
+                    }
+                    Base::NormalizeStatistics(sum, sqsum, size, eps, mean, norm);
+                    for (size_t e = c + groupC; c < e; ++c)
+                    {
+                        k[c] = norm * scale[c];
+                        s[c] = shift[c] - mean * k[c];
+                    }
+                }
+                for (size_t i = 0; i < spatial; ++i)
+                {
+                    size_t c = 0;
+                    for (; c < channelsF; c += F)
+                    {
+                        __m256 _dst = _mm256_fmadd_ps(_mm256_loadu_ps(src + c), _mm256_loadu_ps(k + c), _mm256_loadu_ps(s + c));
+                        _mm256_storeu_ps(dst + c, Activate<type>(_dst, params, c));
+                    }
+                    for (; c < channels; ++c)
+                        dst[c] = Base::Activate<type>(src[c] * k[c] + s[c], params, c);
+                    src += channels;
+                    dst += channels;
+                }
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void SynetGroupNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial,
+            size_t group, const float* scale, const float* shift, float eps, SimdTensorFormatType format, const float* params, float* dst)
+        {
+            if (format == SimdTensorFormatNchw)
+                SynetGroupNormalize32fNchw<type>(src, batch, channels, spatial, group, scale, shift, eps, params, dst);
+            else if (format == SimdTensorFormatNhwc)
+                SynetGroupNormalize32fNhwc<type>(src, batch, channels, spatial, group, scale, shift, eps, params, dst);
+            else
+                assert(0);
+        }
+
+        void SynetGroupNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst)
+        {
+            assert(channels % group == 0);
+            Array32f affine;
+            Base::NormalizeAffine(channels, scale, shift, affine);
+            switch (activation)
+            {
+            case SimdConvolutionActivationIdentity: SynetGroupNormalize32f<SimdConvolutionActivationIdentity>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationRelu: SynetGroupNormalize32f<SimdConvolutionActivationRelu>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationLeakyRelu: SynetGroupNormalize32f<SimdConvolutionActivationLeakyRelu>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationRestrictRange: SynetGroupNormalize32f<SimdConvolutionActivationRestrictRange>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationPrelu: SynetGroupNormalize32f<SimdConvolutionActivationPrelu>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationElu: SynetGroupNormalize32f<SimdConvolutionActivationElu>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationHswish: SynetGroupNormalize32f<SimdConvolutionActivationHswish>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationMish: SynetGroupNormalize32f<SimdConvolutionActivationMish>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationHardSigmoid: SynetGroupNormalize32f<SimdConvolutionActivationHardSigmoid>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif
+}
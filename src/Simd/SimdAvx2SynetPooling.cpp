@@ -22,6 +22,8 @@
 * SOFTWARE.
 */
 #include "Simd/SimdStore.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdSse41.h"
 #include "Simd/SimdAvx1.h"
@@ -55,6 +57,128 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        SIMD_INLINE __m256i PoolingAverageRound(__m256i sum, const __m256& half, const __m256& area)
+        {
+            return _mm256_cvttps_epi32(_mm256_div_ps(_mm256_add_ps(_mm256_cvtepi32_ps(sum), half), area));
+        }
+
+        SIMD_INLINE void PoolingAverageStore(const __m256i& sum0, const __m256i& sum1, const __m256i& sum2, const __m256i& sum3,
+            const __m256& half, const __m256& area, uint8_t* dst)
+        {
+            __m256i d0 = _mm256_packs_epi32(PoolingAverageRound(sum0, half, area), PoolingAverageRound(sum1, half, area));
+            __m256i d1 = _mm256_packs_epi32(PoolingAverageRound(sum2, half, area), PoolingAverageRound(sum3, half, area));
+            _mm256_storeu_si256((__m256i*)dst, _mm256_packus_epi16(d0, d1));
+        }
+
+        SIMD_INLINE void PoolingAverageNhwc1(const uint8_t* src, size_t srcS, size_t srcC, size_t kH, size_t kW, const __m256& half, const __m256& area, uint8_t* dst)
+        {
+            __m256i sum0 = _mm256_setzero_si256();
+            __m256i sum1 = _mm256_setzero_si256();
+            for (size_t h = 0; h < kH; ++h)
+            {
+                for (size_t w = 0; w < kW; ++w)
+                {
+                    __m256i s0 = _mm256_loadu_si256((__m256i*)(src + w * srcC));
+                    sum0 = _mm256_add_epi16(sum0, _mm256_unpacklo_epi8(s0, K_ZERO));
+                    sum1 = _mm256_add_epi16(sum1, _mm256_unpackhi_epi8(s0, K_ZERO));
+                }
+                src += srcS;
+            }
+            PoolingAverageStore(_mm256_unpacklo_epi16(sum0, K_ZERO), _mm256_unpackhi_epi16(sum0, K_ZERO),
+                _mm256_unpacklo_epi16(sum1, K_ZERO), _mm256_unpackhi_epi16(sum1, K_ZERO), half, area, dst);
+        }
+
+        SIMD_INLINE void PoolingAverageGlobalNhwc1(const uint8_t* src, size_t size, size_t srcC, const __m256& half, const __m256& area, uint8_t* dst)
+        {
+            __m256i sum0 = _mm256_setzero_si256();
+            __m256i sum1 = _mm256_setzero_si256();
+            __m256i sum2 = _mm256_setzero_si256();
+            __m256i sum3 = _mm256_setzero_si256();
+            for (size_t i = 0; i < size;)
+            {
+                size_t n = Simd::Min(i + Base::POOLING_AVERAGE_16U_MAX, size);
+                __m256i lo = _mm256_setzero_si256();
+                __m256i hi = _mm256_setzero_si256();
+                for (; i < n; ++i, src += srcC)
+                {
+                    __m256i s0 = _mm256_loadu_si256((__m256i*)src);
+                    lo = _mm256_add_epi16(lo, _mm256_unpacklo_epi8(s0, K_ZERO));
+                    hi = _mm256_add_epi16(hi, _mm256_unpackhi_epi8(s0, K_ZERO));
+                }
+                sum0 = _mm256_add_epi32(sum0, _mm256_unpacklo_epi16(lo, K_ZERO));
+                sum1 = _mm256_add_epi32(sum1, _mm256_unpackhi_epi16(lo, K_ZERO));
+                sum2 = _mm256_add_epi32(sum2, _mm256_unpacklo_epi16(hi, K_ZERO));
+                sum3 = _mm256_add_epi32(sum3, _mm256_unpackhi_epi16(hi, K_ZERO));
+            }
+            PoolingAverageStore(sum0, sum1, sum2, sum3, half, area, dst);
+        }
+
+        SIMD_INLINE uint8_t PoolingAverageGlobalNchw(const uint8_t* src, size_t size)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            __m256i sum = _mm256_setzero_si256();
+            for (; i < sizeA; i += A)
+                sum = _mm256_add_epi64(sum, _mm256_sad_epu8(_mm256_loadu_si256((__m256i*)(src + i)), K_ZERO));
+            size_t total = (size_t)ExtractSum<uint64_t>(sum);
+            for (; i < size; ++i)
+                total += src[i];
+            return uint8_t((total + size / 2) / size);
+        }
+
+        void SynetPoolingForwardAverage8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+            size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format)
+        {
+            if (Base::IsGlobalPooling(srcH, srcW, kernelY, kernelX, padY, padX))
+            {
+                size_t size = srcH * srcW;
+                if (format == SimdTensorFormatNhwc && srcC >= A && size <= Base::POOLING_AVERAGE_32F_MAX)
+                {
+                    __m256 half = _mm256_set1_ps(float(size / 2)), area = _mm256_set1_ps(float(size));
+                    size_t srcCA = AlignLo(srcC, A);
+                    for (size_t c = 0; c < srcCA; c += A)
+                        PoolingAverageGlobalNhwc1(src + c, size, srcC, half, area, dst + c);
+                    if (srcCA < srcC)
+                        PoolingAverageGlobalNhwc1(src + srcC - A, size, srcC, half, area, dst + srcC - A);
+                    return;
+                }
+                if (format == SimdTensorFormatNchw)
+                {
+                    for (size_t c = 0; c < srcC; ++c)
+                        dst[c] = PoolingAverageGlobalNchw(src + c * size, size);
+                    return;
+                }
+            }
+            if (format == SimdTensorFormatNhwc && srcC >= A && kernelY * kernelX <= Base::POOLING_AVERAGE_16U_MAX)
+            {
+                size_t srcS = srcW * srcC;
+                size_t srcCA = AlignLo(srcC, A);
+                for (size_t ph = 0; ph < dstH; ++ph)
+                {
+                    size_t hStart = ph * strideY - padY;
+                    size_t hEnd = Simd::Min(hStart + kernelY, srcH);
+                    hStart = Simd::Max<ptrdiff_t>(0, hStart);
+                    for (size_t pw = 0; pw < dstW; ++pw)
+                    {
+                        size_t wStart = pw * strideX - padX;
+                        size_t wEnd = Simd::Min(wStart + kernelX, srcW);
+                        wStart = Simd::Max<ptrdiff_t>(0, wStart);
+                        size_t kH = hEnd - hStart, kW = wEnd - wStart, size = excludePad ? kH * kW : kernelY * kernelX;
+                        __m256 half = _mm256_set1_ps(float(size / 2)), area = _mm256_set1_ps(float(size));
+                        const uint8_t* ps = src + hStart * srcS + wStart * srcC;
+                        for (size_t c = 0; c < srcCA; c += A)
+                            PoolingAverageNhwc1(ps + c, srcS, srcC, kH, kW, half, area, dst + c);
+                        if (srcCA < srcC)
+                            PoolingAverageNhwc1(ps + srcC - A, srcS, srcC, kH, kW, half, area, dst + srcC - A);
+                        dst += srcC;
+                    }
+                }
+            }
+            else
+                Sse41::SynetPoolingForwardAverage8u(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, excludePad, format);
+        }
+
+        //---------------------------------------------------------------------
+
         SIMD_INLINE void PoolingMaxNhwc1(const uint8_t* src, size_t srcS, size_t srcC, size_t kH, size_t kW, const __m256i& min, uint8_t* dst)
         {
             __m256i max0 = min;
@@ -0,0 +1,266 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Avx2
+    {
+        template<SimdSynetReduceType type> SIMD_INLINE __m256 SynetReduceInit()
+        {
+            return _mm256_set1_ps(Base::SynetReduceInit<type>());
+        }
+
+        template<SimdSynetReduceType type> SIMD_INLINE __m256 SynetReduce(__m256 sum, __m256 value)
+        {
+            return _mm256_add_ps(sum, value);
+        }
+
+        template<> SIMD_INLINE __m256 SynetReduce<SimdSynetReduceL2>(__m256 sum, __m256 value)
+        {
+            return _mm256_fmadd_ps(value, value, sum);
+        }
+
+        template<> SIMD_INLINE __m256 SynetReduce<SimdSynetReduceMax>(__m256 sum, __m256 value)
+        {
+            return _mm256_max_ps(sum, value);
+        }
+
+        template<> SIMD_INLINE __m256 SynetReduce<SimdSynetReduceMin>(__m256 sum, __m256 value)
+        {
+            return _mm256_min_ps(sum, value);
+        }
+
+        template<SimdSynetReduceType type> SIMD_INLINE __m256 SynetReduceCombine(__m256 a, __m256 b)
+        {
+            return SynetReduce<type>(a, b);
+        }
+
+        template<> SIMD_INLINE __m256 SynetReduceCombine<SimdSynetReduceL2>(__m256 a, __m256 b)
+        {
+            return _mm256_add_ps(a, b);
+        }
+
+        template<SimdSynetReduceType type> SIMD_INLINE __m256 SynetReduceFinal(__m256 sum, __m256 count)
+        {
+            return sum;
+        }
+
+        template<> SIMD_INLINE __m256 SynetReduceFinal<SimdSynetReduceL2>(__m256 sum, __m256 count)
+        {
+            return _mm256_sqrt_ps(sum);
+        }
+
+        template<> SIMD_INLINE __m256 SynetReduceFinal<SimdSynetReduceMean>(__m256 sum, __m256 count)
+        {
+            return _mm256_div_ps(sum, count);
+        }
+
+        template<SimdSynetReduceType type> SIMD_INLINE float SynetReduceHorizontal(__m256 sum)
+        {
+            return Avx::ExtractSum(sum);
+        }
+
+        template<> SIMD_INLINE float SynetReduceHorizontal<SimdSynetReduceMax>(__m256 sum)
+        {
+            __m128 _sum = _mm_max_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+            _sum = _mm_max_ps(_sum, _mm_movehl_ps(_sum, _sum));
+            _sum = _mm_max_ss(_sum, _mm_shuffle_ps(_sum, _sum, 1));
+            return _mm_cvtss_f32(_sum);
+        }
+
+        template<> SIMD_INLINE float SynetReduceHorizontal<SimdSynetReduceMin>(__m256 sum)
+        {
+            __m128 _sum = _mm_min_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+            _sum = _mm_min_ps(_sum, _mm_movehl_ps(_sum, _sum));
+            _sum = _mm_min_ss(_sum, _mm_shuffle_ps(_sum, _sum, 1));
+            return _mm_cvtss_f32(_sum);
+        }
+
+        //---------------------------------------------------------------------
+
+        template<SimdSynetReduceType type> void SynetReduceRows(const float* src, size_t rows, size_t cols, float* dst)
+        {
+            size_t colsF = AlignLo(cols, F), colsQF = AlignLo(cols, QF), j = 0;
+            __m256 _count = _mm256_set1_ps(float(rows));
+            for (; j < colsQF; j += QF)
+            {
+                __m256 sum0 = SynetReduceInit<type>(), sum1 = sum0, sum2 = sum0, sum3 = sum0;
+                const float* ps = src + j;
+                for (size_t i = 0; i < rows; ++i, ps += cols)
+                {
+                    sum0 = SynetReduce<type>(sum0, _mm256_loadu_ps(ps + 0 * F));
+                    sum1 = SynetReduce<type>(sum1, _mm256_loadu_ps(ps + 1 * F));
+                    sum2 = SynetReduce<type>(sum2, _mm256_loadu_ps(ps + 2 * F));
+                    sum3 = SynetReduce<type>(sum3, _mm256_loadu_ps(ps + 3 * F));
+                }
+                _mm256_storeu_ps(dst + j + 0 * F, SynetReduceFinal<type>(sum0, _count));
+                _mm256_storeu_ps(dst + j + 1 * F, SynetReduceFinal<type>(sum1, _count));
+                _mm256_storeu_ps(dst + j + 2 * F, SynetReduceFinal<type>(sum2, _count));
+                _mm256_storeu_ps(dst + j + 3 * F, SynetReduceFinal<type>(sum3, _count));
+            }
+            for (; j < colsF; j += F)
+            {
+                __m256 sum = SynetReduceInit<type>();
+                const float* ps = src + j;
+                for (size_t i = 0; i < rows; ++i, ps += cols)
+                    sum = SynetReduce<type>(sum, _mm256_loadu_ps(ps));
+                _mm256_storeu_ps(dst + j, SynetReduceFinal<type>(sum, _count));
+            }
+            for (; j < cols; ++j)
+            {
+                float sum = Base::SynetReduceInit<type>();
+                const float* ps = src + j;
+                for (size_t i = 0; i < rows; ++i, ps += cols)
+                    sum = Base::SynetReduce<type>(sum, ps[0]);
+                dst[j] = Base::SynetReduceFinal<type>(sum, float(rows));
+            }
+        }
+
+        template<SimdSynetReduceType type> void SynetReduceCols(const float* src, size_t rows, size_t cols, float* dst)
+        {
+            size_t colsF = AlignLo(cols, F), colsQF = AlignLo(cols, QF);
+            for (size_t i = 0; i < rows; ++i, src += cols)
+            {
+                size_t j = 0;
+                __m256 sum0 = SynetReduceInit<type>(), sum1 = sum0, sum2 = sum0, sum3 = sum0;
+                for (; j < colsQF; j += QF)
+                {
+                    sum0 = SynetReduce<type>(sum0, _mm256_loadu_ps(src + j + 0 * F));
+                    sum1 = SynetReduce<type>(sum1, _mm256_loadu_ps(src + j + 1 * F));
+                    sum2 = SynetReduce<type>(sum2, _mm256_loadu_ps(src + j + 2 * F));
+                    sum3 = SynetReduce<type>(sum3, _mm256_loadu_ps(src + j + 3 * F));
+                }
+                for (; j < colsF; j += F)
+                    sum0 = SynetReduce<type>(sum0, _mm256_loadu_ps(src + j));
+                sum0 = SynetReduceCombine<type>(SynetReduceCombine<type>(sum0, sum1), SynetReduceCombine<type>(sum2, sum3));
+                float sum = SynetReduceHorizontal<type>(sum0);
+                for (; j < cols; ++j)
+                    sum = Base::SynetReduce<type>(sum, src[j]);
+                dst[i] = Base::SynetReduceFinal<type>(sum, float(cols));
+            }
+        }
+
+        void SynetReduceLayerForward(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+            SimdSynetReduceType type, SimdBool reduceChannels, SimdBool reduceSpatial, float* dst)
+        {
+            switch (type)
+            {
+            case SimdSynetReduceL2: Base::SynetReduceLayerForward(src, batch, channels, spatial, format, reduceChannels, reduceSpatial, dst, SynetReduceRows<SimdSynetReduceL2>, SynetReduceCols<SimdSynetReduceL2>); break;
+            case SimdSynetReduceMax: Base::SynetReduceLayerForward(src, batch, channels, spatial, format, reduceChannels, reduceSpatial, dst, SynetReduceRows<SimdSynetReduceMax>, SynetReduceCols<SimdSynetReduceMax>); break;
+            case SimdSynetReduceMean: Base::SynetReduceLayerForward(src, batch, channels, spatial, format, reduceChannels, reduceSpatial, dst, SynetReduceRows<SimdSynetReduceMean>, SynetReduceCols<SimdSynetReduceMean>); break;
+            case SimdSynetReduceMin: Base::SynetReduceLayerForward(src, batch, channels, spatial, format, reduceChannels, reduceSpatial, dst, SynetReduceRows<SimdSynetReduceMin>, SynetReduceCols<SimdSynetReduceMin>); break;
+            case SimdSynetReduceSum: Base::SynetReduceLayerForward(src, batch, channels, spatial, format, reduceChannels, reduceSpatial, dst, SynetReduceRows<SimdSynetReduceSum>, SynetReduceCols<SimdSynetReduceSum>); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE float SquareSum(const float* src, size_t size)
+        {
+            size_t sizeF = AlignLo(size, F), sizeQF = AlignLo(size, QF), i = 0;
+            __m256 sum0 = _mm256_setzero_ps(), sum1 = _mm256_setzero_ps(), sum2 = _mm256_setzero_ps(), sum3 = _mm256_setzero_ps();
+            for (; i < sizeQF; i += QF)
+            {
+                sum0 = SynetReduce<SimdSynetReduceL2>(sum0, _mm256_loadu_ps(src + i + 0 * F));
+                sum1 = SynetReduce<SimdSynetReduceL2>(sum1, _mm256_loadu_ps(src + i + 1 * F));
+                sum2 = SynetReduce<SimdSynetReduceL2>(sum2, _mm256_loadu_ps(src + i + 2 * F));
+                sum3 = SynetReduce<SimdSynetReduceL2>(sum3, _mm256_loadu_ps(src + i + 3 * F));
+            }
+            for (; i < sizeF; i += F)
+                sum0 = SynetReduce<SimdSynetReduceL2>(sum0, _mm256_loadu_ps(src + i));
+            float sum = Avx::ExtractSum(_mm256_add_ps(_mm256_add_ps(sum0, sum1), _mm256_add_ps(sum2, sum3)));
+            for (; i < size; ++i)
+                sum += Simd::Square(src[i]);
+            return sum;
+        }
+
+        SIMD_INLINE void Scale(const float* src, size_t size, float scale, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m256 _scale = _mm256_set1_ps(scale);
+            for (; i < sizeF; i += F)
+                _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_loadu_ps(src + i), _scale));
+            for (; i < size; ++i)
+                dst[i] = src[i] * scale;
+        }
+
+        void SynetL2Normalize32f(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+            SimdBool acrossSpatial, const float* eps, float* dst)
+        {
+            assert(format == SimdTensorFormatNchw || format == SimdTensorFormatNhwc);
+            float epsilon = eps[0];
+            size_t size = channels * spatial;
+            if (acrossSpatial)
+            {
+                for (size_t b = 0; b < batch; ++b, src += size, dst += size)
+                    Scale(src, size, 1.0f / ::sqrt(SquareSum(src, size) + epsilon), dst);
+            }
+            else if (format == SimdTensorFormatNchw)
+            {
+                size_t spatialF = AlignLo(spatial, F), s;
+                Array32f buf(spatial);
+                __m256 _eps = _mm256_set1_ps(epsilon), _one = _mm256_set1_ps(1.0f);
+                for (size_t b = 0; b < batch; ++b, src += size, dst += size)
+                {
+                    buf.Clear();
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        const float* ps = src + c * spatial;
+                        for (s = 0; s < spatialF; s += F)
+                            _mm256_storeu_ps(buf.data + s, SynetReduce<SimdSynetReduceL2>(_mm256_loadu_ps(buf.data + s), _mm256_loadu_ps(ps + s)));
+                        for (; s < spatial; ++s)
+                            buf[s] += Simd::Square(ps[s]);
+                    }
+                    for (s = 0; s < spatialF; s += F)
+                        _mm256_storeu_ps(buf.data + s, _mm256_div_ps(_one, _mm256_sqrt_ps(_mm256_add_ps(_mm256_loadu_ps(buf.data + s), _eps))));
+                    for (; s < spatial; ++s)
+                        buf[s] = 1.0f / ::sqrt(buf[s] + epsilon);
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        const float* ps = src + c * spatial;
+                        float* pd = dst + c * spatial;
+                        for (s = 0; s < spatialF; s += F)
+                            _mm256_storeu_ps(pd + s, _mm256_mul_ps(_mm256_loadu_ps(ps + s), _mm256_loadu_ps(buf.data + s)));
+                        for (; s < spatial; ++s)
+                            pd[s] = ps[s] * buf[s];
+                    }
+                }
+            }
+            else
+            {
+                for (size_t s = 0, n = batch * spatial; s < n; ++s, src += channels, dst += channels)
+                    Scale(src, channels, 1.0f / ::sqrt(SquareSum(src, channels) + epsilon), dst);
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,186 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdGemm8iPacked.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdCpu.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx512bw
+    {
+        typedef Base::Gemm8iPackedNN::Post Post;
+
+        template<SimdTensorDataType dstT> SIMD_INLINE void Gemm8iPackedSave(uint8_t * C, __m512i sum, const Post & post, int32_t rowSum, size_t j, __mmask16 tail)
+        {
+            sum = _mm512_add_epi32(sum, _mm512_loadu_si512(post.comp + j));
+            if (post.zero)
+                sum = _mm512_add_epi32(sum, _mm512_mullo_epi32(_mm512_loadu_si512(post.zero + j), _mm512_set1_epi32(rowSum)));
+            if (dstT == SimdTensorData32i)
+                _mm512_mask_storeu_epi32(C, tail, sum);
+            else
+            {
+                __m512 f32 = _mm512_fmadd_ps(_mm512_cvtepi32_ps(sum), _mm512_loadu_ps(post.scale + j), _mm512_loadu_ps(post.shift + j));
+                if (dstT == SimdTensorData32f)
+                    _mm512_mask_storeu_ps(C, tail, f32);
+                else
+                    _mm512_mask_cvtusepi32_storeu_epi8(C, tail, _mm512_max_epi32(_mm512_cvtps_epi32(f32), K_ZERO));
+            }
+        }
+
+        template<SimdTensorDataType dstT> SIMD_INLINE void Gemm8iPackedSave2(uint8_t * C, __m512i sum0, __m512i sum1, const Post & post, int32_t rowSum, size_t j, const __mmask16 * tails)
+        {
+            const size_t size = dstT == SimdTensorData8u ? 1 : 4;
+            Gemm8iPackedSave<dstT>(C, sum0, post, rowSum, j, tails[0]);
+            if (tails[1])
+                Gemm8iPackedSave<dstT>(C + F * size, sum1, post, rowSum, j + F, tails[1]);
+        }
+
+        SIMD_INLINE __m512i Gemm8iPackedLoadA(const uint8_t * A, size_t tail)
+        {
+            int32_t a = 0;
+            memcpy(&a, A, tail);
+            return _mm512_set1_epi32(a);
+        }
+
+        template<bool overflow, SimdTensorDataType dstT, int M> void Gemm8iPackedMicro(size_t K, const uint8_t * A, size_t lda, 
+            const int8_t * B, uint8_t * C, size_t ldc, const Post & post, size_t i, size_t j, const __mmask16 * tails)
+        {
+            const size_t K4 = AlignLo(K, 4), size = dstT == SimdTensorData8u ? 1 : 4;
+            const uint8_t * A0 = A, * A1 = A0 + lda, * A2 = A1 + lda, * A3 = A2 + lda;
+            const uint8_t * A4 = A3 + lda, * A5 = A4 + lda, * A6 = A5 + lda, * A7 = A6 + lda;
+            __m512i c00, c01, c10, c11, c20, c21, c30, c31, c40, c41, c50, c51, c60, c61, c70, c71, a0, b0, b1;
+            if (M > 0) c00 = _mm512_setzero_si512(), c01 = _mm512_setzero_si512();
+            if (M > 1) c10 = _mm512_setzero_si512(), c11 = _mm512_setzero_si512();
+            if (M > 2) c20 = _mm512_setzero_si512(), c21 = _mm512_setzero_si512();
+            if (M > 3) c30 = _mm512_setzero_si512(), c31 = _mm512_setzero_si512();
+            if (M > 4) c40 = _mm512_setzero_si512(), c41 = _mm512_setzero_si512();
+            if (M > 5) c50 = _mm512_setzero_si512(), c51 = _mm512_setzero_si512();
+            if (M > 6) c60 = _mm512_setzero_si512(), c61 = _mm512_setzero_si512();
+            if (M > 7) c70 = _mm512_setzero_si512(), c71 = _mm512_setzero_si512();
+            for (size_t k = 0; k < K4; k += 4)
+            {
+                b0 = _mm512_loadu_si512((__m512i*)B + 0);
+                b1 = _mm512_loadu_si512((__m512i*)B + 1);
+                if (M > 0) a0 = _mm512_set1_epi32(*(int32_t*)(A0 + k)), Madd4<overflow>(c00, a0, b0), Madd4<overflow>(c01, a0, b1);
+                if (M > 1) a0 = _mm512_set1_epi32(*(int32_t*)(A1 + k)), Madd4<overflow>(c10, a0, b0), Madd4<overflow>(c11, a0, b1);
+                if (M > 2) a0 = _mm512_set1_epi32(*(int32_t*)(A2 + k)), Madd4<overflow>(c20, a0, b0), Madd4<overflow>(c21, a0, b1);
+                if (M > 3) a0 = _mm512_set1_epi32(*(int32_t*)(A3 + k)), Madd4<overflow>(c30, a0, b0), Madd4<overflow>(c31, a0, b1);
+                if (M > 4) a0 = _mm512_set1_epi32(*(int32_t*)(A4 + k)), Madd4<overflow>(c40, a0, b0), Madd4<overflow>(c41, a0, b1);
+                if (M > 5) a0 = _mm512_set1_epi32(*(int32_t*)(A5 + k)), Madd4<overflow>(c50, a0, b0), Madd4<overflow>(c51, a0, b1);
+                if (M > 6) a0 = _mm512_set1_epi32(*(int32_t*)(A6 + k)), Madd4<overflow>(c60, a0, b0), Madd4<overflow>(c61, a0, b1);
+                if (M > 7) a0 = _mm512_set1_epi32(*(int32_t*)(A7 + k)), Madd4<overflow>(c70, a0, b0), Madd4<overflow>(c71, a0, b1);
+                B += DA;
+            }
+            if (K4 < K)
+            {
+                size_t tail = K - K4;
+                b0 = _mm512_loadu_si512((__m512i*)B + 0);
+                b1 = _mm512_loadu_si512((__m512i*)B + 1);
+                if (M > 0) a0 = Gemm8iPackedLoadA(A0 + K4, tail), Madd4<overflow>(c00, a0, b0), Madd4<overflow>(c01, a0, b1);
+                if (M > 1) a0 = Gemm8iPackedLoadA(A1 + K4, tail), Madd4<overflow>(c10, a0, b0), Madd4<overflow>(c11, a0, b1);
+                if (M > 2) a0 = Gemm8iPackedLoadA(A2 + K4, tail), Madd4<overflow>(c20, a0, b0), Madd4<overflow>(c21, a0, b1);
+                if (M > 3) a0 = Gemm8iPackedLoadA(A3 + K4, tail), Madd4<overflow>(c30, a0, b0), Madd4<overflow>(c31, a0, b1);
+                if (M > 4) a0 = Gemm8iPackedLoadA(A4 + K4, tail), Madd4<overflow>(c40, a0, b0), Madd4<overflow>(c41, a0, b1);
+                if (M > 5) a0 = Gemm8iPackedLoadA(A5 + K4, tail), Madd4<overflow>(c50, a0, b0), Madd4<overflow>(c51, a0, b1);
+                if (M > 6) a0 = Gemm8iPackedLoadA(A6 + K4, tail), Madd4<overflow>(c60, a0, b0), Madd4<overflow>(c61, a0, b1);
+                if (M > 7) a0 = Gemm8iPackedLoadA(A7 + K4, tail), Madd4<overflow>(c70, a0, b0), Madd4<overflow>(c71, a0, b1);
+            }
+            const int32_t * sums = post.zero ? post.sums + i : NULL;
+            ldc *= size;
+            if (M > 0) Gemm8iPackedSave2<dstT>(C, c00, c01, post, sums ? sums[0] : 0, j, tails), C += ldc;
+            if (M > 1) Gemm8iPackedSave2<dstT>(C, c10, c11, post, sums ? sums[1] : 0, j, tails), C += ldc;
+            if (M > 2) Gemm8iPackedSave2<dstT>(C, c20, c21, post, sums ? sums[2] : 0, j, tails), C += ldc;
+            if (M > 3) Gemm8iPackedSave2<dstT>(C, c30, c31, post, sums ? sums[3] : 0, j, tails), C += ldc;
+            if (M > 4) Gemm8iPackedSave2<dstT>(C, c40, c41, post, sums ? sums[4] : 0, j, tails), C += ldc;
+            if (M > 5) Gemm8iPackedSave2<dstT>(C, c50, c51, post, sums ? sums[5] : 0, j, tails), C += ldc;
+            if (M > 6) Gemm8iPackedSave2<dstT>(C, c60, c61, post, sums ? sums[6] : 0, j, tails), C += ldc;
+            if (M > 7) Gemm8iPackedSave2<dstT>(C, c70, c71, post, sums ? sums[7] : 0, j, tails), C += ldc;
+        }
+
+        template<bool overflow, SimdTensorDataType dstT> void Gemm8iPackedRun(size_t M, size_t N, size_t K,
+            const uint8_t * A, size_t lda, const int8_t * pB, uint8_t * C, size_t ldc, const Post & post)
+        {
+            const size_t microM = 8, size = dstT == SimdTensorData8u ? 1 : 4;
+            const size_t K4 = AlignHi(K, 4), macroM = Simd::Max(microM, AlignLoAny(Base::AlgCacheL2() / 2 / K4, microM));
+            for (size_t i0 = 0; i0 < M; i0 += macroM)
+            {
+                size_t M0 = Simd::Min(M, i0 + macroM), M8 = i0 + AlignLoAny(M0 - i0, microM);
+                for (size_t j = 0; j < N; j += DF)
+                {
+                    size_t dN = Simd::Min(N, j + DF) - j;
+                    __mmask16 tails[2] = { TailMask16(dN), TailMask16(ptrdiff_t(dN) - F) };
+                    const int8_t * B = pB + j * K4;
+                    uint8_t * pC = C + j * size;
+                    size_t i = i0;
+                    for (; i < M8; i += microM)
+                        Gemm8iPackedMicro<overflow, dstT, 8>(K, A + i * lda, lda, B, pC + i * ldc * size, ldc, post, i, j, tails);
+                    switch (M0 - i)
+                    {
+                    case 1: Gemm8iPackedMicro<overflow, dstT, 1>(K, A + i * lda, lda, B, pC + i * ldc * size, ldc, post, i, j, tails); break;
+                    case 2: Gemm8iPackedMicro<overflow, dstT, 2>(K, A + i * lda, lda, B, pC + i * ldc * size, ldc, post, i, j, tails); break;
+                    case 3: Gemm8iPackedMicro<overflow, dstT, 3>(K, A + i * lda, lda, B, pC + i * ldc * size, ldc, post, i, j, tails); break;
+                    case 4: Gemm8iPackedMicro<overflow, dstT, 4>(K, A + i * lda, lda, B, pC + i * ldc * size, ldc, post, i, j, tails); break;
+                    case 5: Gemm8iPackedMicro<overflow, dstT, 5>(K, A + i * lda, lda, B, pC + i * ldc * size, ldc, post, i, j, tails); break;
+                    case 6: Gemm8iPackedMicro<overflow, dstT, 6>(K, A + i * lda, lda, B, pC + i * ldc * size, ldc, post, i, j, tails); break;
+                    case 7: Gemm8iPackedMicro<overflow, dstT, 7>(K, A + i * lda, lda, B, pC + i * ldc * size, ldc, post, i, j, tails); break;
+                    }
+                }
+            }
+        }
+
+        template<bool overflow> static Base::Gemm8iPackedNN::RunPtr GetGemm8iPackedRun(SimdTensorDataType dstT)
+        {
+            switch (dstT)
+            {
+            case SimdTensorData32i: return Gemm8iPackedRun<overflow, SimdTensorData32i>;
+            case SimdTensorData32f: return Gemm8iPackedRun<overflow, SimdTensorData32f>;
+            case SimdTensorData8u: return Gemm8iPackedRun<overflow, SimdTensorData8u>;
+            default:
+                assert(0); return NULL;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        Gemm8iPackedNN::Gemm8iPackedNN(const GemmPackedParam8i & p)
+            : Avx2::Gemm8iPackedNN(p)
+        {
+            _microN = DF;
+            _microK = 4;
+            _run = p.Precise() ? GetGemm8iPackedRun<false>(p.dstT) : GetGemm8iPackedRun<true>(p.dstT);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * Gemm8iPackedInit(size_t M, size_t N, size_t K, SimdTensorDataType dstT, SimdSynetCompatibilityType compatibility)
+        {
+            GemmPackedParam8i param(M, N, K, dstT, compatibility);
+            if (!param.Valid())
+                return NULL;
+            return new Gemm8iPackedNN(param);
+        }
+    }
+#endif//SIMD_AVX512BW_ENABLE
+}
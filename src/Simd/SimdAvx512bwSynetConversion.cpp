@@ -27,6 +27,7 @@
 #include "Simd/SimdAvx2.h"
 #include "Simd/SimdLog.h"
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -216,7 +217,7 @@ namespace Simd
                 }
             }
             else
-                assert(0);
+                Base::SynetConvert32fTo8u(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
         }
 
         //---------------------------------------------------------------------
@@ -334,7 +335,7 @@ namespace Simd
                 }
             }
             else
-                assert(0);
+                Base::SynetConvert8uTo32f(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
         }
 
         //---------------------------------------------------------------------
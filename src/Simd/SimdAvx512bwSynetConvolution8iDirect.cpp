@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetConvolution8iCommon.h"
+#include "Simd/SimdSynetInnerProduct8i.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdBase.h"
@@ -52,6 +53,14 @@ namespace Simd
             ConvParam8i param(batch, conv, compatibility);
             if (!param.Valid())
                 return NULL;
+            else if (SynetConvolution8iNchwcDepthwise::Preferable(param))
+                return new SynetConvolution8iNchwcDepthwise(param);
+            else if (SynetConvolution8iNchwcDirect::Preferable(param))
+                return new SynetConvolution8iNchwcDirect(param);
+            else if (Base::SynetConvolution8iNchwcDepthwise::Preferable(param))
+                return new Base::SynetConvolution8iNchwcDepthwise(param);
+            else if (Base::SynetConvolution8iNchwcDirect::Preferable(param))
+                return new Base::SynetConvolution8iNchwcDirect(param);
 #if defined(SIMD_INT8_DEBUG_ENABLE)
             else if (SynetConvolution8iNhwcDepthwise::Preferable(param))
                 return new SynetConvolution8iNhwcDepthwise(param);
@@ -61,6 +70,16 @@ namespace Simd
             else
                 return new Base::SynetConvolution8iGemmNN(param);
         }
+
+        //---------------------------------------------------------------------
+
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility)
+        {
+            InnerProductParam8i param(batch, input, output, transpose, srcT, dstT, activation, compatibility);
+            if (!param.Valid())
+                return NULL;
+            return new Simd::SynetInnerProduct8i(param, SynetConvolution8iInit);
+        }
     }
 #endif
 }
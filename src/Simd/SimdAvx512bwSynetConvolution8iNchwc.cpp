@@ -0,0 +1,474 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution8i.h"
+#include "Simd/SimdSynetConvolution8iCommon.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)  
+    namespace Avx512bw
+    {
+        using AlgParam = Base::SynetConvolution8iNchwcDirect::AlgParam;
+        using ConvolutionPtr = Base::SynetConvolution8iNchwcDirect::ConvolutionPtr;
+
+        //---------------------------------------------------------------------
+
+        template<Term8iType term, SimdConvolutionActivationType type, int M> void ConvolutionNchw16cDirect_2xM(const uint8_t* src0,
+            const ConvParam8i& p, const AlgParam& a, size_t dstC, const int8_t* weight0, const __m512* norm, const __m512* bias,
+            const __m512* params, const __m512* scale, const __m512* shift, uint8_t* dst0)
+        {
+            __m512i d00, d01, d10, d11, d20, d21, d30, d31, d40, d41, d50, d51, d60, d61, d70, d71, d80, d81, d90, d91, dA0, dA1, dB0, dB1, s0, w0, w1;
+            size_t CB = DivHi(p.srcC, F), dS = p.strideX * F, dY = p.dilationY * p.srcW * F, dX = p.dilationX * F, dC = p.srcH * p.srcW * F;
+            size_t dD = F * a.size, dB = p.dstH * p.dstW * dD;
+            const int8_t* weight1 = weight0 + CB * p.kernelY * p.kernelX * F * F;
+            const uint8_t* src1 = src0 + 1 * dS;
+            const uint8_t* src2 = src0 + 2 * dS;
+            const uint8_t* src3 = src0 + 3 * dS;
+            const uint8_t* src4 = src0 + 4 * dS;
+            const uint8_t* src5 = src0 + 5 * dS;
+            uint8_t* dst1 = dst0 + dB;
+            __m128i upper = _mm_set1_epi8((int8_t)a.upper);
+            if (dstC > F)
+            {
+                if (M > 0x0) d00 = _mm512_setzero_si512(), d01 = _mm512_setzero_si512();
+                if (M > 0x1) d10 = _mm512_setzero_si512(), d11 = _mm512_setzero_si512();
+                if (M > 0x2) d20 = _mm512_setzero_si512(), d21 = _mm512_setzero_si512();
+                if (M > 0x3) d30 = _mm512_setzero_si512(), d31 = _mm512_setzero_si512();
+                if (M > 0x4) d40 = _mm512_setzero_si512(), d41 = _mm512_setzero_si512();
+                if (M > 0x5) d50 = _mm512_setzero_si512(), d51 = _mm512_setzero_si512();
+                if (M > 0x6) d60 = _mm512_setzero_si512(), d61 = _mm512_setzero_si512();
+                if (M > 0x7) d70 = _mm512_setzero_si512(), d71 = _mm512_setzero_si512();
+                if (M > 0x8) d80 = _mm512_setzero_si512(), d81 = _mm512_setzero_si512();
+                if (M > 0x9) d90 = _mm512_setzero_si512(), d91 = _mm512_setzero_si512();
+                if (M > 0xA) dA0 = _mm512_setzero_si512(), dA1 = _mm512_setzero_si512();
+                if (M > 0xB) dB0 = _mm512_setzero_si512(), dB1 = _mm512_setzero_si512();
+                if (Base::Overflow(p.compatibility) || Base::Narrowed(p.compatibility))
+                {
+                    for (size_t cb = 0; cb < CB; ++cb)
+                    {
+                        for (size_t ky = 0; ky < p.kernelY; ++ky)
+                        {
+                            for (size_t kx = 0; kx < p.kernelX; ++kx)
+                            {
+                                size_t beg = cb * dC + ky * dY + kx * dX, end = beg + F;
+                                for (size_t offs0 = beg, offs6 = offs0 + 6 * dS; offs0 < end; offs0 += 4, offs6 += 4)
+                                {
+                                    w0 = _mm512_loadu_si512((__m512i*)weight0);
+                                    w1 = _mm512_loadu_si512((__m512i*)weight1);
+                                    if (M > 0x0) s0 = Set4(src0 + offs0), Madd4<true>(d00, s0, w0), Madd4<true>(d01, s0, w1);
+                                    if (M > 0x1) s0 = Set4(src1 + offs0), Madd4<true>(d10, s0, w0), Madd4<true>(d11, s0, w1);
+                                    if (M > 0x2) s0 = Set4(src2 + offs0), Madd4<true>(d20, s0, w0), Madd4<true>(d21, s0, w1);
+                                    if (M > 0x3) s0 = Set4(src3 + offs0), Madd4<true>(d30, s0, w0), Madd4<true>(d31, s0, w1);
+                                    if (M > 0x4) s0 = Set4(src4 + offs0), Madd4<true>(d40, s0, w0), Madd4<true>(d41, s0, w1);
+                                    if (M > 0x5) s0 = Set4(src5 + offs0), Madd4<true>(d50, s0, w0), Madd4<true>(d51, s0, w1);
+                                    if (M > 0x6) s0 = Set4(src0 + offs6), Madd4<true>(d60, s0, w0), Madd4<true>(d61, s0, w1);
+                                    if (M > 0x7) s0 = Set4(src1 + offs6), Madd4<true>(d70, s0, w0), Madd4<true>(d71, s0, w1);
+                                    if (M > 0x8) s0 = Set4(src2 + offs6), Madd4<true>(d80, s0, w0), Madd4<true>(d81, s0, w1);
+                                    if (M > 0x9) s0 = Set4(src3 + offs6), Madd4<true>(d90, s0, w0), Madd4<true>(d91, s0, w1);
+                                    if (M > 0xA) s0 = Set4(src4 + offs6), Madd4<true>(dA0, s0, w0), Madd4<true>(dA1, s0, w1);
+                                    if (M > 0xB) s0 = Set4(src5 + offs6), Madd4<true>(dB0, s0, w0), Madd4<true>(dB1, s0, w1);
+                                    weight0 += A, weight1 += A;
+                                }
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    for (size_t cb = 0; cb < CB; ++cb)
+                    {
+                        for (size_t ky = 0; ky < p.kernelY; ++ky)
+                        {
+                            for (size_t kx = 0; kx < p.kernelX; ++kx)
+                            {
+                                size_t beg = cb * dC + ky * dY + kx * dX, end = beg + F;
+                                for (size_t offs0 = beg, offs6 = offs0 + 6 * dS; offs0 < end; offs0 += 4, offs6 += 4)
+                                {
+                                    w0 = _mm512_loadu_si512((__m512i*)weight0);
+                                    w1 = _mm512_loadu_si512((__m512i*)weight1);
+                                    if (M > 0x0) s0 = Set4(src0 + offs0), Madd4<false>(d00, s0, w0), Madd4<false>(d01, s0, w1);
+                                    if (M > 0x1) s0 = Set4(src1 + offs0), Madd4<false>(d10, s0, w0), Madd4<false>(d11, s0, w1);
+                                    if (M > 0x2) s0 = Set4(src2 + offs0), Madd4<false>(d20, s0, w0), Madd4<false>(d21, s0, w1);
+                                    if (M > 0x3) s0 = Set4(src3 + offs0), Madd4<false>(d30, s0, w0), Madd4<false>(d31, s0, w1);
+                                    if (M > 0x4) s0 = Set4(src4 + offs0), Madd4<false>(d40, s0, w0), Madd4<false>(d41, s0, w1);
+                                    if (M > 0x5) s0 = Set4(src5 + offs0), Madd4<false>(d50, s0, w0), Madd4<false>(d51, s0, w1);
+                                    if (M > 0x6) s0 = Set4(src0 + offs6), Madd4<false>(d60, s0, w0), Madd4<false>(d61, s0, w1);
+                                    if (M > 0x7) s0 = Set4(src1 + offs6), Madd4<false>(d70, s0, w0), Madd4<false>(d71, s0, w1);
+                                    if (M > 0x8) s0 = Set4(src2 + offs6), Madd4<false>(d80, s0, w0), Madd4<false>(d81, s0, w1);
+                                    if (M > 0x9) s0 = Set4(src3 + offs6), Madd4<false>(d90, s0, w0), Madd4<false>(d91, s0, w1);
+                                    if (M > 0xA) s0 = Set4(src4 + offs6), Madd4<false>(dA0, s0, w0), Madd4<false>(dA1, s0, w1);
+                                    if (M > 0xB) s0 = Set4(src5 + offs6), Madd4<false>(dB0, s0, w0), Madd4<false>(dB1, s0, w1);
+                                    weight0 += A, weight1 += A;
+                                }
+                            }
+                        }
+                    }
+                }
+                __mmask16 tail = TailMask16(dstC - F);
+                if (Base::FmaAvoid(p.compatibility))
+                {
+                    if (M > 0x0) SaveNchw16c<term, type, 0, true>(dst0 + 0x0 * dD, d00, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, true>(dst1 + 0x0 * dD, d01, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x1) SaveNchw16c<term, type, 0, true>(dst0 + 0x1 * dD, d10, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, true>(dst1 + 0x1 * dD, d11, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x2) SaveNchw16c<term, type, 0, true>(dst0 + 0x2 * dD, d20, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, true>(dst1 + 0x2 * dD, d21, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x3) SaveNchw16c<term, type, 0, true>(dst0 + 0x3 * dD, d30, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, true>(dst1 + 0x3 * dD, d31, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x4) SaveNchw16c<term, type, 0, true>(dst0 + 0x4 * dD, d40, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, true>(dst1 + 0x4 * dD, d41, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x5) SaveNchw16c<term, type, 0, true>(dst0 + 0x5 * dD, d50, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, true>(dst1 + 0x5 * dD, d51, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x6) SaveNchw16c<term, type, 0, true>(dst0 + 0x6 * dD, d60, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, true>(dst1 + 0x6 * dD, d61, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x7) SaveNchw16c<term, type, 0, true>(dst0 + 0x7 * dD, d70, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, true>(dst1 + 0x7 * dD, d71, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x8) SaveNchw16c<term, type, 0, true>(dst0 + 0x8 * dD, d80, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, true>(dst1 + 0x8 * dD, d81, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x9) SaveNchw16c<term, type, 0, true>(dst0 + 0x9 * dD, d90, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, true>(dst1 + 0x9 * dD, d91, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0xA) SaveNchw16c<term, type, 0, true>(dst0 + 0xA * dD, dA0, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, true>(dst1 + 0xA * dD, dA1, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0xB) SaveNchw16c<term, type, 0, true>(dst0 + 0xB * dD, dB0, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, true>(dst1 + 0xB * dD, dB1, norm, bias, params, scale, shift, upper, tail);
+                }
+                else
+                {
+                    if (M > 0x0) SaveNchw16c<term, type, 0, false>(dst0 + 0x0 * dD, d00, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, false>(dst1 + 0x0 * dD, d01, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x1) SaveNchw16c<term, type, 0, false>(dst0 + 0x1 * dD, d10, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, false>(dst1 + 0x1 * dD, d11, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x2) SaveNchw16c<term, type, 0, false>(dst0 + 0x2 * dD, d20, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, false>(dst1 + 0x2 * dD, d21, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x3) SaveNchw16c<term, type, 0, false>(dst0 + 0x3 * dD, d30, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, false>(dst1 + 0x3 * dD, d31, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x4) SaveNchw16c<term, type, 0, false>(dst0 + 0x4 * dD, d40, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, false>(dst1 + 0x4 * dD, d41, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x5) SaveNchw16c<term, type, 0, false>(dst0 + 0x5 * dD, d50, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, false>(dst1 + 0x5 * dD, d51, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x6) SaveNchw16c<term, type, 0, false>(dst0 + 0x6 * dD, d60, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, false>(dst1 + 0x6 * dD, d61, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x7) SaveNchw16c<term, type, 0, false>(dst0 + 0x7 * dD, d70, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, false>(dst1 + 0x7 * dD, d71, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x8) SaveNchw16c<term, type, 0, false>(dst0 + 0x8 * dD, d80, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, false>(dst1 + 0x8 * dD, d81, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x9) SaveNchw16c<term, type, 0, false>(dst0 + 0x9 * dD, d90, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, false>(dst1 + 0x9 * dD, d91, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0xA) SaveNchw16c<term, type, 0, false>(dst0 + 0xA * dD, dA0, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, false>(dst1 + 0xA * dD, dA1, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0xB) SaveNchw16c<term, type, 0, false>(dst0 + 0xB * dD, dB0, norm, bias, params, scale, shift, upper, -1), SaveNchw16c<term, type, 1, false>(dst1 + 0xB * dD, dB1, norm, bias, params, scale, shift, upper, tail);
+                }
+            }
+            else
+            {
+                if (M > 0x0) d00 = _mm512_setzero_si512();
+                if (M > 0x1) d10 = _mm512_setzero_si512();
+                if (M > 0x2) d20 = _mm512_setzero_si512();
+                if (M > 0x3) d30 = _mm512_setzero_si512();
+                if (M > 0x4) d40 = _mm512_setzero_si512();
+                if (M > 0x5) d50 = _mm512_setzero_si512();
+                if (M > 0x6) d60 = _mm512_setzero_si512();
+                if (M > 0x7) d70 = _mm512_setzero_si512();
+                if (M > 0x8) d80 = _mm512_setzero_si512();
+                if (M > 0x9) d90 = _mm512_setzero_si512();
+                if (M > 0xA) dA0 = _mm512_setzero_si512();
+                if (M > 0xB) dB0 = _mm512_setzero_si512();
+                if (Base::Overflow(p.compatibility) || Base::Narrowed(p.compatibility))
+                {
+                    for (size_t cb = 0; cb < CB; ++cb)
+                    {
+                        for (size_t ky = 0; ky < p.kernelY; ++ky)
+                        {
+                            for (size_t kx = 0; kx < p.kernelX; ++kx)
+                            {
+                                size_t beg = cb * dC + ky * dY + kx * dX, end = beg + F;
+                                for (size_t offs0 = beg, offs6 = offs0 + 6 * dS; offs0 < end; offs0 += 4, offs6 += 4)
+                                {
+                                    w0 = _mm512_loadu_si512((__m512i*)weight0);
+                                    if (M > 0x0) s0 = Set4(src0 + offs0), Madd4<true>(d00, s0, w0);
+                                    if (M > 0x1) s0 = Set4(src1 + offs0), Madd4<true>(d10, s0, w0);
+                                    if (M > 0x2) s0 = Set4(src2 + offs0), Madd4<true>(d20, s0, w0);
+                                    if (M > 0x3) s0 = Set4(src3 + offs0), Madd4<true>(d30, s0, w0);
+                                    if (M > 0x4) s0 = Set4(src4 + offs0), Madd4<true>(d40, s0, w0);
+                                    if (M > 0x5) s0 = Set4(src5 + offs0), Madd4<true>(d50, s0, w0);
+                                    if (M > 0x6) s0 = Set4(src0 + offs6), Madd4<true>(d60, s0, w0);
+                                    if (M > 0x7) s0 = Set4(src1 + offs6), Madd4<true>(d70, s0, w0);
+                                    if (M > 0x8) s0 = Set4(src2 + offs6), Madd4<true>(d80, s0, w0);
+                                    if (M > 0x9) s0 = Set4(src3 + offs6), Madd4<true>(d90, s0, w0);
+                                    if (M > 0xA) s0 = Set4(src4 + offs6), Madd4<true>(dA0, s0, w0);
+                                    if (M > 0xB) s0 = Set4(src5 + offs6), Madd4<true>(dB0, s0, w0);
+                                    weight0 += A;
+                                }
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    for (size_t cb = 0; cb < CB; ++cb)
+                    {
+                        for (size_t ky = 0; ky < p.kernelY; ++ky)
+                        {
+                            for (size_t kx = 0; kx < p.kernelX; ++kx)
+                            {
+                                size_t beg = cb * dC + ky * dY + kx * dX, end = beg + F;
+                                for (size_t offs0 = beg, offs6 = offs0 + 6 * dS; offs0 < end; offs0 += 4, offs6 += 4)
+                                {
+                                    w0 = _mm512_loadu_si512((__m512i*)weight0);
+                                    if (M > 0x0) s0 = Set4(src0 + offs0), Madd4<false>(d00, s0, w0);
+                                    if (M > 0x1) s0 = Set4(src1 + offs0), Madd4<false>(d10, s0, w0);
+                                    if (M > 0x2) s0 = Set4(src2 + offs0), Madd4<false>(d20, s0, w0);
+                                    if (M > 0x3) s0 = Set4(src3 + offs0), Madd4<false>(d30, s0, w0);
+                                    if (M > 0x4) s0 = Set4(src4 + offs0), Madd4<false>(d40, s0, w0);
+                                    if (M > 0x5) s0 = Set4(src5 + offs0), Madd4<false>(d50, s0, w0);
+                                    if (M > 0x6) s0 = Set4(src0 + offs6), Madd4<false>(d60, s0, w0);
+                                    if (M > 0x7) s0 = Set4(src1 + offs6), Madd4<false>(d70, s0, w0);
+                                    if (M > 0x8) s0 = Set4(src2 + offs6), Madd4<false>(d80, s0, w0);
+                                    if (M > 0x9) s0 = Set4(src3 + offs6), Madd4<false>(d90, s0, w0);
+                                    if (M > 0xA) s0 = Set4(src4 + offs6), Madd4<false>(dA0, s0, w0);
+                                    if (M > 0xB) s0 = Set4(src5 + offs6), Madd4<false>(dB0, s0, w0);
+                                    weight0 += A;
+                                }
+                            }
+                        }
+                    }
+                }
+                __mmask16 tail = TailMask16(dstC);
+                if (Base::FmaAvoid(p.compatibility))
+                {
+                    if (M > 0x0) SaveNchw16c<term, type, 0, true>(dst0 + 0x0 * dD, d00, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x1) SaveNchw16c<term, type, 0, true>(dst0 + 0x1 * dD, d10, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x2) SaveNchw16c<term, type, 0, true>(dst0 + 0x2 * dD, d20, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x3) SaveNchw16c<term, type, 0, true>(dst0 + 0x3 * dD, d30, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x4) SaveNchw16c<term, type, 0, true>(dst0 + 0x4 * dD, d40, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x5) SaveNchw16c<term, type, 0, true>(dst0 + 0x5 * dD, d50, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x6) SaveNchw16c<term, type, 0, true>(dst0 + 0x6 * dD, d60, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x7) SaveNchw16c<term, type, 0, true>(dst0 + 0x7 * dD, d70, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x8) SaveNchw16c<term, type, 0, true>(dst0 + 0x8 * dD, d80, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x9) SaveNchw16c<term, type, 0, true>(dst0 + 0x9 * dD, d90, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0xA) SaveNchw16c<term, type, 0, true>(dst0 + 0xA * dD, dA0, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0xB) SaveNchw16c<term, type, 0, true>(dst0 + 0xB * dD, dB0, norm, bias, params, scale, shift, upper, tail);
+                }
+                else
+                {
+                    if (M > 0x0) SaveNchw16c<term, type, 0, false>(dst0 + 0x0 * dD, d00, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x1) SaveNchw16c<term, type, 0, false>(dst0 + 0x1 * dD, d10, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x2) SaveNchw16c<term, type, 0, false>(dst0 + 0x2 * dD, d20, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x3) SaveNchw16c<term, type, 0, false>(dst0 + 0x3 * dD, d30, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x4) SaveNchw16c<term, type, 0, false>(dst0 + 0x4 * dD, d40, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x5) SaveNchw16c<term, type, 0, false>(dst0 + 0x5 * dD, d50, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x6) SaveNchw16c<term, type, 0, false>(dst0 + 0x6 * dD, d60, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x7) SaveNchw16c<term, type, 0, false>(dst0 + 0x7 * dD, d70, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x8) SaveNchw16c<term, type, 0, false>(dst0 + 0x8 * dD, d80, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0x9) SaveNchw16c<term, type, 0, false>(dst0 + 0x9 * dD, d90, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0xA) SaveNchw16c<term, type, 0, false>(dst0 + 0xA * dD, dA0, norm, bias, params, scale, shift, upper, tail);
+                    if (M > 0xB) SaveNchw16c<term, type, 0, false>(dst0 + 0xB * dD, dB0, norm, bias, params, scale, shift, upper, tail);
+                }
+            }
+        }
+
+        typedef void(*ConvolutionNchw16cDirect_2xM_Ptr)(const uint8_t* src0, const ConvParam8i& p, const AlgParam& a, size_t dstC, const int8_t* weight0,
+            const __m512* norm, const __m512* bias, const __m512* params, const __m512* scale, const __m512* shift, uint8_t* dst0);
+
+        template<Term8iType term, SimdConvolutionActivationType type> ConvolutionNchw16cDirect_2xM_Ptr GetConvolutionNchw16cDirect_2xM(size_t M)
+        {
+            switch (M)
+            {
+            case 0x0: return NULL;
+            case 0x1: return ConvolutionNchw16cDirect_2xM<term, type, 0x1>;
+            case 0x2: return ConvolutionNchw16cDirect_2xM<term, type, 0x2>;
+            case 0x3: return ConvolutionNchw16cDirect_2xM<term, type, 0x3>;
+            case 0x4: return ConvolutionNchw16cDirect_2xM<term, type, 0x4>;
+            case 0x5: return ConvolutionNchw16cDirect_2xM<term, type, 0x5>;
+            case 0x6: return ConvolutionNchw16cDirect_2xM<term, type, 0x6>;
+            case 0x7: return ConvolutionNchw16cDirect_2xM<term, type, 0x7>;
+            case 0x8: return ConvolutionNchw16cDirect_2xM<term, type, 0x8>;
+            case 0x9: return ConvolutionNchw16cDirect_2xM<term, type, 0x9>;
+            case 0xA: return ConvolutionNchw16cDirect_2xM<term, type, 0xA>;
+            case 0xB: return ConvolutionNchw16cDirect_2xM<term, type, 0xB>;
+            case 0xC: return ConvolutionNchw16cDirect_2xM<term, type, 0xC>;
+            }
+            assert(0);
+            return NULL;
+        }
+
+        template<Term8iType term, SimdConvolutionActivationType type> void ConvolutionNchw16cDirect_2(const uint8_t* src, const ConvParam8i& p,
+            const AlgParam& a, const int8_t* weight, const float* norm, const float* bias, const float* params, const float* scale, const float* shift, uint8_t* dst)
+        {
+            size_t dstH = p.dstH, dstW = p.dstW;
+            if (p.Is1x1())
+                dstW = dstH * dstW, dstH = 1;
+            size_t n = 12, nn = AlignLoAny(dstW, n), m = dstW - nn, dS = p.strideX * F, dY = p.strideY * p.srcW * F, dD = F * a.size;
+            size_t dW = DivHi(p.srcC, F) * p.kernelY * p.kernelX * F * F;
+            ConvolutionNchw16cDirect_2xM_Ptr convolutionNchw16cDirect_2xN = GetConvolutionNchw16cDirect_2xM<term, type>(n);
+            ConvolutionNchw16cDirect_2xM_Ptr convolutionNchw16cDirect_2xM = GetConvolutionNchw16cDirect_2xM<term, type>(m);
+            __m512 _norm[2], _bias[2], _params[2], _scale[2], _shift[2];
+            _params[0] = _mm512_set1_ps(params[0]);
+            _params[1] = _mm512_set1_ps(params[1]);
+            for (size_t dc = 0; dc < p.dstC; dc += DF)
+            {
+                size_t dC = Simd::Min(DF, p.dstC - dc);
+                _norm[0] = _mm512_loadu_ps(norm + dc + 0);
+                _norm[1] = dC > F ? _mm512_loadu_ps(norm + dc + F) : _mm512_setzero_ps();
+                _bias[0] = _mm512_loadu_ps(bias + dc + 0);
+                _bias[1] = dC > F ? _mm512_loadu_ps(bias + dc + F) : _mm512_setzero_ps();
+                if (type == ::SimdConvolutionActivationPrelu)
+                {
+                    _params[0] = _mm512_loadu_ps(params + dc + 0);
+                    _params[1] = dC > F ? _mm512_loadu_ps(params + dc + F) : _mm512_setzero_ps();
+                }
+                _scale[0] = _mm512_loadu_ps(scale + dc + 0);
+                _scale[1] = dC > F ? _mm512_loadu_ps(scale + dc + F) : _mm512_setzero_ps();
+                _shift[0] = _mm512_loadu_ps(shift + dc + 0);
+                _shift[1] = dC > F ? _mm512_loadu_ps(shift + dc + F) : _mm512_setzero_ps();
+                for (size_t dy = 0; dy < dstH; ++dy)
+                {
+                    const uint8_t* s = src + dy * dY;
+                    uint8_t* d = dst + (dc * p.dstH * p.dstW + dy * dstW * F) * a.size;
+                    size_t dx = 0;
+                    for (; dx < nn; dx += n, s += n * dS, d += n * dD)
+                        convolutionNchw16cDirect_2xN(s, p, a, dC, weight, _norm, _bias, _params, _scale, _shift, d);
+                    for (; dx < dstW; dx += m, s += m * dS, d += m * dD)
+                        convolutionNchw16cDirect_2xM(s, p, a, dC, weight, _norm, _bias, _params, _scale, _shift, d);
+                }
+                weight += 2 * dW;
+            }
+        }
+
+        template<SimdConvolutionActivationType type> ConvolutionPtr GetConvolutionNchw16cDirect(const ConvParam8i& p)
+        {
+            if (p.dstT == SimdTensorData8u)
+                return ConvolutionNchw16cDirect_2<Term8iLast8u, type>;
+            else
+                return ConvolutionNchw16cDirect_2<Term8iLast32f, type>;
+        }
+
+        static ConvolutionPtr GetConvolutionNchw16cDirect(const ConvParam8i& p)
+        {
+            switch (p.activation)
+            {
+            case SimdConvolutionActivationIdentity: return GetConvolutionNchw16cDirect<SimdConvolutionActivationRestrictRange>(p);
+            case SimdConvolutionActivationRelu: return GetConvolutionNchw16cDirect<SimdConvolutionActivationRestrictRange>(p);
+            case SimdConvolutionActivationLeakyRelu: return GetConvolutionNchw16cDirect<SimdConvolutionActivationPrelu>(p);
+            case SimdConvolutionActivationRestrictRange: return GetConvolutionNchw16cDirect<SimdConvolutionActivationRestrictRange>(p);
+            case SimdConvolutionActivationPrelu: return GetConvolutionNchw16cDirect<SimdConvolutionActivationPrelu>(p);
+            case SimdConvolutionActivationElu: return GetConvolutionNchw16cDirect<SimdConvolutionActivationElu>(p);
+            case SimdConvolutionActivationHswish: return GetConvolutionNchw16cDirect<SimdConvolutionActivationHswish>(p);
+            case SimdConvolutionActivationMish: return GetConvolutionNchw16cDirect<SimdConvolutionActivationMish>(p);
+            case SimdConvolutionActivationHardSigmoid: return GetConvolutionNchw16cDirect<SimdConvolutionActivationHardSigmoid>(p);
+            default: 
+                assert(0);
+                return NULL;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<Term8iType term, SimdConvolutionActivationType type, bool nofma> void ConvolutionNchw16cDepthwise(const uint8_t* src, const ConvParam8i& p,
+            const AlgParam& a, const int8_t* weight, const float* norm, const float* bias, const float* params, const float* scale, const float* shift, uint8_t* dst)
+        {
+            size_t CB = DivHi(p.srcC, F), dC = p.srcH * p.srcW * F, dY = p.dilationY * p.srcW * F, dX = p.dilationX * F;
+            size_t sY = p.strideY * p.srcW * F, sX = p.strideX * F, dD = F * a.size;
+            __m128i upper = _mm_set1_epi8((int8_t)a.upper);
+            __m512 _norm, _bias, _params[2], _scale, _shift;
+            _params[0] = _mm512_set1_ps(params[0]);
+            _params[1] = _mm512_set1_ps(params[1]);
+            for (size_t cb = 0; cb < CB; ++cb)
+            {
+                __mmask16 tail = TailMask16(p.dstC - cb * F);
+                _norm = _mm512_loadu_ps(norm + cb * F);
+                _bias = _mm512_loadu_ps(bias + cb * F);
+                if (type == ::SimdConvolutionActivationPrelu)
+                    _params[0] = _mm512_loadu_ps(params + cb * F);
+                _scale = _mm512_loadu_ps(scale + cb * F);
+                _shift = _mm512_loadu_ps(shift + cb * F);
+                for (size_t dy = 0; dy < p.dstH; ++dy)
+                {
+                    for (size_t dx = 0; dx < p.dstW; ++dx, dst += dD)
+                    {
+                        const uint8_t* ps = src + dy * sY + dx * sX;
+                        const int8_t* pw = weight;
+                        __m512i sum = _mm512_setzero_si512();
+                        for (size_t ky = 0; ky < p.kernelY; ++ky)
+                        {
+                            for (size_t kx = 0; kx < p.kernelX; ++kx, pw += F)
+                            {
+                                __m512i s0 = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)(ps + ky * dY + kx * dX)));
+                                __m512i w0 = _mm512_cvtepi8_epi32(_mm_loadu_si128((__m128i*)pw));
+                                sum = _mm512_add_epi32(sum, _mm512_madd_epi16(s0, w0));
+                            }
+                        }
+                        SaveNchw16c<term, type, 0, nofma>(dst, sum, &_norm, &_bias, _params, &_scale, &_shift, upper, tail);
+                    }
+                }
+                src += dC;
+                weight += p.kernelY * p.kernelX * F;
+            }
+        }
+
+        template<Term8iType term, SimdConvolutionActivationType type> void ConvolutionNchw16cDepthwise(const uint8_t* src, const ConvParam8i& p,
+            const AlgParam& a, const int8_t* weight, const float* norm, const float* bias, const float* params, const float* scale, const float* shift, uint8_t* dst)
+        {
+            if (Base::FmaAvoid(p.compatibility))
+                ConvolutionNchw16cDepthwise<term, type, true>(src, p, a, weight, norm, bias, params, scale, shift, dst);
+            else
+                ConvolutionNchw16cDepthwise<term, type, false>(src, p, a, weight, norm, bias, params, scale, shift, dst);
+        }
+
+        template<SimdConvolutionActivationType type> ConvolutionPtr GetConvolutionNchw16cDepthwise(const ConvParam8i& p)
+        {
+            if (p.dstT == SimdTensorData8u)
+                return ConvolutionNchw16cDepthwise<Term8iLast8u, type>;
+            else
+                return ConvolutionNchw16cDepthwise<Term8iLast32f, type>;
+        }
+
+        static ConvolutionPtr GetConvolutionNchw16cDepthwise(const ConvParam8i& p)
+        {
+            switch (p.activation)
+            {
+            case SimdConvolutionActivationIdentity: return GetConvolutionNchw16cDepthwise<SimdConvolutionActivationRestrictRange>(p);
+            case SimdConvolutionActivationRelu: return GetConvolutionNchw16cDepthwise<SimdConvolutionActivationRestrictRange>(p);
+            case SimdConvolutionActivationLeakyRelu: return GetConvolutionNchw16cDepthwise<SimdConvolutionActivationPrelu>(p);
+            case SimdConvolutionActivationRestrictRange: return GetConvolutionNchw16cDepthwise<SimdConvolutionActivationRestrictRange>(p);
+            case SimdConvolutionActivationPrelu: return GetConvolutionNchw16cDepthwise<SimdConvolutionActivationPrelu>(p);
+            case SimdConvolutionActivationElu: return GetConvolutionNchw16cDepthwise<SimdConvolutionActivationElu>(p);
+            case SimdConvolutionActivationHswish: return GetConvolutionNchw16cDepthwise<SimdConvolutionActivationHswish>(p);
+            case SimdConvolutionActivationMish: return GetConvolutionNchw16cDepthwise<SimdConvolutionActivationMish>(p);
+            case SimdConvolutionActivationHardSigmoid: return GetConvolutionNchw16cDepthwise<SimdConvolutionActivationHardSigmoid>(p);
+            default:
+                assert(0);
+                return NULL;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetConvolution8iNchwcDirect::SynetConvolution8iNchwcDirect(const ConvParam8i& p)
+            : Base::SynetConvolution8iNchwcDirect(p)
+        {
+            _convolution = GetConvolutionNchw16cDirect(p);
+        }
+
+        bool SynetConvolution8iNchwcDirect::Preferable(const ConvParam8i& p)
+        {
+            return Base::SynetConvolution8iNchwcDirect::Preferable(p) && p.srcF == SimdTensorFormatNchw16c;
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetConvolution8iNchwcDepthwise::SynetConvolution8iNchwcDepthwise(const ConvParam8i& p)
+            : Base::SynetConvolution8iNchwcDepthwise(p)
+        {
+            _convolution = GetConvolutionNchw16cDepthwise(p);
+        }
+
+        bool SynetConvolution8iNchwcDepthwise::Preferable(const ConvParam8i& p)
+        {
+            return Base::SynetConvolution8iNchwcDepthwise::Preferable(p) && p.srcF == SimdTensorFormatNchw16c;
+        }
+    }
+#endif
+}
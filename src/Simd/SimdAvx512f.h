@@ -105,6 +105,16 @@ namespace Simd
 
         void SynetAddBias(const float * bias, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
 
+        void SynetBinaryOperation32fLayerForward(const float* a, const size_t* aShape, size_t aCount, const float* b, const size_t* bShape, size_t bCount,
+            SimdSynetBinaryOperation32fType type, float* dst);
+
+        void SynetDecodeSsd32f(const float* loc, const float* prior, const float* variance, size_t count, float* dst);
+
+        void SynetDecodeYolo32f(const float* src, size_t anchors, size_t classes, size_t height, size_t width, const float* sizes, float* boxes, float* scores);
+
+        size_t SynetDetectionOutput32f(const float* boxes, const float* scores, size_t count, size_t classes, size_t background,
+            const float* confidence, const float* overlap, size_t topK, size_t keepTopK, float* dst);
+
         void SynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
 
         void SynetElu32f(const float * src, size_t size, const float * alpha, float * dst);
@@ -123,16 +133,29 @@ namespace Simd
 
         void SynetFusedLayerForward9(const float * src0, const float * src1, const float * scale, const float * bias, size_t channels0, size_t channels1, size_t spatial, float * dst0, float * dst1, SimdTensorFormatType format);
 
+        void SynetGroupNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst);
+
         void SynetHardSigmoid32f(const float* src, size_t size, const float* scale, const float* shift, float* dst);
 
         void SynetHswish32f(const float * src, size_t size, const float * shift, const float * scale, float * dst);
 
         void SynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
 
+        void SynetL2Normalize32f(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+            SimdBool acrossSpatial, const float* eps, float* dst);
+
+        void SynetLayerNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst);
+
+        void SynetLogSoftmaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst);
+
         void SynetLrnLayerCrossChannels(const float * src, size_t half, size_t channels, size_t spatial, const float * k, float * dst, SimdTensorFormatType format);
 
         void SynetMish32f(const float* src, size_t size, const float* threshold, float* dst);
 
+        void SynetPermute32f(const float* src, const size_t* shape, const size_t* order, size_t count, float* dst);
+
         void SynetPoolingForwardAverage(const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
             size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
 
@@ -141,6 +164,9 @@ namespace Simd
 
         void SynetPreluLayerForward(const float * src, const float * slope, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
 
+        void SynetReduceLayerForward(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+            SimdSynetReduceType type, SimdBool reduceChannels, SimdBool reduceSpatial, float* dst);
+
         void SynetRelu32f(const float* src, size_t size, const float* slope, float* dst);
 
         void SynetReorderImage(size_t batch, size_t channels, size_t spatial, const float* src, SimdTensorFormatType srcFormat, float* dst, SimdTensorFormatType dstFormat);
@@ -149,12 +175,23 @@ namespace Simd
 
         void SynetRestrictRange32f(const float * src, size_t size, const float * lower, const float * upper, float * dst);
 
+        void SynetRoiAlign32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+            size_t pooledH, size_t pooledW, const float* spatialScale, size_t samplingRatio, SimdBool aligned, float* dst);
+
+        void SynetRoiPooling32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+            size_t pooledH, size_t pooledW, const float* spatialScale, float* dst);
+
         void SynetScaleLayerForward(const float* src, const float* scale, const float* bias, size_t channels, size_t height, size_t width, float* dst, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
 
+        void SynetScaledDotProductAttention32f(size_t batch, size_t queries, size_t keys, size_t depth, size_t valueDepth,
+            const float* query, const float* key, const float* value, const float* scale, float* dst);
+
         void SynetShuffleLayerForward(const float* src0, const float* src1, size_t channels0, size_t channels1, size_t spatial, float* dst0, float* dst1, SimdTensorFormatType format, int type);
 
         void SynetSigmoid32f(const float* src, size_t size, const float* slope, float* dst);
 
+        void SynetSoftmaxArgMaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst, uint32_t* index);
+
         void SynetSoftmaxLayerForward(const float * src, size_t outer, size_t size, size_t inner, float * dst);
 
         void SynetSoftplus32f(const float* src, size_t size, const float* beta, const float* threshold, float* dst);
@@ -211,6 +248,13 @@ namespace Simd
             size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
 
         void WinogradKernel3x3Block4x4SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
+
+        void WinogradKernel3x3Block6x6SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
+
+        void WinogradKernel3x3Block6x6SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
+            size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
+
+        void WinogradKernel3x3Block6x6SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
     }
 #endif// SIMD_AVX512F_ENABLE
 }
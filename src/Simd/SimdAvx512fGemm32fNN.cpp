@@ -1222,6 +1222,69 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        template<size_t M, size_t V> SIMD_INLINE void GemmSmallKernel(size_t K, float alpha, const float * A, size_t lda, const float * B, size_t ldb, float beta, float * C, size_t ldc, __mmask16 tail)
+        {
+            __m512 c[M][V], b[V];
+            for (size_t i = 0; i < M; ++i)
+                for (size_t v = 0; v < V; ++v)
+                    c[i][v] = _mm512_setzero_ps();
+            for (size_t k = 0; k < K; ++k, B += ldb)
+            {
+                for (size_t v = 0; v < V - 1; ++v)
+                    b[v] = _mm512_loadu_ps(B + v * F);
+                b[V - 1] = _mm512_maskz_loadu_ps(tail, B + (V - 1) * F);
+                for (size_t i = 0; i < M; ++i)
+                {
+                    __m512 a = _mm512_set1_ps(A[i * lda + k]);
+                    for (size_t v = 0; v < V; ++v)
+                        c[i][v] = _mm512_fmadd_ps(a, b[v], c[i][v]);
+                }
+            }
+            __m512 _alpha = _mm512_set1_ps(alpha), _beta = _mm512_set1_ps(beta);
+            for (size_t i = 0; i < M; ++i, C += ldc)
+            {
+                for (size_t v = 0; v < V - 1; ++v)
+                {
+                    __m512 dst = _mm512_mul_ps(_alpha, c[i][v]);
+                    if (beta != 0.0f)
+                        dst = _mm512_fmadd_ps(_beta, _mm512_loadu_ps(C + v * F), dst);
+                    _mm512_storeu_ps(C + v * F, dst);
+                }
+                __m512 dst = _mm512_mul_ps(_alpha, c[i][V - 1]);
+                if (beta != 0.0f)
+                    dst = _mm512_fmadd_ps(_beta, _mm512_maskz_loadu_ps(tail, C + (V - 1) * F), dst);
+                _mm512_mask_storeu_ps(C + (V - 1) * F, tail, dst);
+            }
+        }
+
+        template<size_t M> void GemmSmallRows(size_t N, size_t K, float alpha, const float * A, size_t lda, const float * B, size_t ldb, float beta, float * C, size_t ldc)
+        {
+            size_t NDF = AlignLo(N, DF), j = 0;
+            for (; j < NDF; j += DF)
+                GemmSmallKernel<M, 2>(K, alpha, A, lda, B + j, ldb, beta, C + j, ldc, __mmask16(-1));
+            if (j + F < N)
+                GemmSmallKernel<M, 2>(K, alpha, A, lda, B + j, ldb, beta, C + j, ldc, TailMask16(N - j - F));
+            else if (j < N)
+                GemmSmallKernel<M, 1>(K, alpha, A, lda, B + j, ldb, beta, C + j, ldc, TailMask16(N - j));
+        }
+
+        void GemmSmallNN(size_t M, size_t N, size_t K, float alpha, const float * A, size_t lda, const float * B, size_t ldb, float beta, float * C, size_t ldc)
+        {
+            size_t M8 = AlignLoAny(M, 8), i = 0;
+            for (; i < M8; i += 8)
+                GemmSmallRows<8>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc);
+            switch (M - i)
+            {
+            case 1: GemmSmallRows<1>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc); break;
+            case 2: GemmSmallRows<2>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc); break;
+            case 3: GemmSmallRows<3>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc); break;
+            case 4: GemmSmallRows<4>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc); break;
+            case 5: GemmSmallRows<5>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc); break;
+            case 6: GemmSmallRows<6>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc); break;
+            case 7: GemmSmallRows<7>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc); break;
+            }
+        }
+
         void Gemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
         {
             SIMD_PERF_BEGF(Simd::ToStr(M) + "-" + Simd::ToStr(N) + "-" + Simd::ToStr(K), M*N*K * 2);
@@ -1235,6 +1298,11 @@ namespace Simd
                 Avx2::Gemm32fNN(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
                 return;
             }
+            if (GemmSmall(M, N, K))
+            {
+                GemmSmallNN(M, N, K, *alpha, A, lda, B, ldb, *beta, C, ldc);
+                return;
+            }
 #if SIMD_ZMM_COUNT == 32 
             if (N < K || M * 8 < N)
             {
@@ -1318,7 +1386,7 @@ namespace Simd
 
         typedef Simd::GemmNNcb<float, F, __mmask16> Gemm32fNNcb;
 
-        SIMD_INLINE Gemm32fNNcb CreateGemm32fNNcb(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility)
+        SIMD_INLINE Gemm32fNNcb CreateGemm32fNNcb(size_t M, size_t N, size_t K, GemmKernelType & type, bool compatibility)
         {
             Gemm32fNNcb::Main kernelMM, kernelMT;
             Gemm32fNNcb::Tail kernelTM, kernelTT;
@@ -1488,6 +1556,28 @@ namespace Simd
             else
                 Avx2::Gemm32fNNcbRun(M, N, K, A, pB, C, type, compatibility);
         }
+
+        void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, size_t lda, const float * pB, float * C, size_t ldc, const GemmPost<float> & post, GemmKernelType type, bool compatibility)
+        {
+            if (N > Avx::F)
+            {
+                Gemm32fNNcb gemm = CreateGemm32fNNcb(M, N, K, type, compatibility);
+                gemm.Run(M, A, lda, pB, C, ldc, post);
+            }
+            else
+                Avx2::Gemm32fNNcbRun(M, N, K, A, lda, pB, C, ldc, post, type, compatibility);
+        }
+
+        GemmKernelType Gemm32fNNcbKernelType(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility)
+        {
+            if (N > Avx::F)
+            {
+                CreateGemm32fNNcb(M, N, K, type, compatibility);
+                return type;
+            }
+            else
+                return Avx2::Gemm32fNNcbKernelType(M, N, K, type, compatibility);
+        }
     }
 #endif// SIMD_AVX512F_ENABLE
 }
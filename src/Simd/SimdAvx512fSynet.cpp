@@ -33,6 +33,7 @@
 #include "Simd/SimdAvx2.h"
 #include "Simd/SimdAvx512f.h"
 #include "Simd/SimdArray.h"
+#include "Simd/SimdCpu.h"
 
 namespace Simd
 {
@@ -778,69 +779,426 @@ namespace Simd
             }
         }
 
-        void SynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst)
+        SIMD_INLINE float SynetSoftmaxMax(const float* src, size_t size)
         {
-            if (count == 2 && inner == 1)
-                SynetSoftmaxLayerForward21(src, outer, dst);
-            else if (count == 3 && inner == 1)
-                SynetSoftmaxLayerForward31(src, outer, dst);
+            size_t sizeF = AlignLo(size, F), sizeQF = AlignLo(size, QF), i = 0;
+            __m512 max0 = _mm512_set1_ps(-FLT_MAX), max1 = max0, max2 = max0, max3 = max0;
+            for (; i < sizeQF; i += QF)
+            {
+                max0 = _mm512_max_ps(max0, _mm512_loadu_ps(src + i + 0 * F));
+                max1 = _mm512_max_ps(max1, _mm512_loadu_ps(src + i + 1 * F));
+                max2 = _mm512_max_ps(max2, _mm512_loadu_ps(src + i + 2 * F));
+                max3 = _mm512_max_ps(max3, _mm512_loadu_ps(src + i + 3 * F));
+            }
+            for (; i < sizeF; i += F)
+                max0 = _mm512_max_ps(max0, _mm512_loadu_ps(src + i));
+            if (i < size)
+                max1 = _mm512_max_ps(max1, _mm512_mask_loadu_ps(max1, TailMask16(size - i), src + i));
+            max0 = _mm512_max_ps(_mm512_max_ps(max0, max1), _mm512_max_ps(max2, max3));
+            __m128 _max = _mm_max_ps(_mm_max_ps(_mm512_extractf32x4_ps(max0, 0), _mm512_extractf32x4_ps(max0, 1)),
+                _mm_max_ps(_mm512_extractf32x4_ps(max0, 2), _mm512_extractf32x4_ps(max0, 3)));
+            _max = _mm_max_ps(_max, _mm_movehl_ps(_max, _max));
+            _max = _mm_max_ss(_max, _mm_shuffle_ps(_max, _max, 1));
+            return _mm_cvtss_f32(_max);
+        }
+
+        template<bool store> SIMD_INLINE float SynetSoftmaxExpSum(const Exp& exp, const float* src, size_t size, float max, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), sizeDF = AlignLo(size, DF), i = 0;
+            __m512 _max = _mm512_set1_ps(max), sum0 = _mm512_setzero_ps(), sum1 = _mm512_setzero_ps();
+            for (; i < sizeDF; i += DF)
+            {
+                __m512 exp0 = exp.Exponent(_mm512_sub_ps(_mm512_loadu_ps(src + i + 0), _max));
+                __m512 exp1 = exp.Exponent(_mm512_sub_ps(_mm512_loadu_ps(src + i + F), _max));
+                if (store)
+                {
+                    _mm512_storeu_ps(dst + i + 0, exp0);
+                    _mm512_storeu_ps(dst + i + F, exp1);
+                }
+                sum0 = _mm512_add_ps(sum0, exp0);
+                sum1 = _mm512_add_ps(sum1, exp1);
+            }
+            for (; i < sizeF; i += F)
+            {
+                __m512 exp0 = exp.Exponent(_mm512_sub_ps(_mm512_loadu_ps(src + i), _max));
+                if (store)
+                    _mm512_storeu_ps(dst + i, exp0);
+                sum0 = _mm512_add_ps(sum0, exp0);
+            }
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                __m512 exp0 = exp.Exponent(_mm512_sub_ps(_mm512_maskz_loadu_ps(tail, src + i), _max));
+                if (store)
+                    _mm512_mask_storeu_ps(dst + i, tail, exp0);
+                sum1 = _mm512_mask_add_ps(sum1, tail, sum1, exp0);
+            }
+            return ExtractSum(_mm512_add_ps(sum0, sum1));
+        }
+
+        SIMD_INLINE uint32_t SynetSoftmaxArgMax(const float* src, size_t size)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __mmask16 tail = TailMask16(size - sizeF);
+            __m512 max = _mm512_set1_ps(src[0]);
+            __m512i idx = _mm512_setzero_si512(), cur = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), step = _mm512_set1_epi32(F);
+            for (; i < sizeF; i += F, cur = _mm512_add_epi32(cur, step))
+            {
+                __mmask16 greater = _mm512_cmp_ps_mask(_mm512_loadu_ps(src + i), max, _CMP_GT_OQ);
+                max = _mm512_mask_loadu_ps(max, greater, src + i);
+                idx = _mm512_mask_mov_epi32(idx, greater, cur);
+            }
+            if (i < size)
+            {
+                __mmask16 greater = _mm512_mask_cmp_ps_mask(tail, _mm512_maskz_loadu_ps(tail, src + i), max, _CMP_GT_OQ);
+                max = _mm512_mask_loadu_ps(max, greater, src + i);
+                idx = _mm512_mask_mov_epi32(idx, greater, cur);
+            }
+            float maxs[F];
+            uint32_t idxs[F];
+            _mm512_storeu_ps(maxs, max);
+            _mm512_storeu_si512(idxs, idx);
+            float value = src[0];
+            uint32_t index = 0;
+            for (size_t j = 0; j < F; ++j)
+            {
+                if (maxs[j] > value || (maxs[j] == value && idxs[j] < index))
+                {
+                    value = maxs[j];
+                    index = idxs[j];
+                }
+            }
+            return index;
+        }
+
+        template<bool log> void SynetSoftmax1(const Exp& exp, const float* src, size_t count, float* dst, uint32_t* index)
+        {
+            size_t countF = AlignLo(count, F), c = 0;
+            __mmask16 tail = TailMask16(count - countF);
+            float max = SynetSoftmaxMax(src, count);
+            if (index)
+                index[0] = SynetSoftmaxArgMax(src, count);
+            if (dst == NULL)
+                return;
+            if (log)
+            {
+                float sum = SynetSoftmaxExpSum<false>(exp, src, count, max, NULL);
+                __m512 _shift = _mm512_set1_ps(max + ::log(sum));
+                for (c = 0; c < countF; c += F)
+                    _mm512_storeu_ps(dst + c, _mm512_sub_ps(_mm512_loadu_ps(src + c), _shift));
+                if (c < count)
+                    _mm512_mask_storeu_ps(dst + c, tail, _mm512_sub_ps(_mm512_maskz_loadu_ps(tail, src + c), _shift));
+            }
             else
             {
-                Avx512f::Exp exp;
-                size_t aligned = Simd::AlignLo(inner, F);
-                __mmask16 tail = TailMask16(inner - aligned);
-                Array32f tmp(inner * 2);
-                const float * s;
-                float * max = tmp.data, *sum = tmp.data + inner, *d;
-                for (size_t o = 0; o < outer; ++o)
+                float sum = SynetSoftmaxExpSum<true>(exp, src, count, max, dst);
+                __m512 _scale = _mm512_set1_ps(1.0f / sum);
+                for (c = 0; c < countF; c += F)
+                    _mm512_storeu_ps(dst + c, _mm512_mul_ps(_mm512_loadu_ps(dst + c), _scale));
+                if (c < count)
+                    _mm512_mask_storeu_ps(dst + c, tail, _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, dst + c), _scale));
+            }
+        }
+
+        template<bool log> void SynetSoftmaxN(const Exp& exp, const float* src, size_t count, size_t inner, size_t size, float* max, float* sum, float* idx, float* dst, uint32_t* index)
+        {
+            size_t sizeF = AlignLo(size, F), i;
+            __mmask16 tail = TailMask16(size - sizeF);
+            const float* s = src + inner;
+            memcpy(max, src, size * sizeof(float));
+            if (index)
+            {
+                memset(idx, 0, size * sizeof(float));
+                for (size_t c = 1; c < count; ++c, s += inner)
                 {
-                    memcpy(max, src, inner * sizeof(float));
-                    s = src + inner;
-                    for (size_t c = 1; c < count; ++c)
+                    __m512 _c = _mm512_set1_ps(float(c));
+                    for (i = 0; i < sizeF; i += F)
+                    {
+                        __m512 _src = _mm512_loadu_ps(s + i), _max = _mm512_loadu_ps(max + i);
+                        __mmask16 greater = _mm512_cmp_ps_mask(_src, _max, _CMP_GT_OQ);
+                        _mm512_storeu_ps(max + i, _mm512_max_ps(_src, _max));
+                        _mm512_mask_storeu_ps(idx + i, greater, _c);
+                    }
+                    if (i < size)
                     {
-                        size_t i = 0;
-                        for (; i < aligned; i += F)
-                            _mm512_storeu_ps(max + i, _mm512_max_ps(_mm512_loadu_ps(s + i), _mm512_loadu_ps(max + i)));
-                        if(i < inner)
-                            _mm512_mask_storeu_ps(max + i, tail, _mm512_max_ps(_mm512_maskz_loadu_ps(tail, s + i), _mm512_maskz_loadu_ps(tail, max + i)));
-                        s += inner;
+                        __m512 _src = _mm512_maskz_loadu_ps(tail, s + i), _max = _mm512_maskz_loadu_ps(tail, max + i);
+                        __mmask16 greater = _mm512_mask_cmp_ps_mask(tail, _src, _max, _CMP_GT_OQ);
+                        _mm512_mask_storeu_ps(max + i, tail, _mm512_max_ps(_src, _max));
+                        _mm512_mask_storeu_ps(idx + i, greater, _c);
                     }
+                }
+                for (i = 0; i < sizeF; i += F)
+                    _mm512_storeu_si512((__m512i*)(index + i), _mm512_cvttps_epi32(_mm512_loadu_ps(idx + i)));
+                if (i < size)
+                    _mm512_mask_storeu_epi32(index + i, tail, _mm512_cvttps_epi32(_mm512_maskz_loadu_ps(tail, idx + i)));
+            }
+            else
+            {
+                for (size_t c = 1; c < count; ++c, s += inner)
+                {
+                    for (i = 0; i < sizeF; i += F)
+                        _mm512_storeu_ps(max + i, _mm512_max_ps(_mm512_loadu_ps(s + i), _mm512_loadu_ps(max + i)));
+                    if (i < size)
+                        _mm512_mask_storeu_ps(max + i, tail, _mm512_max_ps(_mm512_maskz_loadu_ps(tail, s + i), _mm512_maskz_loadu_ps(tail, max + i)));
+                }
+            }
+            if (dst == NULL)
+                return;
+            memset(sum, 0, size * sizeof(float));
+            s = src;
+            float* d = dst;
+            for (size_t c = 0; c < count; ++c, s += inner, d += inner)
+            {
+                for (i = 0; i < sizeF; i += F)
+                {
+                    __m512 _exp = exp.Exponent(_mm512_sub_ps(_mm512_loadu_ps(s + i), _mm512_loadu_ps(max + i)));
+                    if (!log)
+                        _mm512_storeu_ps(d + i, _exp);
+                    _mm512_storeu_ps(sum + i, _mm512_add_ps(_exp, _mm512_loadu_ps(sum + i)));
+                }
+                if (i < size)
+                {
+                    __m512 _exp = exp.Exponent(_mm512_sub_ps(_mm512_maskz_loadu_ps(tail, s + i), _mm512_maskz_loadu_ps(tail, max + i)));
+                    if (!log)
+                        _mm512_mask_storeu_ps(d + i, tail, _exp);
+                    _mm512_mask_storeu_ps(sum + i, tail, _mm512_add_ps(_exp, _mm512_maskz_loadu_ps(tail, sum + i)));
+                }
+            }
+            if (log)
+            {
+                for (i = 0; i < size; ++i)
+                    sum[i] = max[i] + ::log(sum[i]);
+                s = src;
+                d = dst;
+                for (size_t c = 0; c < count; ++c, s += inner, d += inner)
+                {
+                    for (i = 0; i < sizeF; i += F)
+                        _mm512_storeu_ps(d + i, _mm512_sub_ps(_mm512_loadu_ps(s + i), _mm512_loadu_ps(sum + i)));
+                    if (i < size)
+                        _mm512_mask_storeu_ps(d + i, tail, _mm512_sub_ps(_mm512_maskz_loadu_ps(tail, s + i), _mm512_maskz_loadu_ps(tail, sum + i)));
+                }
+            }
+            else
+            {
+                for (i = 0; i < size; ++i)
+                    sum[i] = 1.0f / sum[i];
+                d = dst;
+                for (size_t c = 0; c < count; ++c, d += inner)
+                {
+                    for (i = 0; i < sizeF; i += F)
+                        _mm512_storeu_ps(d + i, _mm512_mul_ps(_mm512_loadu_ps(d + i), _mm512_loadu_ps(sum + i)));
+                    if (i < size)
+                        _mm512_mask_storeu_ps(d + i, tail, _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, d + i), _mm512_maskz_loadu_ps(tail, sum + i)));
+                }
+            }
+        }
 
-                    s = src;
-                    d = dst;
-                    memset(sum, 0, inner * sizeof(float));
-                    for (size_t c = 0; c < count; ++c)
+        template<bool log> void SynetSoftmax(const float* src, size_t outer, size_t count, size_t inner, float* dst, uint32_t* index)
+        {
+            Exp exp;
+            if (inner == 1)
+            {
+                for (size_t o = 0; o < outer; ++o)
+                    SynetSoftmax1<log>(exp, src + o * count, count, dst ? dst + o * count : NULL, index ? index + o : NULL);
+            }
+            else
+            {
+                size_t block = Simd::RestrictRange(AlignLo(Base::AlgCacheL2() / 2 / count / sizeof(float), F), F, AlignHi(inner, F));
+                Array32f buf(block * 3);
+                for (size_t o = 0; o < outer; ++o)
+                {
+                    size_t offset = o * count * inner;
+                    for (size_t i = 0; i < inner; i += block)
                     {
-                        size_t i = 0;
-                        for (; i < aligned; i += F)
-                        {
-                            __m512 _d = exp.Exponent(_mm512_sub_ps(_mm512_loadu_ps(s + i), _mm512_loadu_ps(max + i)));
-                            _mm512_storeu_ps(d + i, _d);
-                            _mm512_storeu_ps(sum + i, _mm512_add_ps(_d, _mm512_loadu_ps(sum + i)));
-                        }
-                        if(i < inner)
-                        {
-                            __m512 _d = exp.Exponent(_mm512_sub_ps(_mm512_maskz_loadu_ps(tail, s + i), _mm512_maskz_loadu_ps(tail, max + i)));
-                            _mm512_mask_storeu_ps(d + i, tail, _d);
-                            _mm512_mask_storeu_ps(sum + i, tail, _mm512_add_ps(_d, _mm512_maskz_loadu_ps(tail, sum + i)));
-                        }
-                        s += inner;
-                        d += inner;
+                        size_t size = Simd::Min(block, inner - i);
+                        SynetSoftmaxN<log>(exp, src + offset + i, count, inner, size, buf.data, buf.data + block, buf.data + 2 * block,
+                            dst ? dst + offset + i : NULL, index ? index + o * inner + i : NULL);
                     }
+                }
+            }
+        }
+
+        void SynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst)
+        {
+            if (count == 2 && inner == 1)
+                SynetSoftmaxLayerForward21(src, outer, dst);
+            else if (count == 3 && inner == 1)
+                SynetSoftmaxLayerForward31(src, outer, dst);
+            else
+                SynetSoftmax<false>(src, outer, count, inner, dst, NULL);
+        }
+
+        void SynetLogSoftmaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst)
+        {
+            SynetSoftmax<true>(src, outer, count, inner, dst, NULL);
+        }
+
+        void SynetSoftmaxArgMaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst, uint32_t* index)
+        {
+            SynetSoftmax<false>(src, outer, count, inner, dst, index);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void AttentionDot4(const float* q, const float* k, size_t depth, float scale, float* dst)
+        {
+            size_t depthF = AlignLo(depth, F), i = 0;
+            const float* k0 = k + 0 * depth, * k1 = k + 1 * depth, * k2 = k + 2 * depth, * k3 = k + 3 * depth;
+            __m512 d0 = _mm512_setzero_ps(), d1 = _mm512_setzero_ps(), d2 = _mm512_setzero_ps(), d3 = _mm512_setzero_ps();
+            for (; i < depthF; i += F)
+            {
+                __m512 _q = _mm512_loadu_ps(q + i);
+                d0 = _mm512_fmadd_ps(_q, _mm512_loadu_ps(k0 + i), d0);
+                d1 = _mm512_fmadd_ps(_q, _mm512_loadu_ps(k1 + i), d1);
+                d2 = _mm512_fmadd_ps(_q, _mm512_loadu_ps(k2 + i), d2);
+                d3 = _mm512_fmadd_ps(_q, _mm512_loadu_ps(k3 + i), d3);
+            }
+            if (i < depth)
+            {
+                __mmask16 tail = TailMask16(depth - depthF);
+                __m512 _q = _mm512_maskz_loadu_ps(tail, q + i);
+                d0 = _mm512_fmadd_ps(_q, _mm512_maskz_loadu_ps(tail, k0 + i), d0);
+                d1 = _mm512_fmadd_ps(_q, _mm512_maskz_loadu_ps(tail, k1 + i), d1);
+                d2 = _mm512_fmadd_ps(_q, _mm512_maskz_loadu_ps(tail, k2 + i), d2);
+                d3 = _mm512_fmadd_ps(_q, _mm512_maskz_loadu_ps(tail, k3 + i), d3);
+            }
+            _mm_storeu_ps(dst, _mm_mul_ps(Extract4Sums(d0, d1, d2, d3), _mm_set1_ps(scale)));
+        }
+
+        SIMD_INLINE float AttentionDot1(const float* q, const float* k, size_t depth, float scale)
+        {
+            size_t depthF = AlignLo(depth, F), i = 0;
+            __m512 d0 = _mm512_setzero_ps();
+            for (; i < depthF; i += F)
+                d0 = _mm512_fmadd_ps(_mm512_loadu_ps(q + i), _mm512_loadu_ps(k + i), d0);
+            if (i < depth)
+            {
+                __mmask16 tail = TailMask16(depth - depthF);
+                d0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tail, q + i), _mm512_maskz_loadu_ps(tail, k + i), d0);
+            }
+            return ExtractSum(d0) * scale;
+        }
+
+        SIMD_INLINE float AttentionExp(const Avx512f::Exp& exp, float* score, size_t size, float max)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m512 _max = _mm512_set1_ps(max), _sum = _mm512_setzero_ps();
+            for (; i < sizeF; i += F)
+            {
+                __m512 p = exp.Exponent(_mm512_sub_ps(_mm512_loadu_ps(score + i), _max));
+                _mm512_storeu_ps(score + i, p);
+                _sum = _mm512_add_ps(_sum, p);
+            }
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - sizeF);
+                __m512 p = _mm512_maskz_mov_ps(tail, exp.Exponent(_mm512_sub_ps(_mm512_maskz_loadu_ps(tail, score + i), _max)));
+                _mm512_mask_storeu_ps(score + i, tail, p);
+                _sum = _mm512_add_ps(_sum, p);
+            }
+            return ExtractSum(_sum);
+        }
+
+        SIMD_INLINE void AttentionRescale(float* sum, size_t size, float corr)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m512 _corr = _mm512_set1_ps(corr);
+            for (; i < sizeF; i += F)
+                _mm512_storeu_ps(sum + i, _mm512_mul_ps(_mm512_loadu_ps(sum + i), _corr));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - sizeF);
+                _mm512_mask_storeu_ps(sum + i, tail, _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, sum + i), _corr));
+            }
+        }
 
-                    d = dst;
-                    for (size_t c = 0; c < count; ++c)
+        SIMD_INLINE void AttentionAccumulate4(const float* value, size_t size, const float* p, float* sum)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            const float* v0 = value + 0 * size, * v1 = value + 1 * size, * v2 = value + 2 * size, * v3 = value + 3 * size;
+            __m512 p0 = _mm512_set1_ps(p[0]), p1 = _mm512_set1_ps(p[1]), p2 = _mm512_set1_ps(p[2]), p3 = _mm512_set1_ps(p[3]);
+            for (; i < sizeF; i += F)
+            {
+                __m512 s = _mm512_loadu_ps(sum + i);
+                s = _mm512_fmadd_ps(p0, _mm512_loadu_ps(v0 + i), s);
+                s = _mm512_fmadd_ps(p1, _mm512_loadu_ps(v1 + i), s);
+                s = _mm512_fmadd_ps(p2, _mm512_loadu_ps(v2 + i), s);
+                s = _mm512_fmadd_ps(p3, _mm512_loadu_ps(v3 + i), s);
+                _mm512_storeu_ps(sum + i, s);
+            }
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - sizeF);
+                __m512 s = _mm512_maskz_loadu_ps(tail, sum + i);
+                s = _mm512_fmadd_ps(p0, _mm512_maskz_loadu_ps(tail, v0 + i), s);
+                s = _mm512_fmadd_ps(p1, _mm512_maskz_loadu_ps(tail, v1 + i), s);
+                s = _mm512_fmadd_ps(p2, _mm512_maskz_loadu_ps(tail, v2 + i), s);
+                s = _mm512_fmadd_ps(p3, _mm512_maskz_loadu_ps(tail, v3 + i), s);
+                _mm512_mask_storeu_ps(sum + i, tail, s);
+            }
+        }
+
+        SIMD_INLINE void AttentionAccumulate1(const float* value, size_t size, float p, float* sum)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m512 _p = _mm512_set1_ps(p);
+            for (; i < sizeF; i += F)
+                _mm512_storeu_ps(sum + i, _mm512_fmadd_ps(_p, _mm512_loadu_ps(value + i), _mm512_loadu_ps(sum + i)));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - sizeF);
+                _mm512_mask_storeu_ps(sum + i, tail, _mm512_fmadd_ps(_p, _mm512_maskz_loadu_ps(tail, value + i), _mm512_maskz_loadu_ps(tail, sum + i)));
+            }
+        }
+
+        void SynetScaledDotProductAttention32f(size_t batch, size_t queries, size_t keys, size_t depth, size_t valueDepth,
+            const float* query, const float* key, const float* value, const float* scale, float* dst)
+        {
+            if (keys == 0)
+            {
+                memset(dst, 0, batch * queries * valueDepth * sizeof(float));
+                return;
+            }
+            float _scale = Base::AttentionScale(depth, scale);
+            Avx512f::Exp exp;
+            Array32f buf(Base::ATTENTION_KEY_BLOCK + valueDepth);
+            float* score = buf.data, * sum = buf.data + Base::ATTENTION_KEY_BLOCK;
+            for (size_t b = 0; b < batch; ++b)
+            {
+                for (size_t q = 0; q < queries; ++q)
+                {
+                    const float* pq = query + q * depth;
+                    float max = -FLT_MAX, norm = 0.0f;
+                    memset(sum, 0, valueDepth * sizeof(float));
+                    for (size_t k0 = 0; k0 < keys; k0 += Base::ATTENTION_KEY_BLOCK)
                     {
-                        size_t i = 0;
-                        for (; i < aligned; i += F)
-                            _mm512_storeu_ps(d + i, _mm512_div_ps(_mm512_loadu_ps(d + i), _mm512_loadu_ps(sum + i)));
-                        if(i < inner)
-                            _mm512_mask_storeu_ps(d + i, tail, _mm512_div_ps(_mm512_maskz_loadu_ps(tail, d + i), _mm512_maskz_loadu_ps(tail, sum + i)));
-                        d += inner;
+                        size_t kn = Simd::Min(keys, k0 + Base::ATTENTION_KEY_BLOCK) - k0, kn4 = AlignLo(kn, 4), k = 0;
+                        const float* pk = key + k0 * depth;
+                        for (; k < kn4; k += 4)
+                            AttentionDot4(pq, pk + k * depth, depth, _scale, score + k);
+                        for (; k < kn; ++k)
+                            score[k] = AttentionDot1(pq, pk + k * depth, depth, _scale);
+                        float blockMax = max;
+                        for (k = 0; k < kn; ++k)
+                            blockMax = Simd::Max(blockMax, score[k]);
+                        float corr = ::exp(max - blockMax);
+                        norm = norm * corr + AttentionExp(exp, score, kn, blockMax);
+                        if (corr != 1.0f)
+                            AttentionRescale(sum, valueDepth, corr);
+                        max = blockMax;
+                        const float* pv = value + k0 * valueDepth;
+                        for (k = 0; k < kn4; k += 4)
+                            AttentionAccumulate4(pv + k * valueDepth, valueDepth, score + k, sum);
+                        for (; k < kn; ++k)
+                            AttentionAccumulate1(pv + k * valueDepth, valueDepth, score[k], sum);
                     }
-                    src += count * inner;
-                    dst += count * inner;
+                    AttentionRescale(sum, valueDepth, 1.0f / norm);
+                    memcpy(dst + q * valueDepth, sum, valueDepth * sizeof(float));
                 }
+                query += queries * depth;
+                key += keys * depth;
+                value += keys * valueDepth;
+                dst += queries * valueDepth;
             }
         }
 
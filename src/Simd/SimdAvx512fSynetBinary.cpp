@@ -0,0 +1,157 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdAvx512f.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512F_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Avx512f
+    {
+        template<SimdSynetBinaryOperation32fType type> __m512 SynetBinaryOperation32f(__m512 a, __m512 b);
+
+        template<> SIMD_INLINE __m512 SynetBinaryOperation32f<SimdSynetBinaryOperation32fAdd>(__m512 a, __m512 b)
+        {
+            return _mm512_add_ps(a, b);
+        }
+
+        template<> SIMD_INLINE __m512 SynetBinaryOperation32f<SimdSynetBinaryOperation32fDiv>(__m512 a, __m512 b)
+        {
+            return _mm512_div_ps(a, b);
+        }
+
+        template<> SIMD_INLINE __m512 SynetBinaryOperation32f<SimdSynetBinaryOperation32fMax>(__m512 a, __m512 b)
+        {
+            return _mm512_max_ps(a, b);
+        }
+
+        template<> SIMD_INLINE __m512 SynetBinaryOperation32f<SimdSynetBinaryOperation32fMin>(__m512 a, __m512 b)
+        {
+            return _mm512_min_ps(a, b);
+        }
+
+        template<> SIMD_INLINE __m512 SynetBinaryOperation32f<SimdSynetBinaryOperation32fMul>(__m512 a, __m512 b)
+        {
+            return _mm512_mul_ps(a, b);
+        }
+
+        template<> SIMD_INLINE __m512 SynetBinaryOperation32f<SimdSynetBinaryOperation32fPow>(__m512 a, __m512 b)
+        {
+            return Pow()(a, b);
+        }
+
+        template<> SIMD_INLINE __m512 SynetBinaryOperation32f<SimdSynetBinaryOperation32fSub>(__m512 a, __m512 b)
+        {
+            return _mm512_sub_ps(a, b);
+        }
+
+        //---------------------------------------------------------------------
+
+        template<SimdSynetBinaryOperation32fType type> void SynetBinaryOperation32fVV(const float* a, const float* b, size_t size, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), sizeQF = AlignLo(size, QF), i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                Store<false>(dst + i + 0 * F, SynetBinaryOperation32f<type>(Load<false>(a + i + 0 * F), Load<false>(b + i + 0 * F)));
+                Store<false>(dst + i + 1 * F, SynetBinaryOperation32f<type>(Load<false>(a + i + 1 * F), Load<false>(b + i + 1 * F)));
+                Store<false>(dst + i + 2 * F, SynetBinaryOperation32f<type>(Load<false>(a + i + 2 * F), Load<false>(b + i + 2 * F)));
+                Store<false>(dst + i + 3 * F, SynetBinaryOperation32f<type>(Load<false>(a + i + 3 * F), Load<false>(b + i + 3 * F)));
+            }
+            for (; i < sizeF; i += F)
+                Store<false>(dst + i, SynetBinaryOperation32f<type>(Load<false>(a + i), Load<false>(b + i)));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                Store<false, true>(dst + i, SynetBinaryOperation32f<type>(Load<false, true>(a + i, tail), Load<false, true>(b + i, tail)), tail);
+            }
+        }
+
+        template<SimdSynetBinaryOperation32fType type> void SynetBinaryOperation32fVS(const float* a, const float* b, size_t size, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), sizeQF = AlignLo(size, QF), i = 0;
+            __m512 _b = _mm512_set1_ps(b[0]);
+            for (; i < sizeQF; i += QF)
+            {
+                Store<false>(dst + i + 0 * F, SynetBinaryOperation32f<type>(Load<false>(a + i + 0 * F), _b));
+                Store<false>(dst + i + 1 * F, SynetBinaryOperation32f<type>(Load<false>(a + i + 1 * F), _b));
+                Store<false>(dst + i + 2 * F, SynetBinaryOperation32f<type>(Load<false>(a + i + 2 * F), _b));
+                Store<false>(dst + i + 3 * F, SynetBinaryOperation32f<type>(Load<false>(a + i + 3 * F), _b));
+            }
+            for (; i < sizeF; i += F)
+                Store<false>(dst + i, SynetBinaryOperation32f<type>(Load<false>(a + i), _b));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                Store<false, true>(dst + i, SynetBinaryOperation32f<type>(Load<false, true>(a + i, tail), _b), tail);
+            }
+        }
+
+        template<SimdSynetBinaryOperation32fType type> void SynetBinaryOperation32fSV(const float* a, const float* b, size_t size, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), sizeQF = AlignLo(size, QF), i = 0;
+            __m512 _a = _mm512_set1_ps(a[0]);
+            for (; i < sizeQF; i += QF)
+            {
+                Store<false>(dst + i + 0 * F, SynetBinaryOperation32f<type>(_a, Load<false>(b + i + 0 * F)));
+                Store<false>(dst + i + 1 * F, SynetBinaryOperation32f<type>(_a, Load<false>(b + i + 1 * F)));
+                Store<false>(dst + i + 2 * F, SynetBinaryOperation32f<type>(_a, Load<false>(b + i + 2 * F)));
+                Store<false>(dst + i + 3 * F, SynetBinaryOperation32f<type>(_a, Load<false>(b + i + 3 * F)));
+            }
+            for (; i < sizeF; i += F)
+                Store<false>(dst + i, SynetBinaryOperation32f<type>(_a, Load<false>(b + i)));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                Store<false, true>(dst + i, SynetBinaryOperation32f<type>(_a, Load<false, true>(b + i, tail)), tail);
+            }
+        }
+
+        template<SimdSynetBinaryOperation32fType type> void SynetBinaryOperation32fLayerForward(const float* a, const size_t* aShape, size_t aCount,
+            const float* b, const size_t* bShape, size_t bCount, float* dst)
+        {
+            Base::SynetBinaryOperation32fLayerForward(a, aShape, aCount, b, bShape, bCount, dst,
+                SynetBinaryOperation32fVV<type>, SynetBinaryOperation32fVS<type>, SynetBinaryOperation32fSV<type>);
+        }
+
+        void SynetBinaryOperation32fLayerForward(const float* a, const size_t* aShape, size_t aCount, const float* b, const size_t* bShape, size_t bCount,
+            SimdSynetBinaryOperation32fType type, float* dst)
+        {
+            switch (type)
+            {
+            case SimdSynetBinaryOperation32fAdd: SynetBinaryOperation32fLayerForward<SimdSynetBinaryOperation32fAdd>(a, aShape, aCount, b, bShape, bCount, dst); break;
+            case SimdSynetBinaryOperation32fDiv: SynetBinaryOperation32fLayerForward<SimdSynetBinaryOperation32fDiv>(a, aShape, aCount, b, bShape, bCount, dst); break;
+            case SimdSynetBinaryOperation32fMax: SynetBinaryOperation32fLayerForward<SimdSynetBinaryOperation32fMax>(a, aShape, aCount, b, bShape, bCount, dst); break;
+            case SimdSynetBinaryOperation32fMin: SynetBinaryOperation32fLayerForward<SimdSynetBinaryOperation32fMin>(a, aShape, aCount, b, bShape, bCount, dst); break;
+            case SimdSynetBinaryOperation32fMul: SynetBinaryOperation32fLayerForward<SimdSynetBinaryOperation32fMul>(a, aShape, aCount, b, bShape, bCount, dst); break;
+            case SimdSynetBinaryOperation32fPow: SynetBinaryOperation32fLayerForward<SimdSynetBinaryOperation32fPow>(a, aShape, aCount, b, bShape, bCount, dst); break;
+            case SimdSynetBinaryOperation32fSub: SynetBinaryOperation32fLayerForward<SimdSynetBinaryOperation32fSub>(a, aShape, aCount, b, bShape, bCount, dst); break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif
+}
@@ -541,6 +541,16 @@ namespace Simd
             _biasAndActivation = _N > Avx::F ? Avx512f::ConvolutionBiasAndActivation : Avx::ConvolutionBiasAndActivation;
         }
 
+        SIMD_INLINE bool GatherImgToColValid(const ConvParam32f & p)
+        {
+            size_t aligned = AlignHi(p.dstW, F) - F;
+            if (aligned == 0)
+                return true;
+            if (p.padX > F * p.strideX)
+                return false;
+            return aligned == F || (aligned - 1) * p.strideX + (p.kernelX - 1) * p.dilationX < p.srcW + p.padX;
+        }
+
         void SynetConvolution32fGemmNN::ImgToCol(const float * src, float * dst)
         {
             const ConvParam32f & p = _param;
@@ -558,7 +568,7 @@ namespace Simd
                     src += srcSize;
                 }
             }
-            else if (p.dilationX*p.dilationY*p.strideX*p.strideY != 1)
+            else if (p.dilationX*p.dilationY*p.strideX*p.strideY != 1 && GatherImgToColValid(p))
             {
                 __m512 _0 = _mm512_setzero_ps();
                 __m512i index = _mm512_loadu_si512(_index.data);
@@ -668,7 +678,14 @@ namespace Simd
             }
             else if (p.kernelY == 3 && p.kernelX == 3)
             {
-                if (_blockY == 4 && _blockX == 4)
+                if (p.trans && _blockY == 4 && _blockX == 4 && p.srcC >= 64 && p.dstC >= 64 && p.dstH >= 12 && p.dstW >= 12)
+                {
+                    SetBlock(6, 6);
+                    _setFilter = Avx512f::WinogradKernel3x3Block6x6SetFilter;
+                    _setInput = Avx512f::WinogradKernel3x3Block6x6SetInput;
+                    _setOutput = Avx512f::WinogradKernel3x3Block6x6SetOutput;
+                }
+                else if (_blockY == 4 && _blockX == 4)
                 {
                     _setFilter = Avx512f::WinogradKernel3x3Block4x4SetFilter;
                     _setInput = Avx512f::WinogradKernel3x3Block4x4SetInput;
@@ -713,7 +730,7 @@ namespace Simd
         SynetConvolution32fNhwcDirect::SynetConvolution32fNhwcDirect(const ConvParam32f& p)
             : Avx2::SynetConvolution32fNhwcDirect(p)
         {
-            if (p.dstC <= Avx::F)
+            if (p.dstC / p.group <= Avx::F)
                 return;
             //_old.enable = true;
             if (_old.enable)
@@ -748,12 +765,9 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
-        void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
+        static SynetConvolution32f * SynetConvolution32fDenseInit(const ConvParam32f & param)
         {
-            ConvParam32f param(batch, conv, gemm);
-            if (!param.Valid())
-                return NULL;
-            else if (Avx::SynetConvolution32fDepthwiseDotProduct::Preferable(param))
+            if (Avx::SynetConvolution32fDepthwiseDotProduct::Preferable(param))
                 return new Avx::SynetConvolution32fDepthwiseDotProduct(param);
             else if (SynetConvolution32fWinograd::Preferable(param))
                 return new SynetConvolution32fWinograd(param);
@@ -768,6 +782,26 @@ namespace Simd
             else
                 return new SynetConvolution32fGemmNN(param);
         }
+
+        void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
+        {
+            ConvParam32f param(batch, conv, gemm);
+            if (!param.Valid())
+                return NULL;
+            else if (SynetConvolution32fSparse::Preferable(param))
+                return new SynetConvolution32fSparse(param, SynetConvolution32fDenseInit(param));
+            else
+                return SynetConvolution32fDenseInit(param);
+        }
+
+        void * SynetConvolution32fInitV2(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType)
+        {
+            ConvParam32f param(batch, conv, gemm);
+            if (param.Valid() && SynetConvolution32fProd16::Preferable(param, weightType))
+                return new SynetConvolution32fProd16(param, weightType);
+            else
+                return SynetConvolution32fInit(batch, conv, gemm);
+        }
     }
 #endif//SIMD_AVX512F_ENABLE
 }
@@ -0,0 +1,174 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdSynetDetection.h"
+#include "Simd/SimdAvx512f.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512F_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Avx512f
+    {
+        static size_t DetectionSelect(const float* scores, size_t count, float threshold, int32_t* index, float* score)
+        {
+            size_t countF = AlignLo(count, F), size = 0, i = 0;
+            __m512 _threshold = _mm512_set1_ps(threshold);
+            __m512i _index = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _F = _mm512_set1_epi32(F);
+            for (; i < count; i += F)
+            {
+                __mmask16 tail = i < countF ? __mmask16(-1) : TailMask16(count - i);
+                __m512 _scores = _mm512_maskz_loadu_ps(tail, scores + i);
+                __mmask16 mask = _mm512_mask_cmp_ps_mask(tail, _scores, _threshold, _CMP_GT_OQ);
+                _mm512_mask_compressstoreu_ps(score + size, mask, _scores);
+                _mm512_mask_compressstoreu_epi32(index + size, mask, _index);
+                size += _mm_popcnt_u32(mask);
+                _index = _mm512_add_epi32(_index, _F);
+            }
+            return size;
+        }
+
+        static bool DetectionOverlaps(const float* kept, size_t size, size_t stride, const float* box, float threshold)
+        {
+            const float* x1 = kept + 0 * stride, * y1 = kept + 1 * stride, * x2 = kept + 2 * stride, * y2 = kept + 3 * stride, * area = kept + 4 * stride;
+            __m512 boxX1 = _mm512_set1_ps(box[0]), boxY1 = _mm512_set1_ps(box[1]), boxX2 = _mm512_set1_ps(box[2]), boxY2 = _mm512_set1_ps(box[3]);
+            __m512 boxArea = _mm512_set1_ps(Base::DetectionArea(box)), _threshold = _mm512_set1_ps(threshold), _0 = _mm512_setzero_ps();
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < size; i += F)
+            {
+                __mmask16 tail = i < sizeF ? __mmask16(-1) : TailMask16(size - i);
+                __m512 w = _mm512_max_ps(_mm512_sub_ps(_mm512_min_ps(boxX2, _mm512_maskz_loadu_ps(tail, x2 + i)), _mm512_max_ps(boxX1, _mm512_maskz_loadu_ps(tail, x1 + i))), _0);
+                __m512 h = _mm512_max_ps(_mm512_sub_ps(_mm512_min_ps(boxY2, _mm512_maskz_loadu_ps(tail, y2 + i)), _mm512_max_ps(boxY1, _mm512_maskz_loadu_ps(tail, y1 + i))), _0);
+                __m512 intersection = _mm512_mul_ps(w, h);
+                __m512 union_ = _mm512_sub_ps(_mm512_add_ps(boxArea, _mm512_maskz_loadu_ps(tail, area + i)), intersection);
+                if (_mm512_mask_cmp_ps_mask(tail, intersection, _mm512_mul_ps(_threshold, union_), _CMP_GT_OQ))
+                    return true;
+            }
+            return false;
+        }
+
+        size_t SynetDetectionOutput32f(const float* boxes, const float* scores, size_t count, size_t classes, size_t background,
+            const float* confidence, const float* overlap, size_t topK, size_t keepTopK, float* dst)
+        {
+            return Base::SynetDetectionOutput32f(boxes, scores, count, classes, background, *confidence, *overlap, topK, keepTopK, DetectionSelect, DetectionOverlaps, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void DecodeSsd(const float* loc, const float* prior, const float* variance, const __m512& half, float* dst, __mmask16 tail = -1)
+        {
+            __m512 _prior = _mm512_maskz_loadu_ps(tail, prior);
+            __m512 lo = _mm512_shuffle_ps(_prior, _prior, 0x44);
+            __m512 hi = _mm512_shuffle_ps(_prior, _prior, 0xEE);
+            __m512 size = _mm512_sub_ps(hi, lo);
+            __m512 center = _mm512_mul_ps(_mm512_add_ps(lo, hi), _mm512_set1_ps(0.5f));
+            __m512 _loc = _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, variance), _mm512_maskz_loadu_ps(tail, loc));
+            center = _mm512_fmadd_ps(_mm512_shuffle_ps(_loc, _loc, 0x44), size, center);
+            size = _mm512_mul_ps(_mm512_mul_ps(Exponent(_mm512_shuffle_ps(_loc, _loc, 0xEE)), size), half);
+            _mm512_mask_storeu_ps(dst, tail, _mm512_add_ps(center, size));
+        }
+
+        void SynetDecodeSsd32f(const float* loc, const float* prior, const float* variance, size_t count, float* dst)
+        {
+            size_t count4 = AlignLo(count, 4), i = 0;
+            __m512 half = _mm512_setr_ps(-0.5f, -0.5f, 0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f);
+            for (; i < count4; i += 4, loc += F, prior += F, variance += F, dst += F)
+                DecodeSsd(loc, prior, variance, half, dst);
+            if (i < count)
+                DecodeSsd(loc, prior, variance, half, dst, TailMask16((count - i) * 4));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m512 Sigmoid(__m512 value)
+        {
+            __m512 _1 = _mm512_set1_ps(1.0f);
+            return _mm512_div_ps(_1, _mm512_add_ps(_1, Exponent(_mm512_sub_ps(_mm512_setzero_ps(), value))));
+        }
+
+        SIMD_INLINE void StoreBoxes(float* dst, __m512 x1, __m512 y1, __m512 x2, __m512 y2, size_t size = F)
+        {
+            __m512 lo1 = _mm512_unpacklo_ps(x1, y1), lo2 = _mm512_unpacklo_ps(x2, y2);
+            __m512 hi1 = _mm512_unpackhi_ps(x1, y1), hi2 = _mm512_unpackhi_ps(x2, y2);
+            __m512 b[4] = { _mm512_shuffle_ps(lo1, lo2, 0x44), _mm512_shuffle_ps(lo1, lo2, 0xEE), _mm512_shuffle_ps(hi1, hi2, 0x44), _mm512_shuffle_ps(hi1, hi2, 0xEE) };
+            for (size_t i = 0; i < size; ++i)
+            {
+                switch (i / 4)
+                {
+                case 0: _mm_storeu_ps(dst + 4 * i, _mm512_extractf32x4_ps(b[i & 3], 0)); break;
+                case 1: _mm_storeu_ps(dst + 4 * i, _mm512_extractf32x4_ps(b[i & 3], 1)); break;
+                case 2: _mm_storeu_ps(dst + 4 * i, _mm512_extractf32x4_ps(b[i & 3], 2)); break;
+                case 3: _mm_storeu_ps(dst + 4 * i, _mm512_extractf32x4_ps(b[i & 3], 3)); break;
+                }
+            }
+        }
+
+        void SynetDecodeYolo32f(const float* src, size_t anchors, size_t classes, size_t height, size_t width, const float* sizes, float* boxes, float* scores)
+        {
+            size_t spatial = height * width, count = anchors * spatial, spatialF = AlignLo(spatial, F);
+            __mmask16 spatialTail = TailMask16(spatial - spatialF);
+            __m512 _width = _mm512_set1_ps(float(width)), _height = _mm512_set1_ps(float(height));
+            __m512 _offset = _mm512_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f);
+            Array32f buf(spatial);
+            for (size_t a = 0; a < anchors; ++a)
+            {
+                const float* x = src + 0 * spatial, * y = src + 1 * spatial, * w = src + 2 * spatial, * h = src + 3 * spatial, * obj = src + 4 * spatial;
+                __m512 _anchorW = _mm512_set1_ps(sizes[2 * a + 0] * 0.5f), _anchorH = _mm512_set1_ps(sizes[2 * a + 1] * 0.5f);
+                for (size_t row = 0, s = 0; row < height; ++row)
+                {
+                    __m512 _row = _mm512_set1_ps(float(row));
+                    for (size_t col = 0; col < width; col += F)
+                    {
+                        size_t size = Simd::Min<size_t>(F, width - col);
+                        __mmask16 tail = TailMask16(size);
+                        __m512 centerX = _mm512_div_ps(_mm512_add_ps(_mm512_add_ps(_mm512_set1_ps(float(col)), _offset), Sigmoid(_mm512_maskz_loadu_ps(tail, x + s))), _width);
+                        __m512 centerY = _mm512_div_ps(_mm512_add_ps(_row, Sigmoid(_mm512_maskz_loadu_ps(tail, y + s))), _height);
+                        __m512 halfW = _mm512_mul_ps(Exponent(_mm512_maskz_loadu_ps(tail, w + s)), _anchorW);
+                        __m512 halfH = _mm512_mul_ps(Exponent(_mm512_maskz_loadu_ps(tail, h + s)), _anchorH);
+                        StoreBoxes(boxes, _mm512_sub_ps(centerX, halfW), _mm512_sub_ps(centerY, halfH), _mm512_add_ps(centerX, halfW), _mm512_add_ps(centerY, halfH), size);
+                        s += size;
+                        boxes += 4 * size;
+                    }
+                }
+                size_t s = 0;
+                for (; s < spatialF; s += F)
+                    _mm512_storeu_ps(buf.data + s, Sigmoid(_mm512_loadu_ps(obj + s)));
+                if (s < spatial)
+                    _mm512_mask_storeu_ps(buf.data + s, spatialTail, Sigmoid(_mm512_maskz_loadu_ps(spatialTail, obj + s)));
+                for (size_t c = 0; c < classes; ++c)
+                {
+                    const float* cls = src + (5 + c) * spatial;
+                    float* dst = scores + c * count + a * spatial;
+                    for (s = 0; s < spatialF; s += F)
+                        _mm512_storeu_ps(dst + s, _mm512_mul_ps(_mm512_loadu_ps(buf.data + s), Sigmoid(_mm512_loadu_ps(cls + s))));
+                    if (s < spatial)
+                        _mm512_mask_storeu_ps(dst + s, spatialTail, _mm512_mul_ps(_mm512_maskz_loadu_ps(spatialTail, buf.data + s), Sigmoid(_mm512_maskz_loadu_ps(spatialTail, cls + s))));
+                }
+                src += (5 + classes) * spatial;
+            }
+        }
+    }
+#endif
+}
@@ -28,6 +28,7 @@
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdAvx512f.h"
 #include "Simd/SimdPrefetch.h"
+#include "Simd/SimdFloat16.h"
 
 namespace Simd
 {
@@ -385,16 +386,117 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
-        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation)
+        template<SimdTensorDataType type> SIMD_INLINE __m512 LoadWeight(const uint16_t* src);
+
+        template<> SIMD_INLINE __m512 LoadWeight<SimdTensorData16f>(const uint16_t* src)
         {
-            InnerProductParam32f param(batch, input, output, transpose, activation);
-            if (!param.Valid())
-                return NULL;
+            return _mm512_cvtph_ps(_mm256_loadu_si256((__m256i*)src));
+        }
+
+        template<> SIMD_INLINE __m512 LoadWeight<SimdTensorData16b>(const uint16_t* src)
+        {
+            return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((__m256i*)src)), Base::BF16_SHIFT));
+        }
+
+        template<SimdTensorDataType type> void InnerProduct16x1(size_t K, const float* src, const uint16_t* weight, const float* bias, float* dst, __mmask16 tail)
+        {
+            __m512 d0 = _mm512_loadu_ps(bias), d1 = _mm512_setzero_ps(), s0, s1;
+            size_t K2 = AlignLo(K, 2), k = 0;
+            for (; k < K2; k += 2, weight += 2 * F)
+            {
+                s0 = _mm512_set1_ps(src[k + 0]);
+                s1 = _mm512_set1_ps(src[k + 1]);
+                d0 = _mm512_fmadd_ps(LoadWeight<type>(weight + 0 * F), s0, d0);
+                d1 = _mm512_fmadd_ps(LoadWeight<type>(weight + 1 * F), s1, d1);
+            }
+            for (; k < K; k += 1, weight += F)
+            {
+                s0 = _mm512_set1_ps(src[k]);
+                d0 = _mm512_fmadd_ps(LoadWeight<type>(weight), s0, d0);
+            }
+            _mm512_mask_storeu_ps(dst, tail, _mm512_add_ps(d0, d1));
+        }
+
+        template<SimdTensorDataType type> void InnerProduct16x4(size_t K, const float* src, const uint16_t* weight0, const float* bias, float* dst)
+        {
+            __m512 d0 = _mm512_loadu_ps(bias + 0 * F);
+            __m512 d1 = _mm512_loadu_ps(bias + 1 * F);
+            __m512 d2 = _mm512_loadu_ps(bias + 2 * F);
+            __m512 d3 = _mm512_loadu_ps(bias + 3 * F);
+            const uint16_t* weight1 = weight0 + 1 * K * F;
+            const uint16_t* weight2 = weight0 + 2 * K * F;
+            const uint16_t* weight3 = weight0 + 3 * K * F;
+            for (size_t k = 0, off = 0; k < K; k += 1, off += F)
+            {
+                __m512 s0 = _mm512_set1_ps(src[k]);
+                d0 = _mm512_fmadd_ps(LoadWeight<type>(weight0 + off), s0, d0);
+                d1 = _mm512_fmadd_ps(LoadWeight<type>(weight1 + off), s0, d1);
+                d2 = _mm512_fmadd_ps(LoadWeight<type>(weight2 + off), s0, d2);
+                d3 = _mm512_fmadd_ps(LoadWeight<type>(weight3 + off), s0, d3);
+            }
+            _mm512_storeu_ps(dst + 0 * F, d0);
+            _mm512_storeu_ps(dst + 1 * F, d1);
+            _mm512_storeu_ps(dst + 2 * F, d2);
+            _mm512_storeu_ps(dst + 3 * F, d3);
+        }
+
+        template<SimdTensorDataType type> void InnerProduct16(const float* src, const uint16_t* weight, const float* bias, size_t input, size_t output, float* dst)
+        {
+            size_t outputF1 = AlignLo(output, F * 1);
+            size_t outputF4 = AlignLo(output, F * 4);
+            size_t o = 0;
+            for (; o < outputF4; o += F * 4)
+                InnerProduct16x4<type>(input, src, weight + o * input, bias + o, dst + o);
+            for (; o < outputF1; o += F * 1)
+                InnerProduct16x1<type>(input, src, weight + o * input, bias + o, dst + o, -1);
+            if (o < output)
+                InnerProduct16x1<type>(input, src, weight + o * input, bias + o, dst + o, TailMask16(output - o));
+        }
+
+        SynetInnerProduct32fProd16::SynetInnerProduct32fProd16(const InnerProductParam32f& p)
+            : Avx2::SynetInnerProduct32fProd16(p)
+        {
+            SetSize(Avx512f::F);
+            _prod = _param.weightType == SimdTensorData16f ? InnerProduct16<SimdTensorData16f> : InnerProduct16<SimdTensorData16b>;
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetConvolution32fProd16::SynetConvolution32fProd16(const ConvParam32f & p, SimdTensorDataType weightType)
+            : Avx2::SynetConvolution32fProd16(p, new SynetInnerProduct32fProd16(InnerProductParam32f(p.batch * p.dstH * p.dstW,
+                p.srcC, p.dstC, SimdFalse, SimdConvolutionActivationIdentity, weightType)))
+        {
+            _biasAndActivation = Avx512f::ConvolutionBiasAndActivation;
+        }
+
+        SynetConvolution32fProd16::SynetConvolution32fProd16(const ConvParam32f & p, SynetInnerProduct32f * prod)
+            : Avx2::SynetConvolution32fProd16(p, prod)
+        {
+            _biasAndActivation = Avx512f::ConvolutionBiasAndActivation;
+        }
+
+        //---------------------------------------------------------------------
+
+        static SynetInnerProduct32f * SynetInnerProduct32fDenseInit(const InnerProductParam32f & param)
+        {
+            if (param.weightType != SimdTensorData32f)
+                return new SynetInnerProduct32fProd16(param);
             if (SynetInnerProduct32fProd::Preferable(param))
                 return new SynetInnerProduct32fProd(param);
             else
                 return new SynetInnerProduct32fGemm(param);
         }
+
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType)
+        {
+            InnerProductParam32f param(batch, input, output, transpose, activation, weightType);
+            if (!param.Valid())
+                return NULL;
+            else if (SynetInnerProduct32fSparse::Preferable(param))
+                return new SynetInnerProduct32fSparse(param, SynetInnerProduct32fDenseInit(param));
+            else
+                return SynetInnerProduct32fDenseInit(param);
+        }
     }
 #endif// SIMD_AVX512F_ENABLE
 }
@@ -0,0 +1,306 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdSynetNormalize.h"
+#include "Simd/SimdSynetConvolution32fCommon.h"
+#include "Simd/SimdAvx512f.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512F_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Avx512f
+    {
+        template<SimdConvolutionActivationType type> SIMD_INLINE void NormalizeParams(const float* params, size_t channel, __m512* _params)
+        {
+            if (type == SimdConvolutionActivationPrelu)
+                _params[0] = _mm512_set1_ps(params[channel]);
+            else if (type != SimdConvolutionActivationIdentity && type != SimdConvolutionActivationRelu)
+            {
+                _params[0] = _mm512_set1_ps(params[0]);
+                if (type == SimdConvolutionActivationRestrictRange || type == SimdConvolutionActivationHswish || type == SimdConvolutionActivationHardSigmoid)
+                    _params[1] = _mm512_set1_ps(params[1]);
+            }
+        }
+
+        SIMD_INLINE void NormalizeStatistics(const __m512& count, const __m512& eps, float* mean, float* norm, __mmask16 tail = -1)
+        {
+            __m512 _mean = _mm512_div_ps(_mm512_maskz_loadu_ps(tail, mean), count);
+            __m512 _var = _mm512_max_ps(_mm512_sub_ps(_mm512_div_ps(_mm512_maskz_loadu_ps(tail, norm), count), _mm512_mul_ps(_mean, _mean)), _mm512_setzero_ps());
+            _mm512_mask_storeu_ps(mean, tail, _mean);
+            _mm512_mask_storeu_ps(norm, tail, _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_sqrt_ps(_mm512_add_ps(_var, eps))));
+        }
+
+        SIMD_INLINE void NormalizeAccumulate(const float* src, float* sum, float* sqsum, __mmask16 tail = -1)
+        {
+            __m512 _src = _mm512_maskz_loadu_ps(tail, src);
+            _mm512_mask_storeu_ps(sum, tail, _mm512_add_ps(_mm512_maskz_loadu_ps(tail, sum), _src));
+            _mm512_mask_storeu_ps(sqsum, tail, _mm512_fmadd_ps(_src, _src, _mm512_maskz_loadu_ps(tail, sqsum)));
+        }
+
+        SIMD_INLINE void NormalizeAccumulate(const float* src, __m512& sum, __m512& sqsum, __mmask16 tail = -1)
+        {
+            __m512 _src = _mm512_maskz_loadu_ps(tail, src);
+            sum = _mm512_add_ps(sum, _src);
+            sqsum = _mm512_fmadd_ps(_src, _src, sqsum);
+        }
+
+        template<SimdConvolutionActivationType type> void SynetLayerNormalize32fNchw(const float* src, size_t batch, size_t channels, size_t spatial,
+            const float* scale, const float* shift, float eps, const float* params, float* dst)
+        {
+            size_t spatialF = AlignLo(spatial, F);
+            __mmask16 tail = TailMask16(spatial - spatialF);
+            Array32f buf(spatial * 2);
+            float* mean = buf.data, * norm = mean + spatial;
+            __m512 _count = _mm512_set1_ps(float(channels)), _eps = _mm512_set1_ps(eps), _params[2];
+            for (size_t b = 0; b < batch; ++b)
+            {
+                buf.Clear();
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    const float* ps = src + c * spatial;
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                        NormalizeAccumulate(ps + s, mean + s, norm + s);
+                    if (s < spatial)
+                        NormalizeAccumulate(ps + s, mean + s, norm + s, tail);
+                }
+                size_t s = 0;
+                for (; s < spatialF; s += F)
+                    NormalizeStatistics(_count, _eps, mean + s, norm + s);
+                if (s < spatial)
+                    NormalizeStatistics(_count, _eps, mean + s, norm + s, tail);
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    __m512 _scale = _mm512_set1_ps(scale[c]);
+                    __m512 _shift = _mm512_set1_ps(shift[c]);
+                    NormalizeParams<type>(params, c, _params);
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                    {
+                        __m512 _dst = _mm512_mul_ps(_mm512_sub_ps(_mm512_loadu_ps(src + s), _mm512_loadu_ps(mean + s)), _mm512_loadu_ps(norm + s));
+                        _mm512_storeu_ps(dst + s, Activate<type>(_mm512_fmadd_ps(_dst, _scale, _shift), _params, 0));
+                    }
+                    if (s < spatial)
+                    {
+                        __m512 _dst = _mm512_mul_ps(_mm512_sub_ps(_mm512_maskz_loadu_ps(tail, src + s), _mm512_maskz_loadu_ps(tail, mean + s)), _mm512_maskz_loadu_ps(tail, norm + s));
+                        _mm512_mask_storeu_ps(dst + s, tail, Activate<type>(_mm512_fmadd_ps(_dst, _scale, _shift), _params, 0));
+                    }
+                    src += spatial;
+                    dst += spatial;
+                }
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void SynetLayerNormalize32fNhwc(const float* src, size_t batch, size_t channels, size_t spatial,
+            const float* scale, const float* shift, float eps, const float* params, float* dst)
+        {
+            size_t channelsF = AlignLo(channels, F);
+            __mmask16 tail = TailMask16(channels - channelsF);
+            for (size_t i = 0, n = batch * spatial; i < n; ++i)
+            {
+                __m512 _sum = _mm512_setzero_ps(), _sqsum = _mm512_setzero_ps();
+                size_t c = 0;
+                for (; c < channelsF; c += F)
+                    NormalizeAccumulate(src + c, _sum, _sqsum);
+                if (c < channels)
+                    NormalizeAccumulate(src + c, _sum, _sqsum, tail);
+                float mean, norm;
+                Base::NormalizeStatistics(ExtractSum(_sum), ExtractSum(_sqsum), channels, eps, mean, norm);
+                __m512 _mean = _mm512_set1_ps(mean), _norm = _mm512_set1_ps(norm);
+                for (c = 0; c < channelsF; c += F)
+                {
+                    __m512 _dst = _mm512_mul_ps(_mm512_sub_ps(_mm512_loadu_ps(src + c), _mean), _norm);
+                    _dst = _mm512_fmadd_ps(_dst, _mm512_loadu_ps(scale + c), _mm512_loadu_ps(shift + c));
+                    _mm512_storeu_ps(dst + c, Activate<type>(_dst, params, c));
+                }
+                if (c < channels)
+                {
+                    __m512 _dst = _mm512_mul_ps(_mm512_sub_ps(_mm512_maskz_loadu_ps(tail, src + c), _mean), _norm);
+                    _dst = _mm512_fmadd_ps(_dst, _mm512_maskz_loadu_ps(tail, scale + c), _mm512_maskz_loadu_ps(tail, shift + c));
+                    _mm512_mask_storeu_ps(dst + c, tail, Activate<type>(_dst, params, c, tail));
+                }
+                src += channels;
+                dst += channels;
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void SynetLayerNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial,
+            const float* scale, const float* shift, float eps, SimdTensorFormatType format, const float* params, float* dst)
+        {
+            if (format == SimdTensorFormatNchw)
+                SynetLayerNormalize32fNchw<type>(src, batch, channels, spatial, scale, shift, eps, params, dst);
+            else if (format == SimdTensorFormatNhwc)
+                SynetLayerNormalize32fNhwc<type>(src, batch, channels, spatial, scale, shift, eps, params, dst);
+            else
+                assert(0);
+        }
+
+        void SynetLayerNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst)
+        {
+            Array32f affine;
+            Base::NormalizeAffine(channels, scale, shift, affine);
+            switch (activation)
+            {
+            case SimdConvolutionActivationIdentity: SynetLayerNormalize32f<SimdConvolutionActivationIdentity>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationRelu: SynetLayerNormalize32f<SimdConvolutionActivationRelu>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationLeakyRelu: SynetLayerNormalize32f<SimdConvolutionActivationLeakyRelu>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationRestrictRange: SynetLayerNormalize32f<SimdConvolutionActivationRestrictRange>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationPrelu: SynetLayerNormalize32f<SimdConvolutionActivationPrelu>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationElu: SynetLayerNormalize32f<SimdConvolutionActivationElu>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationHswish: SynetLayerNormalize32f<SimdConvolutionActivationHswish>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationMish: SynetLayerNormalize32f<SimdConvolutionActivationMish>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationHardSigmoid: SynetLayerNormalize32f<SimdConvolutionActivationHardSigmoid>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<SimdConvolutionActivationType type> void SynetGroupNormalize32fNchw(const float* src, size_t batch, size_t channels, size_t spatial,
+            size_t group, const float* scale, const float* shift, float eps, const float* params, float* dst)
+        {
+            size_t groupC = channels / group, size = groupC * spatial, sizeF = AlignLo(size, F), spatialF = AlignLo(spatial, F);
+            __mmask16 sizeTail = TailMask16(size - sizeF), spatialTail = TailMask16(spatial - spatialF);
+            __m512 _params[2];
+            for (size_t b = 0; b < batch; ++b)
+            {
+                for (size_t g = 0, c = 0; g < group; ++g)
+                {
+                    __m512 _sum = _mm512_setzero_ps(), _sqsum = _mm512_setzero_ps();
+                    size_t i = 0;
+                    for (; i < sizeF; i += F)
+                        NormalizeAccumulate(src + i, _sum, _sqsum);
+                    if (i < size)
+                        NormalizeAccumulate(src + i, _sum, _sqsum, sizeTail);
+                    float mean, norm;
+                    Base::NormalizeStatistics(ExtractSum(_sum), ExtractSum(_sqsum), size, eps, mean, norm);
+                    for (size_t e = c + groupC; c < e; ++c)
+                    {
+                        float k = norm * scale[c];
+                        __m512 _k = _mm512_set1_ps(k), _s = _mm512_set1_ps(shift[c] - mean * k);
+                        NormalizeParams<type>(params, c, _params);
+                        for (i = 0; i < spatialF; i += F)
+                            _mm512_storeu_ps(dst + i, Activate<type>(_mm512_fmadd_ps(_mm512_loadu_ps(src + i), _k, _s), _params, 0));
+                        if (i < spatial)
+                            _mm512_mask_storeu_ps(dst + i, spatialTail, Activate<type>(_mm512_fmadd_ps(_mm512_maskz_loadu_ps(spatialTail, src + i), _k, _s), _params, 0));
+                        src += spatial;
+                        dst += spatial;
+                    }
+                }
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void SynetGroupNormalize32fNhwc(const float* src, size_t batch, size_t channels, size_t spatial,
+            size_t group, const float* scale, const float* shift, float eps, const float* params, float* dst)
+        {
+            size_t groupC = channels / group, size = groupC * spatial, channelsF = AlignLo(channels, F);
+            __mmask16 tail = TailMask16(channels - channelsF);
+            Array32f buf(channels * 2);
+            float* k = buf.data, * s = k + channels;
+            for (size_t b = 0; b < batch; ++b)
+            {
+                buf.Clear();
+                for (size_t i = 0; i < spatial; ++i)
+                {
+                    const float* ps = src + i * channels;
+                    size_t c = 0;
+                    for (; c < channelsF; c += F)
+                        NormalizeAccumulate(ps + c, k + c, s + c);
+                    if (c < channels)
+                        NormalizeAccumulate(ps + c, k + c, s + c, tail);
+                }
+                for (size_t g = 0, c = 0; g < group; ++g)
+                {
+                    float sum = 0.0f, sqsum = 0.0f, mean, norm;
+                    for (size_t i = c, e = c + groupC; i < e; ++i)
+                    {
+                        sum += k[i];
+                        sqsum += s[i];
+                    }
+                    Base::NormalizeStatistics(sum, sqsum, size, eps, mean, norm);
+                    for (size_t e = c + groupC; c < e; ++c)
+                    {
+                        k[c] = norm * scale[c];
+                        s[c] = shift[c] - mean * k[c];
+                    }
+                }
+                for (size_t i = 0; i < spatial; ++i)
+                {
+                    size_t c = 0;
+                    for (; c < channelsF; c += F)
+                    {
+                        __m512 _dst = _mm512_fmadd_ps(_mm512_loadu_ps(src + c), _mm512_loadu_ps(k + c), _mm512_loadu_ps(s + c));
+                        _mm512_storeu_ps(dst + c, Activate<type>(_dst, params, c));
+                    }
+                    if (c < channels)
+                    {
+                        __m512 _dst = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tail, src + c), _mm512_maskz_loadu_ps(tail, k + c), _mm512_maskz_loadu_ps(tail, s + c));
+                        _mm512_mask_storeu_ps(dst + c, tail, Activate<type>(_dst, params, c, tail));
+                    }
+                    src += channels;
+                    dst += channels;
+                }
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void SynetGroupNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial,
+            size_t group, const float* scale, const float* shift, float eps, SimdTensorFormatType format, const float* params, float* dst)
+        {
+            if (format == SimdTensorFormatNchw)
+                SynetGroupNormalize32fNchw<type>(src, batch, channels, spatial, group, scale, shift, eps, params, dst);
+            else if (format == SimdTensorFormatNhwc)
+                SynetGroupNormalize32fNhwc<type>(src, batch, channels, spatial, group, scale, shift, eps, params, dst);
+            else
+                assert(0);
+        }
+
+        void SynetGroupNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst)
+        {
+            assert(channels % group == 0);
+            Array32f affine;
+            Base::NormalizeAffine(channels, scale, shift, affine);
+            switch (activation)
+            {
+            case SimdConvolutionActivationIdentity: SynetGroupNormalize32f<SimdConvolutionActivationIdentity>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationRelu: SynetGroupNormalize32f<SimdConvolutionActivationRelu>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationLeakyRelu: SynetGroupNormalize32f<SimdConvolutionActivationLeakyRelu>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationRestrictRange: SynetGroupNormalize32f<SimdConvolutionActivationRestrictRange>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationPrelu: SynetGroupNormalize32f<SimdConvolutionActivationPrelu>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationElu: SynetGroupNormalize32f<SimdConvolutionActivationElu>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationHswish: SynetGroupNormalize32f<SimdConvolutionActivationHswish>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationMish: SynetGroupNormalize32f<SimdConvolutionActivationMish>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationHardSigmoid: SynetGroupNormalize32f<SimdConvolutionActivationHardSigmoid>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,150 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdSynetRoi.h"
+#include "Simd/SimdAvx512f.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512F_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Avx512f
+    {
+        template<size_t N> SIMD_INLINE void RoiAlignNhwc(const float* src, size_t channels, size_t stride, const int32_t* py, const float* wy, size_t sizeY,
+            const int32_t* px, const float* wx, size_t sizeX, float* dst, __mmask16 tail = -1)
+        {
+            __m512 sum[N];
+            for (size_t i = 0; i < N; ++i)
+                sum[i] = _mm512_setzero_ps();
+            for (size_t y = 0; y < sizeY; ++y)
+            {
+                if (wy[y] == 0.0f)
+                    continue;
+                const float* row = src + py[y] * stride;
+                for (size_t x = 0; x < sizeX; ++x)
+                {
+                    float w = wy[y] * wx[x];
+                    if (w == 0.0f)
+                        continue;
+                    __m512 _w = _mm512_set1_ps(w);
+                    const float* ps = row + px[x] * channels;
+                    for (size_t i = 0; i < N - 1; ++i)
+                        sum[i] = _mm512_fmadd_ps(_w, _mm512_loadu_ps(ps + i * F), sum[i]);
+                    sum[N - 1] = _mm512_fmadd_ps(_w, _mm512_maskz_loadu_ps(tail, ps + (N - 1) * F), sum[N - 1]);
+                }
+            }
+            for (size_t i = 0; i < N - 1; ++i)
+                _mm512_storeu_ps(dst + i * F, sum[i]);
+            _mm512_mask_storeu_ps(dst + (N - 1) * F, tail, sum[N - 1]);
+        }
+
+        static void RoiAlignNhwc(const float* src, size_t channels, size_t height, size_t width, const int32_t* iy, const float* ay, size_t gridH,
+            const int32_t* ix, const float* ax, size_t gridW, size_t pooledH, size_t pooledW, float* dst)
+        {
+            size_t sizeY = gridH * 2, sizeX = gridW * 2, stride = width * channels;
+            size_t channelsF = AlignLo(channels, F), channelsQF = AlignLo(channels, QF);
+            __mmask16 tail = TailMask16(channels - channelsF);
+            for (size_t ph = 0; ph < pooledH; ++ph)
+            {
+                const int32_t* py = iy + ph * sizeY;
+                const float* wy = ay + ph * sizeY;
+                for (size_t pw = 0; pw < pooledW; ++pw, dst += channels)
+                {
+                    const int32_t* px = ix + pw * sizeX;
+                    const float* wx = ax + pw * sizeX;
+                    size_t c = 0;
+                    for (; c < channelsQF; c += QF)
+                        RoiAlignNhwc<4>(src + c, channels, stride, py, wy, sizeY, px, wx, sizeX, dst + c);
+                    for (; c < channelsF; c += F)
+                        RoiAlignNhwc<1>(src + c, channels, stride, py, wy, sizeY, px, wx, sizeX, dst + c);
+                    if (c < channels)
+                        RoiAlignNhwc<1>(src + c, channels, stride, py, wy, sizeY, px, wx, sizeX, dst + c, tail);
+                }
+            }
+        }
+
+        void SynetRoiAlign32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+            size_t pooledH, size_t pooledW, const float* spatialScale, size_t samplingRatio, SimdBool aligned, float* dst)
+        {
+            Base::SynetRoiAlign32f(src, channels, height, width, format, rois, number, pooledH, pooledW, *spatialScale,
+                samplingRatio, aligned == SimdTrue, dst, Base::RoiAlignNchw, RoiAlignNhwc);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<size_t N> SIMD_INLINE void RoiPoolingNhwc(const float* src, size_t channels, size_t stride, size_t y0, size_t y1, size_t x0, size_t x1, float* dst, __mmask16 tail = -1)
+        {
+            __m512 max[N];
+            for (size_t i = 0; i < N - 1; ++i)
+                max[i] = _mm512_loadu_ps(src + y0 * stride + x0 * channels + i * F);
+            max[N - 1] = _mm512_maskz_loadu_ps(tail, src + y0 * stride + x0 * channels + (N - 1) * F);
+            for (size_t y = y0; y < y1; ++y)
+            {
+                const float* row = src + y * stride;
+                for (size_t x = x0; x < x1; ++x)
+                {
+                    const float* ps = row + x * channels;
+                    for (size_t i = 0; i < N - 1; ++i)
+                        max[i] = _mm512_max_ps(max[i], _mm512_loadu_ps(ps + i * F));
+                    max[N - 1] = _mm512_max_ps(max[N - 1], _mm512_maskz_loadu_ps(tail, ps + (N - 1) * F));
+                }
+            }
+            for (size_t i = 0; i < N - 1; ++i)
+                _mm512_storeu_ps(dst + i * F, max[i]);
+            _mm512_mask_storeu_ps(dst + (N - 1) * F, tail, max[N - 1]);
+        }
+
+        static void RoiPoolingNhwc(const float* src, size_t channels, size_t height, size_t width,
+            const int32_t* iy, const int32_t* ix, size_t pooledH, size_t pooledW, float* dst)
+        {
+            size_t stride = width * channels, channelsF = AlignLo(channels, F), channelsQF = AlignLo(channels, QF);
+            __mmask16 tail = TailMask16(channels - channelsF);
+            for (size_t ph = 0; ph < pooledH; ++ph)
+            {
+                for (size_t pw = 0; pw < pooledW; ++pw, dst += channels)
+                {
+                    size_t y0 = iy[2 * ph + 0], y1 = iy[2 * ph + 1], x0 = ix[2 * pw + 0], x1 = ix[2 * pw + 1];
+                    if (y0 >= y1 || x0 >= x1)
+                    {
+                        memset(dst, 0, channels * sizeof(float));
+                        continue;
+                    }
+                    size_t c = 0;
+                    for (; c < channelsQF; c += QF)
+                        RoiPoolingNhwc<4>(src + c, channels, stride, y0, y1, x0, x1, dst + c);
+                    for (; c < channelsF; c += F)
+                        RoiPoolingNhwc<1>(src + c, channels, stride, y0, y1, x0, x1, dst + c);
+                    if (c < channels)
+                        RoiPoolingNhwc<1>(src + c, channels, stride, y0, y1, x0, x1, dst + c, tail);
+                }
+            }
+        }
+
+        void SynetRoiPooling32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+            size_t pooledH, size_t pooledW, const float* spatialScale, float* dst)
+        {
+            Base::SynetRoiPooling32f(src, channels, height, width, format, rois, number, pooledH, pooledW, *spatialScale, dst, Base::RoiPoolingNchw, RoiPoolingNhwc);
+        }
+    }
+#endif
+}
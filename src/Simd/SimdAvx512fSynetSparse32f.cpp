@@ -0,0 +1,208 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetSparse32f.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSynetInnerProduct32f.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdAvx512f.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512F_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx512f
+    {
+        template<size_t V, size_t R> SIMD_INLINE void SparseKernelNS(const float * A, size_t lda, const int32_t * idx, const float * val, size_t cnt, size_t tail, float * C, size_t ldc)
+        {
+            __m512 sum[R][V];
+            for (size_t r = 0; r < R; ++r)
+                for (size_t v = 0; v < V; ++v)
+                    sum[r][v] = _mm512_setzero_ps();
+            for (size_t j = 0; j < cnt; ++j, val += V * F)
+            {
+                size_t k = idx[j];
+                __m512 w[V];
+                for (size_t v = 0; v < V; ++v)
+                    w[v] = _mm512_loadu_ps(val + v * F);
+                for (size_t r = 0; r < R; ++r)
+                {
+                    __m512 a = _mm512_set1_ps(A[r * lda + k]);
+                    for (size_t v = 0; v < V; ++v)
+                        sum[r][v] = _mm512_fmadd_ps(a, w[v], sum[r][v]);
+                }
+            }
+            for (size_t r = 0; r < R; ++r, C += ldc)
+            {
+                if (tail == V * F)
+                {
+                    for (size_t v = 0; v < V; ++v)
+                        _mm512_storeu_ps(C + v * F, sum[r][v]);
+                }
+                else
+                {
+                    SIMD_ALIGNED(64) float buf[V * F];
+                    for (size_t v = 0; v < V; ++v)
+                        _mm512_store_ps(buf + v * F, sum[r][v]);
+                    for (size_t i = 0; i < tail; ++i)
+                        C[i] = buf[i];
+                }
+            }
+        }
+
+        template<size_t V> void SparseGemmNS(size_t M, const float * A, size_t lda, const SparseWeight32f & B, float * C, size_t ldc)
+        {
+            const size_t NB = DivHi(B.N, B.B);
+            for (size_t m = 0; m < M; m += 4)
+            {
+                size_t R = Simd::Min(M, m + 4) - m;
+                const float * a = A + m * lda;
+                float * c = C + m * ldc;
+                for (size_t nb = 0; nb < NB; ++nb)
+                {
+                    size_t n = nb * B.B, tail = Simd::Min(B.N, n + B.B) - n, beg = B.offset[nb], cnt = B.offset[nb + 1] - beg;
+                    const int32_t * idx = B.index.data + beg;
+                    const float * val = B.value.data + beg * B.B;
+                    switch (R)
+                    {
+                    case 1: SparseKernelNS<V, 1>(a, lda, idx, val, cnt, tail, c + n, ldc); break;
+                    case 2: SparseKernelNS<V, 2>(a, lda, idx, val, cnt, tail, c + n, ldc); break;
+                    case 3: SparseKernelNS<V, 3>(a, lda, idx, val, cnt, tail, c + n, ldc); break;
+                    case 4: SparseKernelNS<V, 4>(a, lda, idx, val, cnt, tail, c + n, ldc); break;
+                    }
+                }
+            }
+        }
+
+        void SparseGemmNS1(size_t M, const float * A, size_t lda, const SparseWeight32f & B, float * C, size_t ldc)
+        {
+            for (size_t m = 0; m < M; ++m, A += lda, C += ldc)
+            {
+                for (size_t n = 0; n < B.N; ++n)
+                {
+                    size_t j = B.offset[n], end = B.offset[n + 1], end16 = j + AlignLo(end - j, 16);
+                    __m512 sum = _mm512_setzero_ps();
+                    for (; j < end16; j += 16)
+                        sum = _mm512_fmadd_ps(_mm512_i32gather_ps(_mm512_loadu_si512(B.index.data + j), A, 4), _mm512_loadu_ps(B.value.data + j), sum);
+                    float c = Avx512f::ExtractSum(sum);
+                    for (; j < end; ++j)
+                        c += A[B.index[j]] * B.value[j];
+                    C[n] = c;
+                }
+            }
+        }
+
+        void SparseGemm32fNS(size_t M, const float * A, size_t lda, const SparseWeight32f & B, float * C, size_t ldc)
+        {
+            switch (B.B)
+            {
+            case 1: SparseGemmNS1(M, A, lda, B, C, ldc); break;
+            case 16: SparseGemmNS<1>(M, A, lda, B, C, ldc); break;
+            default: Avx2::SparseGemm32fNS(M, A, lda, B, C, ldc);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<size_t R, size_t V> SIMD_INLINE void SparseKernelSN(const float * val, size_t stride, const int32_t * idx, size_t cnt, const float * B, size_t ldb, float * C, size_t ldc)
+        {
+            __m512 sum[R][V];
+            for (size_t r = 0; r < R; ++r)
+                for (size_t v = 0; v < V; ++v)
+                    sum[r][v] = _mm512_setzero_ps();
+            for (size_t j = 0; j < cnt; ++j, val += stride)
+            {
+                const float * b = B + idx[j] * ldb;
+                __m512 s[V];
+                for (size_t v = 0; v < V; ++v)
+                    s[v] = _mm512_loadu_ps(b + v * F);
+                for (size_t r = 0; r < R; ++r)
+                {
+                    __m512 w = _mm512_set1_ps(val[r]);
+                    for (size_t v = 0; v < V; ++v)
+                        sum[r][v] = _mm512_fmadd_ps(w, s[v], sum[r][v]);
+                }
+            }
+            for (size_t r = 0; r < R; ++r)
+                for (size_t v = 0; v < V; ++v)
+                    _mm512_storeu_ps(C + r * ldc + v * F, sum[r][v]);
+        }
+
+        template<size_t R> void SparseRowsSN(const float * val, size_t stride, const int32_t * idx, size_t cnt, size_t M, const float * B, size_t ldb, float * C, size_t ldc)
+        {
+            size_t M2 = AlignLo(M, 2 * F), M1 = AlignLo(M, F), m = 0;
+            for (; m < M2; m += 2 * F)
+                SparseKernelSN<R, 2>(val, stride, idx, cnt, B + m, ldb, C + m, ldc);
+            for (; m < M1; m += F)
+                SparseKernelSN<R, 1>(val, stride, idx, cnt, B + m, ldb, C + m, ldc);
+            if (m < M)
+                SparseKernelSN<R, 1>(val, stride, idx, cnt, B + M - F, ldb, C + M - F, ldc);
+        }
+
+        void SparseGemm32fSN(const SparseWeight32f & A, size_t M, const float * B, size_t ldb, float * C, size_t ldc)
+        {
+            if (M < F)
+            {
+                Avx2::SparseGemm32fSN(A, M, B, ldb, C, ldc);
+                return;
+            }
+            const size_t NB = DivHi(A.N, A.B);
+            for (size_t nb = 0; nb < NB; ++nb)
+            {
+                size_t n = nb * A.B, nn = Simd::Min(A.N, n + A.B) - n, beg = A.offset[nb], cnt = A.offset[nb + 1] - beg;
+                const int32_t * idx = A.index.data + beg;
+                for (size_t i = 0; i < nn; i += 4)
+                {
+                    const float * val = A.value.data + beg * A.B + i;
+                    float * c = C + (n + i) * ldc;
+                    switch (Simd::Min<size_t>(4, nn - i))
+                    {
+                    case 1: SparseRowsSN<1>(val, A.B, idx, cnt, M, B, ldb, c, ldc); break;
+                    case 2: SparseRowsSN<2>(val, A.B, idx, cnt, M, B, ldb, c, ldc); break;
+                    case 3: SparseRowsSN<3>(val, A.B, idx, cnt, M, B, ldb, c, ldc); break;
+                    case 4: SparseRowsSN<4>(val, A.B, idx, cnt, M, B, ldb, c, ldc); break;
+                    }
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetConvolution32fSparse::SynetConvolution32fSparse(const ConvParam32f & p, SynetConvolution32f * dense)
+            : Avx2::SynetConvolution32fSparse(p, dense)
+        {
+            _gemmNS = Avx512f::SparseGemm32fNS;
+            _gemmSN = Avx512f::SparseGemm32fSN;
+            _biasAndActivation = Avx512f::ConvolutionBiasAndActivation;
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetInnerProduct32fSparse::SynetInnerProduct32fSparse(const InnerProductParam32f & p, SynetInnerProduct32f * dense)
+            : Avx2::SynetInnerProduct32fSparse(p, dense)
+        {
+            _gemm = Avx512f::SparseGemm32fNS;
+            _biasAndActivation = Avx512f::ConvolutionBiasAndActivation;
+        }
+    }
+#endif//SIMD_AVX512F_ENABLE && SIMD_SYNET_ENABLE
+}
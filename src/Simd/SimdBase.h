@@ -194,6 +194,10 @@ namespace Simd
 
         void * DetectionLoadA(const char * path);
 
+        void * DetectionLoadBinary(const uint8_t * buffer, size_t size);
+
+        size_t DetectionSaveBinary(const void * data, uint8_t * buffer, size_t size);
+
         void DetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags);
 
         void * DetectionInit(const void * data, uint8_t * sum, size_t sumStride, size_t width, size_t height,
@@ -566,10 +570,22 @@ namespace Simd
         void SynetAdd8i(const uint8_t* aData, const float* aScale, const float* aShift, const uint8_t* bData, const float* bScale, const float* bShift,
             uint8_t* cData, const float* cScale, const float* cShift, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
 
+        void SynetBinaryOperation32fLayerForward(const float* a, const size_t* aShape, size_t aCount, const float* b, const size_t* bShape, size_t bCount,
+            SimdSynetBinaryOperation32fType type, float* dst);
+
         void SynetConvert32fTo8u(const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility);
 
         void SynetConvert8uTo32f(const uint8_t* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, float* dst, SimdSynetCompatibilityType compatibility);
 
+        void SynetCopyToStrided32f(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, float* dst, size_t dstStride);
+
+        void SynetDecodeSsd32f(const float* loc, const float* prior, const float* variance, size_t count, float* dst);
+
+        void SynetDecodeYolo32f(const float* src, size_t anchors, size_t classes, size_t height, size_t width, const float* sizes, float* boxes, float* scores);
+
+        size_t SynetDetectionOutput32f(const float* boxes, const float* scores, size_t count, size_t classes, size_t background,
+            const float* confidence, const float* overlap, size_t topK, size_t keepTopK, float* dst);
+
         void SynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
 
         void SynetElu32f(const float * src, size_t size, const float * alpha, float * dst);
@@ -588,6 +604,9 @@ namespace Simd
 
         void SynetFusedLayerForward9(const float * src0, const float * src1, const float * scale, const float * bias, size_t channels0, size_t channels1, size_t spatial, float * dst0, float * dst1, SimdTensorFormatType format);
 
+        void SynetGroupNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst);
+
         void SynetHardSigmoid32f(const float* src, size_t size, const float* scale, const float* shift, float* dst);
             
         void SynetHswish32f(const float * src, size_t size, const float * shift, const float * scale, float * dst);
@@ -596,13 +615,26 @@ namespace Simd
 
         void SynetInnerProduct8i(size_t M, size_t N, size_t K, const uint8_t* src, const int8_t* weight, int32_t* dst, SimdSynetCompatibilityType compatibility);
 
+        void SynetL2Normalize32f(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+            SimdBool acrossSpatial, const float* eps, float* dst);
+
+        void SynetLayerNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst);
+
+        void SynetLogSoftmaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst);
+
         void SynetLrnLayerCrossChannels(const float * src, size_t half, size_t channels, size_t spatial, const float * k, float * dst, SimdTensorFormatType format);
 
         void SynetMish32f(const float* src, size_t size, const float* threshold, float* dst);
 
+        void SynetPermute32f(const float* src, const size_t* shape, const size_t* order, size_t count, float* dst);
+
         void SynetPoolingForwardAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
             size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
 
+        void SynetPoolingForwardAverage8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+            size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
+
         void SynetPoolingForwardMax32f(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
             size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
 
@@ -611,16 +643,30 @@ namespace Simd
 
         void SynetPreluLayerForward(const float * src, const float * slope, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
 
+        void SynetReduceLayerForward(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+            SimdSynetReduceType type, SimdBool reduceChannels, SimdBool reduceSpatial, float* dst);
+
         void SynetRelu32f(const float* src, size_t size, const float* slope, float* dst);
 
         void SynetReorderImage(size_t batch, size_t channels, size_t spatial, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat);
 
+        void SynetReorderImage8u(size_t batch, size_t channels, size_t spatial, const uint8_t * src, SimdTensorFormatType srcFormat, uint8_t * dst, SimdTensorFormatType dstFormat);
+
         void SynetReorderFilter(size_t output, size_t input, size_t kernel, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat);
 
         void SynetRestrictRange32f(const float * src, size_t size, const float * lower, const float * upper, float * dst);
 
+        void SynetRoiAlign32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+            size_t pooledH, size_t pooledW, const float* spatialScale, size_t samplingRatio, SimdBool aligned, float* dst);
+
+        void SynetRoiPooling32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+            size_t pooledH, size_t pooledW, const float* spatialScale, float* dst);
+
         void SynetScaleLayerForward(const float* src, const float* scale, const float* bias, size_t channels, size_t height, size_t width, float* dst, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
 
+        void SynetScaledDotProductAttention32f(size_t batch, size_t queries, size_t keys, size_t depth, size_t valueDepth,
+            const float* query, const float* key, const float* value, const float* scale, float* dst);
+
         void SynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat, 
             const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat);
 
@@ -628,6 +674,8 @@ namespace Simd
 
         void SynetSigmoid32f(const float* src, size_t size, const float* slope, float* dst);
 
+        void SynetSoftmaxArgMaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst, uint32_t* index);
+
         void SynetSoftmaxLayerForward(const float * src, size_t outer, size_t size, size_t inner, float * dst);
 
         void SynetSoftplus32f(const float* src, size_t size, const float* beta, const float* threshold, float* dst);
@@ -703,6 +751,13 @@ namespace Simd
 
         void WinogradKernel3x3Block4x4SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
 
+        void WinogradKernel3x3Block6x6SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
+
+        void WinogradKernel3x3Block6x6SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
+            size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
+
+        void WinogradKernel3x3Block6x6SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
+
         void Yuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
 
@@ -320,6 +320,213 @@ namespace Simd
             return data;
         }
 
+        namespace Binary
+        {
+            const uint32_t MAGIC = 0x43424453;
+            const uint32_t VERSION = 1;
+
+            struct Header
+            {
+                uint32_t magic, version;
+                int32_t stageType, featureType, ncategories, width, height;
+                int32_t isStumpBased, hasTilted, canInt16;
+                uint32_t stages, classifiers, nodes, leaves, subsets, haarFeatures, lbpFeatures;
+            };
+
+            struct HaarFeature
+            {
+                int32_t tilted;
+                Data::Rect rect[Data::HaarFeature::RECT_NUM];
+                float weight[Data::HaarFeature::RECT_NUM];
+            };
+
+            template<class T> SIMD_INLINE void Write(uint8_t *& dst, const std::vector<T> & src)
+            {
+                if (src.size())
+                    memcpy(dst, src.data(), src.size() * sizeof(T));
+                dst += src.size() * sizeof(T);
+            }
+
+            template<class T> SIMD_INLINE bool Read(const uint8_t *& src, const uint8_t * end, std::vector<T> & dst, size_t count)
+            {
+                if (count > size_t(end - src) / sizeof(T))
+                    return false;
+                dst.resize(count);
+                if (count)
+                    memcpy(dst.data(), src, count * sizeof(T));
+                src += count * sizeof(T);
+                return true;
+            }
+        }
+
+        size_t DetectionSaveBinary(const void * _data, uint8_t * buffer, size_t size)
+        {
+            const Data & data = *(Data*)_data;
+            size_t required = sizeof(Binary::Header) + data.stages.size() * sizeof(Data::Stage) + data.classifiers.size() * sizeof(Data::DTree) +
+                data.nodes.size() * sizeof(Data::DTreeNode) + data.leaves.size() * sizeof(float) + data.subsets.size() * sizeof(int) +
+                data.haarFeatures.size() * sizeof(Binary::HaarFeature) + data.lbpFeatures.size() * sizeof(Data::LbpFeature);
+            if (buffer == NULL || size < required)
+                return required;
+
+            Binary::Header header;
+            header.magic = Binary::MAGIC;
+            header.version = Binary::VERSION;
+            header.stageType = data.stageType;
+            header.featureType = data.featureType;
+            header.ncategories = data.ncategories;
+            header.width = (int32_t)data.origWinSize.x;
+            header.height = (int32_t)data.origWinSize.y;
+            header.isStumpBased = data.isStumpBased;
+            header.hasTilted = data.hasTilted;
+            header.canInt16 = data.canInt16;
+            header.stages = (uint32_t)data.stages.size();
+            header.classifiers = (uint32_t)data.classifiers.size();
+            header.nodes = (uint32_t)data.nodes.size();
+            header.leaves = (uint32_t)data.leaves.size();
+            header.subsets = (uint32_t)data.subsets.size();
+            header.haarFeatures = (uint32_t)data.haarFeatures.size();
+            header.lbpFeatures = (uint32_t)data.lbpFeatures.size();
+
+            std::vector<Binary::HaarFeature> haarFeatures(data.haarFeatures.size());
+            for (size_t i = 0; i < haarFeatures.size(); ++i)
+            {
+                haarFeatures[i].tilted = data.haarFeatures[i].tilted;
+                for (size_t j = 0; j < Data::HaarFeature::RECT_NUM; ++j)
+                {
+                    haarFeatures[i].rect[j] = data.haarFeatures[i].rect[j].r;
+                    haarFeatures[i].weight[j] = data.haarFeatures[i].rect[j].weight;
+                }
+            }
+
+            uint8_t * dst = buffer;
+            memcpy(dst, &header, sizeof(header));
+            dst += sizeof(header);
+            Binary::Write(dst, data.stages);
+            Binary::Write(dst, data.classifiers);
+            Binary::Write(dst, data.nodes);
+            Binary::Write(dst, data.leaves);
+            Binary::Write(dst, data.subsets);
+            Binary::Write(dst, haarFeatures);
+            Binary::Write(dst, data.lbpFeatures);
+            assert(dst == buffer + required);
+            return required;
+        }
+
+        static bool InsideWindow(const Data::Rect & r, int dx, int dy, const Size & size)
+        {
+            return r.x >= 0 && r.y >= 0 && r.width >= 0 && r.height >= 0 && r.x + r.width * dx <= size.x && r.y + r.height * dy <= size.y;
+        }
+
+        static bool Valid(const Data & data)
+        {
+            if (data.origWinSize.x <= 0 || data.origWinSize.y <= 0)
+                return false;
+            if (!data.isStumpBased || data.nodes.size() != data.classifiers.size() || data.leaves.size() != data.nodes.size() * 2)
+                return false;
+            for (size_t i = 0; i < data.classifiers.size(); ++i)
+                if (data.classifiers[i].nodeCount != 1)
+                    return false;
+            for (size_t i = 0; i < data.stages.size(); ++i)
+                if (data.stages[i].first < 0 || data.stages[i].ntrees < 0 || 
+                    size_t(data.stages[i].first) + size_t(data.stages[i].ntrees) > data.classifiers.size())
+                    return false;
+            size_t features = 0;
+            if (data.featureType == SimdDetectionInfoFeatureHaar)
+            {
+                features = data.haarFeatures.size();
+                for (size_t i = 0; i < features; ++i)
+                {
+                    if (data.haarFeatures[i].tilted && !data.hasTilted)
+                        return false;
+                    for (size_t j = 0; j < Data::HaarFeature::RECT_NUM; ++j)
+                    {
+                        const Data::Rect & r = data.haarFeatures[i].rect[j].r;
+                        float weight = data.haarFeatures[i].rect[j].weight;
+                        if (data.canInt16 && (weight != Simd::Round(weight) || Simd::Abs(weight) > 128))
+                            return false;
+                        if (data.haarFeatures[i].tilted)
+                        {
+                            if (r.width < 0 || r.height < 0 || r.x - r.height < 0 || r.y < 0 || 
+                                r.x + r.width > data.origWinSize.x || r.y + r.width + r.height > data.origWinSize.y)
+                                return false;
+                        }
+                        else if (!InsideWindow(r, 1, 1, data.origWinSize))
+                            return false;
+                    }
+                }
+            }
+            else if (data.featureType == SimdDetectionInfoFeatureLbp)
+            {
+                features = data.lbpFeatures.size();
+                for (size_t i = 0; i < features; ++i)
+                    if (!InsideWindow(data.lbpFeatures[i].rect, 3, 3, data.origWinSize) ||
+                        (data.canInt16 && data.lbpFeatures[i].rect.width * data.lbpFeatures[i].rect.height > 256))
+                        return false;
+                if (data.ncategories <= 0 || data.subsets.size() != data.nodes.size() * ((data.ncategories + 31) / 32))
+                    return false;
+            }
+            else
+                return false;
+            for (size_t i = 0; i < data.nodes.size(); ++i)
+                if (data.nodes[i].featureIdx < 0 || size_t(data.nodes[i].featureIdx) >= features)
+                    return false;
+            return true;
+        }
+
+        void * DetectionLoadBinary(const uint8_t * buffer, size_t size)
+        {
+            Binary::Header header;
+            if (buffer == NULL || size < sizeof(header))
+                return NULL;
+            memcpy(&header, buffer, sizeof(header));
+            if (header.magic != Binary::MAGIC || header.version != Binary::VERSION)
+            {
+                SIMD_LOG_ERROR("Unsupported binary cascade format!");
+                return NULL;
+            }
+
+            Data * data = new Data();
+            data->stageType = header.stageType;
+            data->featureType = (SimdDetectionInfoFlags)header.featureType;
+            data->ncategories = header.ncategories;
+            data->origWinSize = Size(header.width, header.height);
+            data->isStumpBased = header.isStumpBased != 0;
+            data->hasTilted = header.hasTilted != 0;
+            data->canInt16 = header.canInt16 != 0;
+
+            const uint8_t * src = buffer + sizeof(header), * end = buffer + size;
+            std::vector<Binary::HaarFeature> haarFeatures;
+            if (!(Binary::Read(src, end, data->stages, header.stages) && Binary::Read(src, end, data->classifiers, header.classifiers) &&
+                Binary::Read(src, end, data->nodes, header.nodes) && Binary::Read(src, end, data->leaves, header.leaves) &&
+                Binary::Read(src, end, data->subsets, header.subsets) && Binary::Read(src, end, haarFeatures, header.haarFeatures) &&
+                Binary::Read(src, end, data->lbpFeatures, header.lbpFeatures)))
+            {
+                SIMD_LOG_ERROR("Binary cascade is truncated!");
+                delete data;
+                return NULL;
+            }
+
+            data->haarFeatures.resize(haarFeatures.size());
+            for (size_t i = 0; i < haarFeatures.size(); ++i)
+            {
+                data->haarFeatures[i].tilted = haarFeatures[i].tilted != 0;
+                for (size_t j = 0; j < Data::HaarFeature::RECT_NUM; ++j)
+                {
+                    data->haarFeatures[i].rect[j].r = haarFeatures[i].rect[j];
+                    data->haarFeatures[i].rect[j].weight = haarFeatures[i].weight[j];
+                }
+            }
+
+            if (!Valid(*data))
+            {
+                SIMD_LOG_ERROR("Binary cascade is inconsistent!");
+                delete data;
+                return NULL;
+            }
+            return data;
+        }
+
+
         void * DetectionLoadA(const char * path)
         {
             Xml::File file;
@@ -329,6 +536,9 @@ namespace Simd
                 return NULL;
             }
 
+            if (file.Size() - 1 >= sizeof(Binary::MAGIC) && *(uint32_t*)file.Data() == Binary::MAGIC)
+                return DetectionLoadBinary((uint8_t*)file.Data(), file.Size() - 1);
+
             return DetectionLoadStringXml(file.Data(), path);
         }
 
@@ -55,8 +55,8 @@ namespace Simd
                     pC[j] = b * pC[j];
                 for (size_t j = 0; j < N; ++j)
                 {
-                    const float * pA = A + i * K;
-                    const float * pB = B + j * K;
+                    const float * pA = A + i * lda;
+                    const float * pB = B + j * ldb;
                     float sum = 0;
                     for (size_t k = 0; k < K; ++k)
                         sum += pA[k] * pB[k];
@@ -0,0 +1,132 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdGemm32fPacked.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        static size_t Gemm32fPackedBufferSize(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility)
+        {
+            return N * K;
+        }
+
+        static void Gemm32fPackedReorderB(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility)
+        {
+            memcpy(pB, B, N * K * sizeof(float));
+        }
+
+        static void Gemm32fPackedRun(size_t M, size_t N, size_t K, const float * A, size_t lda, const float * pB, float * C, size_t ldc,
+            const GemmPost<float> & post, GemmKernelType type, bool compatibility)
+        {
+            const float _1 = 1.0f;
+            for (size_t i = 0; i < M; ++i)
+            {
+                float * pC = C + i * ldc;
+                if (post.beta == 0.0f)
+                    memset(pC, 0, N * sizeof(float));
+                else
+                {
+                    for (size_t j = 0; j < N; ++j)
+                        pC[j] *= post.beta;
+                }
+            }
+            Base::Gemm32fNN(M, N, K, &_1, A, lda, pB, N, &_1, C, ldc);
+            post.Apply(M, N, 0, C, ldc);
+        }
+
+        //---------------------------------------------------------------------
+
+        Gemm32fPackedNN::Gemm32fPackedNN(const GemmPackedParam32f & p)
+            : Simd::Gemm32fPacked(p)
+        {
+            _type = GemmKernelAny;
+            _bufferSize = Base::Gemm32fPackedBufferSize;
+            _reorderB = Base::Gemm32fPackedReorderB;
+            _run = Base::Gemm32fPackedRun;
+            _biasAndActivation = Base::ConvolutionBiasAndActivation;
+        }
+
+        static size_t ActivationParamsSize(SimdConvolutionActivationType activation, size_t N)
+        {
+            switch (activation)
+            {
+            case SimdConvolutionActivationLeakyRelu: return 1;
+            case SimdConvolutionActivationRestrictRange: return 2;
+            case SimdConvolutionActivationPrelu: return N;
+            case SimdConvolutionActivationElu: return 1;
+            case SimdConvolutionActivationHswish: return 2;
+            case SimdConvolutionActivationMish: return 1;
+            case SimdConvolutionActivationHardSigmoid: return 2;
+            default: return 0;
+            }
+        }
+
+        String Gemm32fPackedNN::Desc() const
+        {
+            return Ext() + (_type == GemmKernelAny ? String("::NN") : String("::NNcb-F") + ToStr(int(_type)));
+        }
+
+        void Gemm32fPackedNN::SetParams(const float * B, const float * bias, const float * params)
+        {
+            const GemmPackedParam32f & p = _param;
+            _pB.Resize(_bufferSize(p.M, p.N, p.K, _type, false));
+            _reorderB(p.M, p.N, p.K, B, _pB.data, _type, false);
+            if (bias)
+            {
+                _bias.Resize(p.N);
+                memcpy(_bias.data, bias, p.N * sizeof(float));
+            }
+            else
+                _bias.Resize(0);
+            size_t paramsSize = params ? ActivationParamsSize(p.activation, p.N) : 0;
+            _params.Resize(paramsSize);
+            if (paramsSize)
+                memcpy(_params.data, params, paramsSize * sizeof(float));
+        }
+
+        void Gemm32fPackedNN::Run(size_t M, const float * A, size_t lda, const float * beta, float * C, size_t ldc)
+        {
+            if (M == 0)
+                return;
+            GemmPost<float> post(beta ? beta[0] : 0.0f, _biasAndActivation, _bias.data, _param.activation, _params.data);
+            // Blocking and buffer for packing of A are created at every call: so the context stays constant and Run is reentrant.
+            _run(M, _param.N, _param.K, A, lda, _pB.data, C, ldc, post, _type, false);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * Gemm32fPackedInit(size_t M, size_t N, size_t K, SimdConvolutionActivationType activation)
+        {
+            GemmPackedParam32f param(M, N, K, activation);
+            if (!param.Valid())
+                return NULL;
+            return new Gemm32fPackedNN(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,199 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdGemm8iPacked.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        template<bool overflow> SIMD_INLINE int32_t Gemm8iPackedDot(size_t K, const uint8_t * a, const int8_t * b, size_t ldb)
+        {
+            int32_t sum = 0;
+            size_t k = 0;
+            if (overflow)
+            {
+                for (; k + 1 < K; k += 2)
+                    sum += RestrictRange(int(a[k + 0]) * int(b[(k + 0) * ldb]) + int(a[k + 1]) * int(b[(k + 1) * ldb]), SHRT_MIN, SHRT_MAX);
+            }
+            for (; k < K; ++k)
+                sum += int(a[k]) * int(b[k * ldb]);
+            return sum;
+        }
+
+        template<SimdTensorDataType dstT> SIMD_INLINE void Gemm8iPackedSave(uint8_t * C, size_t j, int32_t sum, const float * scale, const float * shift)
+        {
+            if (dstT == SimdTensorData32i)
+                ((int32_t*)C)[j] = sum;
+            else if (dstT == SimdTensorData32f)
+                ((float*)C)[j] = float(sum) * scale[j] + shift[j];
+            else
+                C[j] = (uint8_t)RestrictRange(Round(float(sum) * scale[j] + shift[j]), 0, 255);
+        }
+
+        template<bool overflow, SimdTensorDataType dstT> static void Gemm8iPackedRun(size_t M, size_t N, size_t K, 
+            const uint8_t * A, size_t lda, const int8_t * pB, uint8_t * C, size_t ldc, const Gemm8iPackedNN::Post & post)
+        {
+            size_t size = dstT == SimdTensorData8u ? 1 : 4;
+            for (size_t i = 0; i < M; ++i)
+            {
+                for (size_t j = 0; j < N; ++j)
+                {
+                    int32_t sum = Gemm8iPackedDot<overflow>(K, A, pB + j, N) + post.comp[j];
+                    if (post.zero)
+                        sum += post.zero[j] * post.sums[i];
+                    Gemm8iPackedSave<dstT>(C, j, sum, post.scale, post.shift);
+                }
+                A += lda;
+                C += ldc * size;
+            }
+        }
+
+        template<bool overflow> static Gemm8iPackedNN::RunPtr GetGemm8iPackedRun(SimdTensorDataType dstT)
+        {
+            switch (dstT)
+            {
+            case SimdTensorData32i: return Gemm8iPackedRun<overflow, SimdTensorData32i>;
+            case SimdTensorData32f: return Gemm8iPackedRun<overflow, SimdTensorData32f>;
+            case SimdTensorData8u: return Gemm8iPackedRun<overflow, SimdTensorData8u>;
+            default:
+                assert(0); return NULL;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        Gemm8iPackedNN::Gemm8iPackedNN(const GemmPackedParam8i & p)
+            : Simd::Gemm8iPacked(p)
+        {
+            _microN = 1;
+            _microK = 1;
+            _run = p.Precise() ? GetGemm8iPackedRun<false>(p.dstT) : GetGemm8iPackedRun<true>(p.dstT);
+        }
+
+        String Gemm8iPackedNN::Desc() const
+        {
+            return Ext() + (_microN == 1 ? String("::NN") : String("::NNp-") + ToStr(_microN));
+        }
+
+        size_t Gemm8iPackedNN::InternalBufferSize() const
+        {
+            return _pB.RawSize() + _comp.RawSize() + _zero.RawSize() + _scale.RawSize() + _shift.RawSize();
+        }
+
+        void Gemm8iPackedNN::ReorderB(const int8_t * B)
+        {
+            const GemmPackedParam8i & p = _param;
+            if (_microN == 1)
+            {
+                _pB.Resize(p.K * p.N);
+                memcpy(_pB.data, B, _pB.size);
+                return;
+            }
+            size_t K = AlignHi(p.K, _microK), N = AlignHi(p.N, _microN);
+            _pB.Resize(K * N, true);
+            int8_t * pB = _pB.data;
+            for (size_t j = 0; j < p.N; j += _microN)
+            {
+                size_t n = Simd::Min(p.N, j + _microN) - j;
+                for (size_t k = 0; k < p.K; k += _microK)
+                {
+                    size_t kn = Simd::Min(p.K, k + _microK) - k;
+                    for (size_t jn = 0; jn < n; ++jn)
+                        for (size_t kk = 0; kk < kn; ++kk)
+                            pB[jn * _microK + kk] = B[(k + kk) * p.N + j + jn];
+                    pB += _microN * _microK;
+                }
+            }
+        }
+
+        void Gemm8iPackedNN::SetParams(const int8_t * B, uint8_t aZero, const int8_t * bZero, const float * scale, const float * shift)
+        {
+            const GemmPackedParam8i & p = _param;
+            ReorderB(B);
+            size_t N = AlignHi(p.N, _microN);
+            _comp.Resize(N, true);
+            for (size_t j = 0; j < p.N; ++j)
+            {
+                int32_t sum = 0;
+                for (size_t k = 0; k < p.K; ++k)
+                    sum += B[k * p.N + j];
+                _comp[j] = -int32_t(aZero) * sum + (bZero ? int32_t(p.K) * aZero * bZero[j] : 0);
+            }
+            if (bZero)
+            {
+                _zero.Resize(N, true);
+                for (size_t j = 0; j < p.N; ++j)
+                    _zero[j] = -bZero[j];
+            }
+            else
+                _zero.Resize(0);
+            if (p.dstT != SimdTensorData32i)
+            {
+                _scale.Resize(N, true);
+                _shift.Resize(N, true);
+                for (size_t j = 0; j < p.N; ++j)
+                {
+                    _scale[j] = scale ? scale[j] : 1.0f;
+                    _shift[j] = shift ? shift[j] : 0.0f;
+                }
+            }
+        }
+
+        void Gemm8iPackedNN::Run(size_t M, const uint8_t * A, size_t lda, uint8_t * C, size_t ldc)
+        {
+            if (M == 0)
+                return;
+            const GemmPackedParam8i & p = _param;
+            Array32i sums(_zero.size ? M : 0);
+            for (size_t i = 0; i < sums.size; ++i)
+            {
+                const uint8_t * a = A + i * lda;
+                int32_t sum = 0;
+                for (size_t k = 0; k < p.K; ++k)
+                    sum += a[k];
+                sums[i] = sum;
+            }
+            Post post;
+            post.comp = _comp.data;
+            post.zero = _zero.size ? _zero.data : NULL;
+            post.sums = sums.data;
+            post.scale = _scale.data;
+            post.shift = _shift.data;
+            _run(M, p.N, p.K, A, lda, _pB.data, C, ldc, post);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * Gemm8iPackedInit(size_t M, size_t N, size_t K, SimdTensorDataType dstT, SimdSynetCompatibilityType compatibility)
+        {
+            GemmPackedParam8i param(M, N, K, dstT, compatibility);
+            if (!param.Valid())
+                return NULL;
+            return new Gemm8iPackedNN(param);
+        }
+    }
+#endif
+}
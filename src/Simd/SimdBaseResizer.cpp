@@ -372,19 +372,9 @@ namespace Simd
                 float scale = (float)srcSize / dstSize;
                 for (size_t i = 0; i < dstSize; ++i)
                 {
-                    float alpha = (float)((i + 0.5f) * scale - 0.5f);
-                    ptrdiff_t index = (ptrdiff_t)::floor(alpha);
-                    alpha -= index;
-                    if (index < 0)
-                    {
-                        index = 0;
-                        alpha = 0;
-                    }
-                    if (index > (ptrdiff_t)srcSize - 2)
-                    {
-                        index = srcSize - 2;
-                        alpha = 1;
-                    }
+                    ptrdiff_t index;
+                    float alpha;
+                    BilinearIndexAlpha((i + 0.5f) * scale - 0.5f, srcSize, index, alpha);
                     for (size_t c = 0; c < channels; c++)
                     {
                         size_t offset = i * channels + c;
@@ -190,6 +190,26 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        void SynetCopyToStrided32f(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, float* dst, size_t dstStride)
+        {
+            for (size_t b = 0; b < batch; ++b)
+            {
+                if (format == SimdTensorFormatNhwc)
+                {
+                    for (size_t s = 0; s < spatial; ++s, src += channels, dst += dstStride)
+                        memcpy(dst, src, channels * sizeof(float));
+                }
+                else
+                {
+                    memcpy(dst, src, channels * spatial * sizeof(float));
+                    src += channels * spatial;
+                    dst += dstStride * spatial;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         template <SimdSynetEltwiseOperationType type> void SynetEltwiseLayerForward(float const * const * src, size_t count, size_t size, float * dst)
         {
             size_t aligned = Simd::AlignLo(size, 4);
@@ -377,6 +397,65 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        void SynetScaledDotProductAttention32f(size_t batch, size_t queries, size_t keys, size_t depth, size_t valueDepth,
+            const float* query, const float* key, const float* value, const float* scale, float* dst)
+        {
+            if (keys == 0)
+            {
+                memset(dst, 0, batch * queries * valueDepth * sizeof(float));
+                return;
+            }
+            float _scale = AttentionScale(depth, scale);
+            Array32f buf(ATTENTION_KEY_BLOCK + valueDepth);
+            float * score = buf.data, * sum = buf.data + ATTENTION_KEY_BLOCK;
+            for (size_t b = 0; b < batch; ++b)
+            {
+                for (size_t q = 0; q < queries; ++q)
+                {
+                    const float* pq = query + q * depth;
+                    float max = -FLT_MAX, norm = 0.0f;
+                    for (size_t d = 0; d < valueDepth; ++d)
+                        sum[d] = 0.0f;
+                    for (size_t k0 = 0; k0 < keys; k0 += ATTENTION_KEY_BLOCK)
+                    {
+                        size_t kn = Simd::Min(keys, k0 + ATTENTION_KEY_BLOCK) - k0;
+                        const float* pk = key + k0 * depth;
+                        float blockMax = max;
+                        for (size_t k = 0; k < kn; ++k, pk += depth)
+                        {
+                            float dot = 0.0f;
+                            for (size_t d = 0; d < depth; ++d)
+                                dot += pq[d] * pk[d];
+                            score[k] = dot * _scale;
+                            blockMax = Simd::Max(blockMax, score[k]);
+                        }
+                        float corr = ::exp(max - blockMax);
+                        norm *= corr;
+                        for (size_t d = 0; d < valueDepth; ++d)
+                            sum[d] *= corr;
+                        max = blockMax;
+                        const float* pv = value + k0 * valueDepth;
+                        for (size_t k = 0; k < kn; ++k, pv += valueDepth)
+                        {
+                            float p = ::exp(score[k] - max);
+                            norm += p;
+                            for (size_t d = 0; d < valueDepth; ++d)
+                                sum[d] += p * pv[d];
+                        }
+                    }
+                    float* pd = dst + q * valueDepth;
+                    for (size_t d = 0; d < valueDepth; ++d)
+                        pd[d] = sum[d] / norm;
+                }
+                query += queries * depth;
+                key += keys * depth;
+                value += keys * valueDepth;
+                dst += queries * valueDepth;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void SynetShuffleLayerForward(const float* src0, const float* src1, size_t channels0, size_t channels1, size_t spatial, float* dst0, float* dst1, SimdTensorFormatType format, int type)
         {
             size_t channels = (channels0 + channels1) / 2, size = sizeof(float) * spatial;
@@ -541,6 +620,50 @@ namespace Simd
             }
         }
 
+        void SynetLogSoftmaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst)
+        {
+            for (size_t o = 0; o < outer; ++o)
+            {
+                for (size_t i = 0; i < inner; ++i)
+                {
+                    const float* s = src + i;
+                    float* d = dst + i;
+                    float max = s[0];
+                    for (size_t c = 1; c < count; ++c)
+                        max = Simd::Max(max, s[c * inner]);
+                    float sum = 0;
+                    for (size_t c = 0; c < count; ++c)
+                        sum += ::exp(s[c * inner] - max);
+                    float shift = max + ::log(sum);
+                    for (size_t c = 0; c < count; ++c)
+                        d[c * inner] = s[c * inner] - shift;
+                }
+                src += count * inner;
+                dst += count * inner;
+            }
+        }
+
+        void SynetSoftmaxArgMaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst, uint32_t* index)
+        {
+            const float* s = src;
+            uint32_t* idx = index;
+            for (size_t o = 0; o < outer; ++o)
+            {
+                for (size_t i = 0; i < inner; ++i)
+                {
+                    size_t max = 0;
+                    for (size_t c = 1; c < count; ++c)
+                        if (s[c * inner + i] > s[max * inner + i])
+                            max = c;
+                    idx[i] = uint32_t(max);
+                }
+                s += count * inner;
+                idx += inner;
+            }
+            if (dst)
+                SynetSoftmaxLayerForward(src, outer, count, inner, dst);
+        }
+
         //---------------------------------------------------------------------
 
         template<SimdSynetUnaryOperation32fType type> void SynetUnaryOperation32fLayerForward(const float* src, size_t size, float* dst)
@@ -0,0 +1,135 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdBase.h"
+
+#include <vector>
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        void SynetBinaryOperation32fLayerForward(const float* a, const size_t* aShape, size_t aCount, const float* b, const size_t* bShape, size_t bCount,
+            float* dst, SynetBinaryOperation32fPtr vv, SynetBinaryOperation32fPtr vs, SynetBinaryOperation32fPtr sv)
+        {
+            std::vector<size_t> size, aStride, bStride;
+            std::vector<int> broadcast;
+            size_t aSize = 1, bSize = 1;
+            for (size_t i = 0, n = Simd::Max(aCount, bCount); i < n; ++i)
+            {
+                size_t aDim = i < aCount ? aShape[aCount - 1 - i] : 1;
+                size_t bDim = i < bCount ? bShape[bCount - 1 - i] : 1;
+                assert(aDim == bDim || aDim == 1 || bDim == 1);
+                size_t dim = Simd::Max(aDim, bDim);
+                if (dim > 1)
+                {
+                    int type = (aDim == 1 ? 1 : 0) | (bDim == 1 ? 2 : 0);
+                    if (broadcast.size() && broadcast.back() == type)
+                        size.back() *= dim;
+                    else
+                    {
+                        size.push_back(dim);
+                        aStride.push_back(aDim == 1 ? 0 : aSize);
+                        bStride.push_back(bDim == 1 ? 0 : bSize);
+                        broadcast.push_back(type);
+                    }
+                }
+                aSize *= aDim;
+                bSize *= bDim;
+            }
+            if (size.empty())
+            {
+                vv(a, b, 1, dst);
+                return;
+            }
+            SynetBinaryOperation32fPtr inner = broadcast[0] == 0 ? vv : (broadcast[0] == 1 ? sv : vs);
+            size_t count = size.size(), total = 1;
+            for (size_t i = 1; i < count; ++i)
+                total *= size[i];
+            std::vector<size_t> index(count, 0);
+            const float* pa = a, * pb = b;
+            for (size_t o = 0; o < total; ++o, dst += size[0])
+            {
+                inner(pa, pb, size[0], dst);
+                for (size_t i = 1; i < count; ++i)
+                {
+                    pa += aStride[i];
+                    pb += bStride[i];
+                    if (++index[i] < size[i])
+                        break;
+                    pa -= aStride[i] * size[i];
+                    pb -= bStride[i] * size[i];
+                    index[i] = 0;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<SimdSynetBinaryOperation32fType type> void SynetBinaryOperation32fVV(const float* a, const float* b, size_t size, float* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = SynetBinaryOperation32f<type>(a[i], b[i]);
+        }
+
+        template<SimdSynetBinaryOperation32fType type> void SynetBinaryOperation32fVS(const float* a, const float* b, size_t size, float* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = SynetBinaryOperation32f<type>(a[i], b[0]);
+        }
+
+        template<SimdSynetBinaryOperation32fType type> void SynetBinaryOperation32fSV(const float* a, const float* b, size_t size, float* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = SynetBinaryOperation32f<type>(a[0], b[i]);
+        }
+
+        template<SimdSynetBinaryOperation32fType type> void SynetBinaryOperation32fLayerForward(const float* a, const size_t* aShape, size_t aCount,
+            const float* b, const size_t* bShape, size_t bCount, float* dst)
+        {
+            SynetBinaryOperation32fLayerForward(a, aShape, aCount, b, bShape, bCount, dst,
+                SynetBinaryOperation32fVV<type>, SynetBinaryOperation32fVS<type>, SynetBinaryOperation32fSV<type>);
+        }
+
+        void SynetBinaryOperation32fLayerForward(const float* a, const size_t* aShape, size_t aCount, const float* b, const size_t* bShape, size_t bCount,
+            SimdSynetBinaryOperation32fType type, float* dst)
+        {
+            switch (type)
+            {
+            case SimdSynetBinaryOperation32fAdd: SynetBinaryOperation32fLayerForward<SimdSynetBinaryOperation32fAdd>(a, aShape, aCount, b, bShape, bCount, dst); break;
+            case SimdSynetBinaryOperation32fDiv: SynetBinaryOperation32fLayerForward<SimdSynetBinaryOperation32fDiv>(a, aShape, aCount, b, bShape, bCount, dst); break;
+            case SimdSynetBinaryOperation32fMax: SynetBinaryOperation32fLayerForward<SimdSynetBinaryOperation32fMax>(a, aShape, aCount, b, bShape, bCount, dst); break;
+            case SimdSynetBinaryOperation32fMin: SynetBinaryOperation32fLayerForward<SimdSynetBinaryOperation32fMin>(a, aShape, aCount, b, bShape, bCount, dst); break;
+            case SimdSynetBinaryOperation32fMul: SynetBinaryOperation32fLayerForward<SimdSynetBinaryOperation32fMul>(a, aShape, aCount, b, bShape, bCount, dst); break;
+            case SimdSynetBinaryOperation32fPow: SynetBinaryOperation32fLayerForward<SimdSynetBinaryOperation32fPow>(a, aShape, aCount, b, bShape, bCount, dst); break;
+            case SimdSynetBinaryOperation32fSub: SynetBinaryOperation32fLayerForward<SimdSynetBinaryOperation32fSub>(a, aShape, aCount, b, bShape, bCount, dst); break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif
+}
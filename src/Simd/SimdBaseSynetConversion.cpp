@@ -26,6 +26,8 @@
 #include "Simd/SimdConversion.h"
 #include "Simd/SimdSynet.h"
 
+#include <vector>
+
 namespace Simd
 {
 #if defined(SIMD_SYNET_ENABLE)
@@ -65,7 +67,23 @@ namespace Simd
                     }
                 }
                 else
-                    assert(0);
+                {
+                    size_t F = SynetTensorAlignment(format), spatial = height * width;
+                    for (size_t c = 0; c < channels; c += F)
+                    {
+                        size_t n = Simd::Min(channels, c + F) - c;
+                        for (size_t s = 0; s < spatial; ++s)
+                        {
+                            size_t i = 0;
+                            for (; i < n; ++i)
+                                dst[i] = SynetConvert32fTo8u(src[i], scale[c + i], shift[c + i], 0, upper);
+                            for (; i < F; ++i)
+                                dst[i] = 0;
+                            src += F;
+                            dst += F;
+                        }
+                    }
+                }
             }
         }
 
@@ -104,7 +122,23 @@ namespace Simd
                     }
                 }
                 else
-                    assert(0);
+                {
+                    size_t F = SynetTensorAlignment(format), spatial = height * width;
+                    for (size_t c = 0; c < channels; c += F)
+                    {
+                        size_t n = Simd::Min(channels, c + F) - c;
+                        for (size_t s = 0; s < spatial; ++s)
+                        {
+                            size_t i = 0;
+                            for (; i < n; ++i)
+                                dst[i] = SynetConvert8uTo32f(src[i], scale[c + i], shift[c + i]);
+                            for (; i < F; ++i)
+                                dst[i] = 0;
+                            src += F;
+                            dst += F;
+                        }
+                    }
+                }
             }
         }
 
@@ -233,25 +267,25 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
-        template<size_t N> SIMD_INLINE void Copy(const float * src, float * dst)
+        template<class T, size_t N> SIMD_INLINE void Copy(const T * src, T * dst)
         {
             for (size_t i = 0; i < N; ++i)
                 dst[i] = src[i];
         }
 
-        void SynetReorderImage_Chw_Hwc(size_t channels, size_t spatial, const float * src, float * dst)
+        template<class T> void SynetReorderImage_Chw_Hwc(size_t channels, size_t spatial, const T * src, T * dst)
         {
             for (size_t s = 0; s < spatial; ++s, src += 1, dst += channels)
                 for (size_t c = 0; c < channels; ++c)
                     dst[c] = src[c*spatial];
         }
 
-        template<size_t N> void SynetReorderImage_Chw_ChwXc(size_t channels, size_t spatial, const float * src, float * dst)
+        template<class T, size_t N> void SynetReorderImage_Chw_ChwXc(size_t channels, size_t spatial, const T * src, T * dst)
         {
             for (size_t c = 0; c < channels; c += N, src += N*spatial)
             {
                 size_t n = Simd::Min(channels, c + N) - c;
-                const float * ps = src;
+                const T * ps = src;
                 for (size_t s = 0; s < spatial; ++s, dst += N, ps += 1)
                 {
                     size_t i = 0;
@@ -263,24 +297,24 @@ namespace Simd
             }
         }
         
-        void SynetReorderImage_Hwc_Chw(size_t channels, size_t spatial, const float * src, float * dst)
+        template<class T> void SynetReorderImage_Hwc_Chw(size_t channels, size_t spatial, const T * src, T * dst)
         {
-            SynetReorderImage_Chw_Hwc(spatial, channels, src, dst);
+            SynetReorderImage_Chw_Hwc<T>(spatial, channels, src, dst);
         }
 
-        template<size_t N> void SynetReorderImage_Hwc_ChwXc(size_t channels, size_t spatial, const float * src, float * dst)
+        template<class T, size_t N> void SynetReorderImage_Hwc_ChwXc(size_t channels, size_t spatial, const T * src, T * dst)
         {
             size_t channelsN = AlignLo(channels, N);
             size_t tail = channels - channelsN;
             for (size_t c = 0; c < channelsN; c += N, src += N)
             {
-                const float * psrc = src;
+                const T * psrc = src;
                 for (size_t s = 0; s < spatial; ++s, psrc += channels, dst += N)
-                    Copy<N>(psrc, dst);
+                    Copy<T, N>(psrc, dst);
             }
             if(tail)
             {
-                const float * psrc = src;
+                const T * psrc = src;
                 for (size_t s = 0; s < spatial; ++s, psrc += channels, dst += N)
                 {
                     size_t i = 0;
@@ -292,11 +326,11 @@ namespace Simd
             }
         }
 
-        template<size_t N> void SynetReorderImage_ChwXc_Chw(size_t channels, size_t spatial, const float * src, float * dst)
+        template<class T, size_t N> void SynetReorderImage_ChwXc_Chw(size_t channels, size_t spatial, const T * src, T * dst)
         {
             for (size_t c = 0; c < channels; c += N, src += N * spatial)
             {
-                const float * ps = src;
+                const T * ps = src;
                 for (size_t i = 0, n = Simd::Min(channels, c + N) - c; i < n; ++i, ps += 1, dst += spatial)
                 {
                     for (size_t s = 0; s < spatial; ++s)
@@ -305,16 +339,16 @@ namespace Simd
             }
         }
 
-        template<size_t N> void SynetReorderImage_ChwXc_Hwc(size_t channels, size_t spatial, const float * src, float * dst)
+        template<class T, size_t N> void SynetReorderImage_ChwXc_Hwc(size_t channels, size_t spatial, const T * src, T * dst)
         {
             size_t stride = N * spatial;
             size_t channelsN = AlignLo(channels, N);
             size_t tail = channels - channelsN;
             for (size_t s = 0; s < spatial; ++s, src += N)
             {
-                const float * psrc = src;
+                const T * psrc = src;
                 for (size_t c = 0; c < channelsN; c += N, psrc += stride, dst += N)
-                    Copy<N>(psrc, dst);
+                    Copy<T, N>(psrc, dst);
                 if (tail)
                 {
                     for (size_t i = 0; i < tail; ++i)
@@ -323,64 +357,68 @@ namespace Simd
             }
         }
 
-        typedef void(*SynetImageConverterPtr)(size_t channels, size_t spatial, const float * src, float * dst);
-        SynetImageConverterPtr GetImageConverter(SimdTensorFormatType src, SimdTensorFormatType dst)
+        template<class T> struct SynetImageConverter
+        {
+            typedef void(*Ptr)(size_t channels, size_t spatial, const T * src, T * dst);
+        };
+
+        template<class T> typename SynetImageConverter<T>::Ptr GetImageConverter(SimdTensorFormatType src, SimdTensorFormatType dst)
         {
             if (src == SimdTensorFormatNchw)
             {
                 if(dst == SimdTensorFormatNhwc)
-                    return SynetReorderImage_Chw_Hwc;
+                    return SynetReorderImage_Chw_Hwc<T>;
                 if (dst == SimdTensorFormatNchw4c)
-                    return SynetReorderImage_Chw_ChwXc<4>;
+                    return SynetReorderImage_Chw_ChwXc<T, 4>;
                 if (dst == SimdTensorFormatNchw8c)
-                    return SynetReorderImage_Chw_ChwXc<8>;
+                    return SynetReorderImage_Chw_ChwXc<T, 8>;
                 if (dst == SimdTensorFormatNchw16c)
-                    return SynetReorderImage_Chw_ChwXc<16>;
+                    return SynetReorderImage_Chw_ChwXc<T, 16>;
             }
             if (src == SimdTensorFormatNhwc)
             {
                 if(dst == SimdTensorFormatNchw)
-                    return SynetReorderImage_Hwc_Chw;
+                    return SynetReorderImage_Hwc_Chw<T>;
                 if (dst == SimdTensorFormatNchw4c)
-                    return SynetReorderImage_Hwc_ChwXc<4>;
+                    return SynetReorderImage_Hwc_ChwXc<T, 4>;
                 if (dst == SimdTensorFormatNchw8c)
-                    return SynetReorderImage_Hwc_ChwXc<8>;
+                    return SynetReorderImage_Hwc_ChwXc<T, 8>;
                 if (dst == SimdTensorFormatNchw16c)
-                    return SynetReorderImage_Hwc_ChwXc<16>;
+                    return SynetReorderImage_Hwc_ChwXc<T, 16>;
             }
             if (src == SimdTensorFormatNchw4c)
             {
                 if (dst == SimdTensorFormatNchw)
-                    return SynetReorderImage_ChwXc_Chw<4>;
+                    return SynetReorderImage_ChwXc_Chw<T, 4>;
                 if (dst == SimdTensorFormatNhwc)
-                    return SynetReorderImage_ChwXc_Hwc<4>;
+                    return SynetReorderImage_ChwXc_Hwc<T, 4>;
             }
             if (src == SimdTensorFormatNchw8c)
             {
                 if (dst == SimdTensorFormatNchw)
-                    return SynetReorderImage_ChwXc_Chw<8>;
+                    return SynetReorderImage_ChwXc_Chw<T, 8>;
                 if (dst == SimdTensorFormatNhwc)
-                    return SynetReorderImage_ChwXc_Hwc<8>;
+                    return SynetReorderImage_ChwXc_Hwc<T, 8>;
             }
             if (src == SimdTensorFormatNchw16c)
             {
                 if (dst == SimdTensorFormatNchw)
-                    return SynetReorderImage_ChwXc_Chw<16>;
+                    return SynetReorderImage_ChwXc_Chw<T, 16>;
                 if (dst == SimdTensorFormatNhwc)
-                    return SynetReorderImage_ChwXc_Hwc<16>;
+                    return SynetReorderImage_ChwXc_Hwc<T, 16>;
             }
             return NULL;
         }
 
-        void SynetReorderImage(size_t batch, size_t channels, size_t spatial, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat)
+        template<class T> void SynetReorderImage(size_t batch, size_t channels, size_t spatial, const T * src, SimdTensorFormatType srcFormat, T * dst, SimdTensorFormatType dstFormat)
         {
-            SynetImageConverterPtr imageConverter = GetImageConverter(srcFormat, dstFormat);
+            typename SynetImageConverter<T>::Ptr imageConverter = GetImageConverter<T>(srcFormat, dstFormat);
             size_t srcStride = AlignHi(channels, SynetTensorAlignment(srcFormat))*spatial;
             size_t dstStride = AlignHi(channels, SynetTensorAlignment(dstFormat))*spatial;
             for (size_t n = 0; n < batch; ++n)
             {
                 if (srcFormat == dstFormat)
-                    memcpy(dst, src, srcStride*sizeof(float));
+                    memcpy(dst, src, srcStride*sizeof(T));
                 else
                 {
                     assert(imageConverter);
@@ -391,6 +429,16 @@ namespace Simd
             }
         }
 
+        void SynetReorderImage(size_t batch, size_t channels, size_t spatial, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat)
+        {
+            SynetReorderImage<float>(batch, channels, spatial, src, srcFormat, dst, dstFormat);
+        }
+
+        void SynetReorderImage8u(size_t batch, size_t channels, size_t spatial, const uint8_t * src, SimdTensorFormatType srcFormat, uint8_t * dst, SimdTensorFormatType dstFormat)
+        {
+            SynetReorderImage<uint8_t>(batch, channels, spatial, src, srcFormat, dst, dstFormat);
+        }
+
         //---------------------------------------------------------------------
 
         void SynetReorderFilter_Oiyx_Yxio(size_t output, size_t input, size_t kernel, const float * src, float * dst)
@@ -439,7 +487,7 @@ namespace Simd
                 const float * psrc = src;
                 for (size_t k = 0; k < kernel; ++k)
                     for (size_t i = 0; i < input; ++i, dst += N, psrc += output)
-                        Copy<N>(psrc, dst);
+                        Copy<float, N>(psrc, dst);
             }
             if(outputN < output)
             {
@@ -484,7 +532,7 @@ namespace Simd
                 {
                     const float * psrc = src;
                     for (size_t o = 0; o < outputN; o += N, psrc += stride, dst += N)
-                        Copy<N>(psrc, dst);
+                        Copy<float, N>(psrc, dst);
                     if(outputN < output)
                     {
                         for (size_t j = 0; j < tail; ++j)
@@ -555,6 +603,97 @@ namespace Simd
             assert(filterConverter);
             filterConverter(output, input, kernel, src, dst);
         }
+
+        //---------------------------------------------------------------------
+
+        static void SynetPermuteTranspose(const float* src, size_t srcStride, size_t rows, size_t cols, float* dst, size_t dstStride)
+        {
+            for (size_t r0 = 0; r0 < rows; r0 += SYNET_PERMUTE_TILE)
+            {
+                size_t r1 = Simd::Min(r0 + SYNET_PERMUTE_TILE, rows);
+                for (size_t c0 = 0; c0 < cols; c0 += SYNET_PERMUTE_TILE)
+                {
+                    size_t c1 = Simd::Min(c0 + SYNET_PERMUTE_TILE, cols);
+                    for (size_t c = c0; c < c1; ++c)
+                        for (size_t r = r0; r < r1; ++r)
+                            dst[r * dstStride + c] = src[c * srcStride + r];
+                }
+            }
+        }
+
+        void SynetPermute32f(const float* src, const size_t* shape, const size_t* order, size_t count, float* dst, SynetPermuteTransposePtr transpose)
+        {
+            std::vector<size_t> srcStride(count, 1);
+            for (ptrdiff_t i = count - 2; i >= 0; --i)
+                srcStride[i] = srcStride[i + 1] * shape[i + 1];
+
+            std::vector<size_t> size, sStride;
+            for (size_t i = 0; i < count; ++i)
+            {
+                size_t axis = order[i];
+                assert(axis < count);
+                if (shape[axis] == 1)
+                    continue;
+                if (size.size() && sStride.back() == srcStride[axis] * shape[axis])
+                {
+                    size.back() *= shape[axis];
+                    sStride.back() = srcStride[axis];
+                }
+                else
+                {
+                    size.push_back(shape[axis]);
+                    sStride.push_back(srcStride[axis]);
+                }
+            }
+            size_t dims = size.size();
+            if (dims <= 1)
+            {
+                memcpy(dst, src, (dims ? size[0] : 1) * sizeof(float));
+                return;
+            }
+            std::vector<size_t> dStride(dims, 1);
+            for (ptrdiff_t i = dims - 2; i >= 0; --i)
+                dStride[i] = dStride[i + 1] * size[i + 1];
+
+            size_t last = dims - 1, inner = last;
+            if (sStride[last] != 1)
+            {
+                for (inner = 0; sStride[inner] != 1; ++inner);
+            }
+            std::vector<size_t> outer;
+            for (size_t i = 0; i < last; ++i)
+                if (i != inner)
+                    outer.push_back(i);
+
+            size_t total = 1;
+            for (size_t i = 0; i < outer.size(); ++i)
+                total *= size[outer[i]];
+            std::vector<size_t> index(outer.size(), 0);
+            for (size_t o = 0; o < total; ++o)
+            {
+                size_t srcOffset = 0, dstOffset = 0;
+                for (size_t i = 0; i < outer.size(); ++i)
+                {
+                    srcOffset += index[i] * sStride[outer[i]];
+                    dstOffset += index[i] * dStride[outer[i]];
+                }
+                if (inner == last)
+                    memcpy(dst + dstOffset, src + srcOffset, size[last] * sizeof(float));
+                else
+                    transpose(src + srcOffset, sStride[last], size[inner], size[last], dst + dstOffset, dStride[inner]);
+                for (ptrdiff_t i = outer.size() - 1; i >= 0; --i)
+                {
+                    if (++index[i] < size[outer[i]])
+                        break;
+                    index[i] = 0;
+                }
+            }
+        }
+
+        void SynetPermute32f(const float* src, const size_t* shape, const size_t* order, size_t count, float* dst)
+        {
+            SynetPermute32f(src, shape, order, count, dst, SynetPermuteTranspose);
+        }
     }
 #endif
 }
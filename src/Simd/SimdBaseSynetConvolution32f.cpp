@@ -40,6 +40,19 @@ namespace Simd
     }
 #endif
 
+    void SynetConvolution32f::ForwardStrided(const float * src, float * buf, float * dst, size_t dstStride)
+    {
+        const ConvParam32f & p = _param;
+        if (dstStride == p.dstC)
+            Forward(src, buf, dst);
+        else
+        {
+            _strided.Resize(p.SizeD());
+            Forward(src, buf, _strided.data);
+            Base::SynetCopyToStrided32f(_strided.data, p.batch, p.dstC, p.dstH * p.dstW, p.trans ? SimdTensorFormatNhwc : SimdTensorFormatNchw, dst, dstStride);
+        }
+    }
+
     namespace Base
     {
         void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst)
@@ -903,7 +916,7 @@ namespace Simd
                         if (_batch % merge == 0 && _M * merge <= 128)
                             _merge = merge;
                 }
-                if (_merge == 1 && _blockY == 4)
+                if (_merge == 1 && _blockY >= 4)
                 {
                     size_t cacheL2 = Base::AlgCacheL2() / sizeof(float);
                     size_t cacheL3 = Base::AlgCacheL3() / sizeof(float);
@@ -1387,7 +1400,7 @@ namespace Simd
             _sizeS = p.srcC*p.srcH*p.srcW;
             _sizeD = p.dstC*p.dstH*p.dstW;
             _old.enable = false;
-            if (p.IsDilation(1))
+            if (p.IsDilation(1) && p.group == 1)
             {
                 if (p.srcC <= 3)
                     _old.enable = true;
@@ -1490,26 +1503,32 @@ namespace Simd
 
         void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst)
         {
-            for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
+            for (size_t g = 0; g < p.group; ++g)
             {
-                size_t macroD = Simd::Min(p.dstC, dc + a.macroD) - dc;
-                for (size_t sc = 0; sc < p.srcC; sc += a.macroC)
+                for (size_t dc = 0; dc < a.dstC; dc += a.macroD)
                 {
-                    size_t macroC = Simd::Min(p.srcC, sc + a.macroC) - sc;
-                    for (size_t yBeg = 0; yBeg < p.dstH;)
+                    size_t macroD = Simd::Min(a.dstC, dc + a.macroD) - dc;
+                    for (size_t sc = 0; sc < a.srcC; sc += a.macroC)
                     {
-                        size_t yEnd = Simd::Min(yBeg + a.macroH, p.dstH);
-                        if (sc + macroC == p.srcC)
-                            a.convolutions[TermLast](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, macroC == p.srcC ? 1 : 0);
-                        else
-                            a.convolutions[TermInterim](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, sc == 0 ? 1 : 0);
-                        yBeg = yEnd;
+                        size_t macroC = Simd::Min(a.srcC, sc + a.macroC) - sc;
+                        for (size_t yBeg = 0; yBeg < p.dstH;)
+                        {
+                            size_t yEnd = Simd::Min(yBeg + a.macroH, p.dstH);
+                            if (sc + macroC == a.srcC)
+                                a.convolutions[TermLast](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, macroC == a.srcC ? 1 : 0);
+                            else
+                                a.convolutions[TermInterim](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, sc == 0 ? 1 : 0);
+                            yBeg = yEnd;
+                        }
+                        weight += a.F * macroC;
                     }
-                    weight += a.F * macroC;
+                    if (p.activation == ::SimdConvolutionActivationPrelu)
+                        params += macroD;
+                    weight += p.kernelY * p.kernelX * a.srcC * AlignHiAny(macroD, a.F) - a.srcC * a.F;
                 }
-                if (p.activation == ::SimdConvolutionActivationPrelu)
-                    params += macroD;
-                weight += p.kernelY * p.kernelY * p.srcC * macroD - p.srcC * a.F;
+                src += a.srcC;
+                bias += a.dstC;
+                dst += a.dstC;
             }
         }
 
@@ -1518,7 +1537,9 @@ namespace Simd
             const ConvParam32f& p = _param;
             alg.F = F;
             alg.microD = F*N;
-            alg.macroC = Simd::Min(Base::AlgCacheL1() / sizeof(float) / p.kernelY / p.kernelX / alg.microD, p.srcC);
+            alg.srcC = p.srcC / p.group;
+            alg.dstC = p.dstC / p.group;
+            alg.macroC = Simd::Min(Base::AlgCacheL1() / sizeof(float) / p.kernelY / p.kernelX / alg.microD, alg.srcC);
             for (size_t macroH = p.dstH; macroH >= 1; macroH--)
             {
                 alg.macroH = macroH;
@@ -1526,12 +1547,13 @@ namespace Simd
                     break;
             }
             alg.macroD = Simd::RestrictRange(AlignLoAny(Base::AlgCacheL3() / sizeof(float) / p.kernelY / p.kernelX / alg.macroC, alg.microD), 
-                alg.microD, AlignHiAny(p.dstC, alg.microD));
-            alg.stepW = p.kernelY * p.kernelX * p.srcC * alg.F;
-            _rWeight.Resize(DivHi(p.dstC, alg.F)*alg.stepW);
-            _rBias.Resize(AlignHiAny(p.dstC, alg.F), true);
+                alg.microD, AlignHiAny(alg.dstC, alg.microD));
+            alg.stepW = p.kernelY * p.kernelX * alg.srcC * alg.F;
+            _rWeight.Resize(DivHi(alg.dstC, alg.F) * alg.stepW * p.group);
+            size_t sizeB = p.dstC - alg.dstC + AlignHiAny(alg.dstC, alg.F);
+            _rBias.Resize(sizeB, true);
             if (p.activation == SimdConvolutionActivationLeakyRelu || p.activation == SimdConvolutionActivationPrelu)
-                _rParams.Resize(AlignHiAny(p.dstC, alg.F), true);
+                _rParams.Resize(sizeB, true);
             else
                 _rParams.Resize(2, true);
         }
@@ -1540,26 +1562,29 @@ namespace Simd
         {
             const ConvParam32f& p = _param;
             const AlgParam & a = _run.At(0).alg;
-            for (size_t dc = 0; dc < p.dstC; dc += a.F)
+            for (size_t g = 0; g < p.group; ++g)
             {
-                size_t F = Simd::Min(p.dstC, dc + a.F) - dc;
-                const float* psrc = src;
-                for (size_t ky = 0; ky < p.kernelY; ++ky)
+                for (size_t dc = 0; dc < a.dstC; dc += a.F)
                 {
-                    for (size_t kx = 0; kx < p.kernelX; ++kx)
+                    size_t F = Simd::Min(a.dstC, dc + a.F) - dc;
+                    const float* psrc = src + dc;
+                    for (size_t ky = 0; ky < p.kernelY; ++ky)
                     {
-                        for (size_t sc = 0; sc < p.srcC; ++sc)
+                        for (size_t kx = 0; kx < p.kernelX; ++kx)
                         {
-                            size_t f = 0;
-                            for (; f < F; ++f)
-                                *(dst++) = psrc[f];
-                            for (; f < a.F; ++f)
-                                *(dst++) = 0.0f;
-                            psrc += p.dstC;
+                            for (size_t sc = 0; sc < a.srcC; ++sc)
+                            {
+                                size_t f = 0;
+                                for (; f < F; ++f)
+                                    *(dst++) = psrc[f];
+                                for (; f < a.F; ++f)
+                                    *(dst++) = 0.0f;
+                                psrc += p.dstC;
+                            }
                         }
                     }
                 }
-                src += F;
+                src += a.dstC;
             }
         }
 
@@ -1629,13 +1654,10 @@ namespace Simd
 
 //#define SIMD_BASE_ONLY_GEMM_NN
 
-        void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
+        static SynetConvolution32f * SynetConvolution32fDenseInit(const ConvParam32f & param)
         {
-            ConvParam32f param(batch, conv, gemm);
-            if (!param.Valid())
-                return NULL;
 #if !defined(SIMD_BASE_ONLY_GEMM_NN)
-            else if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
+            if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
                 return new SynetConvolution32fDepthwiseDotProduct(param);
             else if(SynetConvolution32fWinograd::Preferable(param))
                 return new SynetConvolution32fWinograd(param);
@@ -1647,10 +1669,30 @@ namespace Simd
                 return new SynetConvolution32fNhwcDirect(param);
             else if (SynetConvolution32fDirectNhwc::Preferable(param))
                 return new SynetConvolution32fDirectNhwc(param);
-#endif
             else
+#endif
                 return new SynetConvolution32fGemmNN(param);
         }
+
+        void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
+        {
+            ConvParam32f param(batch, conv, gemm);
+            if (!param.Valid())
+                return NULL;
+            else if (SynetConvolution32fSparse::Preferable(param))
+                return new SynetConvolution32fSparse(param, SynetConvolution32fDenseInit(param));
+            else
+                return SynetConvolution32fDenseInit(param);
+        }
+
+        void * SynetConvolution32fInitV2(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType)
+        {
+            ConvParam32f param(batch, conv, gemm);
+            if (param.Valid() && SynetConvolution32fProd16::Preferable(param, weightType))
+                return new SynetConvolution32fProd16(param, weightType);
+            else
+                return SynetConvolution32fInit(batch, conv, gemm);
+        }
     }
 #endif
 }
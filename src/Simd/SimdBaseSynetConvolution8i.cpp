@@ -626,6 +626,10 @@ namespace Simd
             ConvParam8i param(batch, conv, compatibility);
             if (!param.Valid())
                 return NULL;
+            else if (SynetConvolution8iNchwcDepthwise::Preferable(param))
+                return new SynetConvolution8iNchwcDepthwise(param);
+            else if (SynetConvolution8iNchwcDirect::Preferable(param))
+                return new SynetConvolution8iNchwcDirect(param);
 #if !defined(SIMD_BASE_ONLY_GEMM_NN)
             else if (SynetConvolution8iNhwcDepthwise::Preferable(param))
                 return new SynetConvolution8iNhwcDepthwise(param);
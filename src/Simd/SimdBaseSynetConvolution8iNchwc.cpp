@@ -0,0 +1,343 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution8i.h"
+#include "Simd/SimdSynetConvolution8iCommon.h"
+#include "Simd/SimdSynetConvolution32fCommon.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        using AlgParam = SynetConvolution8iNchwcDirect::AlgParam;
+        using ConvolutionPtr = SynetConvolution8iNchwcDirect::ConvolutionPtr;
+
+        template<SimdConvolutionActivationType type> SIMD_INLINE void SaveNchwc(const int32_t* sum, const AlgParam& a, size_t tail, 
+            const float* norm, const float* bias, const float* params, const float* scale, const float* shift, uint8_t* dst)
+        {
+            if (a.size == 1)
+            {
+                size_t f = 0;
+                for (; f < tail; ++f)
+                    dst[f] = SynetConvert32fTo8u(Activate<type>(float(sum[f]) * norm[f] + bias[f], params, f), scale[f], shift[f], 0, a.upper);
+                for (; f < a.F; ++f)
+                    dst[f] = 0;
+            }
+            else
+            {
+                float* dst32f = (float*)dst;
+                size_t f = 0;
+                for (; f < tail; ++f)
+                    dst32f[f] = Activate<type>(float(sum[f]) * norm[f] + bias[f], params, f);
+                for (; f < a.F; ++f)
+                    dst32f[f] = 0;
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void ConvolutionNchwcDirect(const uint8_t* src, const ConvParam8i& p, const AlgParam& a,
+            const int8_t* weight, const float* norm, const float* bias, const float* params, const float* scale, const float* shift, uint8_t* dst)
+        {
+            size_t F = a.F, CB = DivHi(p.srcC, F), DB = DivHi(p.dstC, F), srcP = p.srcH * p.srcW * F, dD = F * a.size;
+            int32_t sum[16];
+            for (size_t db = 0; db < DB; ++db)
+            {
+                size_t tail = Simd::Min(F, p.dstC - db * F);
+                for (size_t dy = 0; dy < p.dstH; ++dy)
+                {
+                    for (size_t dx = 0; dx < p.dstW; ++dx, dst += dD)
+                    {
+                        for (size_t f = 0; f < F; ++f)
+                            sum[f] = 0;
+                        const int8_t* pw = weight;
+                        for (size_t cb = 0; cb < CB; ++cb)
+                        {
+                            for (size_t ky = 0; ky < p.kernelY; ++ky)
+                            {
+                                size_t sy = dy * p.strideY + ky * p.dilationY;
+                                for (size_t kx = 0; kx < p.kernelX; ++kx)
+                                {
+                                    size_t sx = dx * p.strideX + kx * p.dilationX;
+                                    const uint8_t* ps = src + cb * srcP + (sy * p.srcW + sx) * F;
+                                    for (size_t c = 0; c < F; c += 4)
+                                        for (size_t f = 0; f < F; ++f, pw += 4)
+                                            sum[f] += ps[c + 0] * pw[0] + ps[c + 1] * pw[1] + ps[c + 2] * pw[2] + ps[c + 3] * pw[3];
+                                }
+                            }
+                        }
+                        SaveNchwc<type>(sum, a, tail, norm, bias, params, scale, shift, dst);
+                    }
+                }
+                weight += CB * p.kernelY * p.kernelX * F * F;
+                norm += F;
+                bias += F;
+                if (type == SimdConvolutionActivationPrelu)
+                    params += F;
+                scale += F;
+                shift += F;
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void ConvolutionNchwcDepthwise(const uint8_t* src, const ConvParam8i& p, const AlgParam& a,
+            const int8_t* weight, const float* norm, const float* bias, const float* params, const float* scale, const float* shift, uint8_t* dst)
+        {
+            size_t F = a.F, CB = DivHi(p.srcC, F), srcP = p.srcH * p.srcW * F, dD = F * a.size;
+            int32_t sum[16];
+            for (size_t cb = 0; cb < CB; ++cb)
+            {
+                size_t tail = Simd::Min(F, p.dstC - cb * F);
+                for (size_t dy = 0; dy < p.dstH; ++dy)
+                {
+                    for (size_t dx = 0; dx < p.dstW; ++dx, dst += dD)
+                    {
+                        for (size_t f = 0; f < F; ++f)
+                            sum[f] = 0;
+                        const int8_t* pw = weight;
+                        for (size_t ky = 0; ky < p.kernelY; ++ky)
+                        {
+                            size_t sy = dy * p.strideY + ky * p.dilationY;
+                            for (size_t kx = 0; kx < p.kernelX; ++kx, pw += F)
+                            {
+                                size_t sx = dx * p.strideX + kx * p.dilationX;
+                                const uint8_t* ps = src + (sy * p.srcW + sx) * F;
+                                for (size_t f = 0; f < F; ++f)
+                                    sum[f] += ps[f] * pw[f];
+                            }
+                        }
+                        SaveNchwc<type>(sum, a, tail, norm, bias, params, scale, shift, dst);
+                    }
+                }
+                src += srcP;
+                weight += p.kernelY * p.kernelX * F;
+                norm += F;
+                bias += F;
+                if (type == SimdConvolutionActivationPrelu)
+                    params += F;
+                scale += F;
+                shift += F;
+            }
+        }
+
+        template<SimdConvolutionActivationType type> ConvolutionPtr GetConvolution(bool depthwise)
+        {
+            return depthwise ? ConvolutionNchwcDepthwise<type> : ConvolutionNchwcDirect<type>;
+        }
+
+        ConvolutionPtr GetConvolution(SimdConvolutionActivationType activation, bool depthwise)
+        {
+            switch (activation)
+            {
+            case SimdConvolutionActivationIdentity: return GetConvolution<SimdConvolutionActivationRestrictRange>(depthwise);
+            case SimdConvolutionActivationRelu: return GetConvolution<SimdConvolutionActivationRestrictRange>(depthwise);
+            case SimdConvolutionActivationLeakyRelu: return GetConvolution<SimdConvolutionActivationPrelu>(depthwise);
+            case SimdConvolutionActivationRestrictRange: return GetConvolution<SimdConvolutionActivationRestrictRange>(depthwise);
+            case SimdConvolutionActivationPrelu: return GetConvolution<SimdConvolutionActivationPrelu>(depthwise);
+            case SimdConvolutionActivationElu: return GetConvolution<SimdConvolutionActivationElu>(depthwise);
+            case SimdConvolutionActivationHswish: return GetConvolution<SimdConvolutionActivationHswish>(depthwise);
+            case SimdConvolutionActivationMish: return GetConvolution<SimdConvolutionActivationMish>(depthwise);
+            case SimdConvolutionActivationHardSigmoid: return GetConvolution<SimdConvolutionActivationHardSigmoid>(depthwise);
+            default:
+                assert(0);
+                return NULL;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        static void PadParams(Array32f & params, size_t size, size_t padded)
+        {
+            Array32f buffer(padded, true);
+            memcpy(buffer.data, params.data, size * sizeof(float));
+            params.Swap(buffer);
+        }
+
+        SynetConvolution8iNchwcDirect::SynetConvolution8iNchwcDirect(const ConvParam8i& p)
+            : SynetConvolution8i(p)
+        {
+            _alg.F = SynetTensorAlignment(p.srcF);
+            _alg.size = (p.dstT == SimdTensorData32f ? 4 : 1);
+            _sizeS = AlignHi(p.srcC, _alg.F) * p.srcH * p.srcW;
+            _sizeD = AlignHi(p.dstC, _alg.F) * p.dstH * p.dstW;
+            if (p.padY || p.padX || p.padH || p.padW)
+            {
+                _paramP = p;
+                _paramP.srcH = p.srcH + p.padY + p.padH;
+                _paramP.srcW = p.srcW + p.padX + p.padW;
+                _paramP.padY = 0;
+                _paramP.padX = 0;
+                _paramP.padH = 0;
+                _paramP.padW = 0;
+                _sizeP = AlignHi(p.srcC, _alg.F) * _paramP.srcH * _paramP.srcW;
+            }
+            else
+                _sizeP = 0;
+            _convolution = GetConvolution(p.activation, false);
+        }
+
+        String SynetConvolution8iNchwcDirect::Desc() const
+        {
+            const ConvParam8i& p = _param;
+            return Ext() + "::NchwcDirect" + (Overflow(p.compatibility) ? "-o" : (Narrowed(p.compatibility) ? "-n" : "-p"));
+        }
+
+        size_t SynetConvolution8iNchwcDirect::ExternalBufferSize() const
+        {
+            size_t size = SynetConvolution8i::ExternalBufferSize();
+            if (_sizeP)
+                size += AlignHi(_sizeP * sizeof(uint8_t), SIMD_ALIGN);
+            return size;
+        }
+
+        void SynetConvolution8iNchwcDirect::SetParams(const float* weight, const float* bias, const float* params, const float* const* stats)
+        {
+            const ConvParam8i& p = _param;
+            SynetConvolution8i::SetParams(weight, bias, params, stats);
+            ReorderWeight();
+            size_t dstC = AlignHi(p.dstC, _alg.F);
+            PadParams(_norm, p.dstC, dstC);
+            PadParams(_bias, p.dstC, dstC);
+            PadParams(_dstCvt.scale, p.dstC, dstC);
+            PadParams(_dstCvt.shift, p.dstC, dstC);
+            if (_params.size == p.dstC)
+                PadParams(_params, p.dstC, dstC);
+            _alg.zero = _srcCvt.zero[0];
+            _alg.upper = _dstCvt.uMax;
+        }
+
+        bool SynetConvolution8iNchwcDirect::Preferable(const ConvParam8i& p)
+        {
+            return p.IsNchwXc() && p.group == 1;
+        }
+
+        void SynetConvolution8iNchwcDirect::ReorderWeight()
+        {
+            const ConvParam8i& p = _param;
+            size_t F = _alg.F, K = p.kernelY * p.kernelX, CB = DivHi(p.srcC, F), DB = DivHi(p.dstC, F);
+            Array8i weight(DB * CB * K * F * F);
+            int8_t* dst = weight.data;
+            for (size_t db = 0; db < DB; ++db)
+            {
+                for (size_t cb = 0; cb < CB; ++cb)
+                {
+                    for (size_t k = 0; k < K; ++k)
+                    {
+                        for (size_t c = 0; c < F; c += 4)
+                        {
+                            for (size_t f = 0; f < F; ++f)
+                            {
+                                size_t d = db * F + f;
+                                for (size_t i = 0; i < 4; ++i)
+                                {
+                                    size_t s = cb * F + c + i;
+                                    if (d < p.dstC && s < p.srcC)
+                                        *(dst++) = _weight[(d * p.srcC + s) * K + k];
+                                    else
+                                        *(dst++) = 0;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+            _weight.Swap(weight);
+        }
+
+        void SynetConvolution8iNchwcDirect::PadInput(const uint8_t* src, uint8_t* dst)
+        {
+            const ConvParam8i& p = _param;
+            size_t F = _alg.F, CB = DivHi(p.srcC, F), dstW = _paramP.srcW * F;
+            size_t nose = p.padX * F, body = p.srcW * F, tail = p.padW * F;
+            for (size_t cb = 0; cb < CB; ++cb)
+            {
+                memset(dst, _alg.zero, p.padY * dstW), dst += p.padY * dstW;
+                for (size_t y = 0; y < p.srcH; ++y)
+                {
+                    memset(dst, _alg.zero, nose), dst += nose;
+                    memcpy(dst, src, body), src += body, dst += body;
+                    memset(dst, _alg.zero, tail), dst += tail;
+                }
+                memset(dst, _alg.zero, p.padH * dstW), dst += p.padH * dstW;
+            }
+        }
+
+        void SynetConvolution8iNchwcDirect::Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        {
+            uint8_t* pad = _sizeP ? Allocate<uint8_t>(buf, _sizeP) : NULL;
+            for (size_t m = 0; m < _merge; ++m)
+            {
+                if (_sizeP)
+                {
+                    PadInput(src, pad);
+                    _convolution(pad, _paramP, _alg, _weight.data, _norm.data, _bias.data, _params.data, _dstCvt.scale.data, _dstCvt.shift.data, dst);
+                }
+                else
+                    _convolution(src, _param, _alg, _weight.data, _norm.data, _bias.data, _params.data, _dstCvt.scale.data, _dstCvt.shift.data, dst);
+                src += _sizeS;
+                dst += _sizeD * _alg.size;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetConvolution8iNchwcDepthwise::SynetConvolution8iNchwcDepthwise(const ConvParam8i& p)
+            : SynetConvolution8iNchwcDirect(p)
+        {
+            _convolution = GetConvolution(p.activation, true);
+        }
+
+        String SynetConvolution8iNchwcDepthwise::Desc() const
+        {
+            const ConvParam8i& p = _param;
+            return Ext() + "::NchwcDepthwise" + (Overflow(p.compatibility) ? "-o" : (Narrowed(p.compatibility) ? "-n" : "-p"));
+        }
+
+        bool SynetConvolution8iNchwcDepthwise::Preferable(const ConvParam8i& p)
+        {
+            return p.IsNchwXc() && p.IsDepthwise();
+        }
+
+        void SynetConvolution8iNchwcDepthwise::ReorderWeight()
+        {
+            const ConvParam8i& p = _param;
+            size_t F = _alg.F, K = p.kernelY * p.kernelX, CB = DivHi(p.srcC, F);
+            Array8i weight(CB * K * F);
+            int8_t* dst = weight.data;
+            for (size_t cb = 0; cb < CB; ++cb)
+            {
+                for (size_t k = 0; k < K; ++k)
+                {
+                    for (size_t f = 0; f < F; ++f)
+                    {
+                        size_t c = cb * F + f;
+                        *(dst++) = c < p.srcC ? _weight[c * K + k] : 0;
+                    }
+                }
+            }
+            _weight.Swap(weight);
+        }
+    }
+#endif
+}
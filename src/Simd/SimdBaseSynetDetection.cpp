@@ -0,0 +1,179 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdSynetDetection.h"
+#include "Simd/SimdBase.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        namespace
+        {
+            struct Candidate
+            {
+                float score;
+                int32_t index;
+                size_t label;
+
+                Candidate(float s = 0.0f, int32_t i = 0, size_t l = 0) : score(s), index(i), label(l) {}
+            };
+
+            SIMD_INLINE bool ScoreGreater(const Candidate& a, const Candidate& b)
+            {
+                return a.score > b.score;
+            }
+
+            SIMD_INLINE bool LabelLesser(const Candidate& a, const Candidate& b)
+            {
+                return a.label < b.label;
+            }
+        }
+
+        size_t SynetDetectionOutput32f(const float* boxes, const float* scores, size_t count, size_t classes, size_t background, float confidence,
+            float overlap, size_t topK, size_t keepTopK, DetectionSelectPtr select, DetectionOverlapsPtr overlaps, float* dst)
+        {
+            size_t capacity = topK ? Simd::Min(topK, count) : count, stride = AlignHi(capacity, 16);
+            Array32i index(count);
+            Array32f score(count), kept(stride * 5, true);
+            std::vector<Candidate> candidates, detections;
+            candidates.reserve(count);
+            for (size_t c = 0; c < classes; ++c)
+            {
+                if (c == background)
+                    continue;
+                size_t size = select(scores + c * count, count, confidence, index.data, score.data);
+                if (size == 0)
+                    continue;
+                candidates.clear();
+                for (size_t i = 0; i < size; ++i)
+                    candidates.push_back(Candidate(score[i], index[i], c));
+                std::stable_sort(candidates.begin(), candidates.end(), ScoreGreater);
+                size = Simd::Min(size, capacity);
+                for (size_t i = 0, k = 0; i < size; ++i)
+                {
+                    const float* box = boxes + candidates[i].index * 4;
+                    if (overlaps(kept.data, k, stride, box, overlap))
+                        continue;
+                    for (size_t j = 0; j < 4; ++j)
+                        kept[j * stride + k] = box[j];
+                    kept[4 * stride + k] = DetectionArea(box);
+                    detections.push_back(candidates[i]);
+                    k++;
+                }
+            }
+            if (keepTopK && detections.size() > keepTopK)
+            {
+                std::stable_sort(detections.begin(), detections.end(), ScoreGreater);
+                detections.resize(keepTopK);
+                std::stable_sort(detections.begin(), detections.end(), LabelLesser);
+            }
+            for (size_t i = 0; i < detections.size(); ++i, dst += 6)
+            {
+                const float* box = boxes + detections[i].index * 4;
+                dst[0] = float(detections[i].label);
+                dst[1] = detections[i].score;
+                dst[2] = box[0];
+                dst[3] = box[1];
+                dst[4] = box[2];
+                dst[5] = box[3];
+            }
+            return detections.size();
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static size_t DetectionSelect(const float* scores, size_t count, float threshold, int32_t* index, float* score)
+        {
+            size_t size = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (scores[i] > threshold)
+                {
+                    index[size] = (int32_t)i;
+                    score[size] = scores[i];
+                    size++;
+                }
+            }
+            return size;
+        }
+
+        static bool DetectionOverlaps(const float* kept, size_t size, size_t stride, const float* box, float threshold)
+        {
+            return DetectionOverlaps(kept, 0, size, stride, box, threshold);
+        }
+
+        size_t SynetDetectionOutput32f(const float* boxes, const float* scores, size_t count, size_t classes, size_t background,
+            const float* confidence, const float* overlap, size_t topK, size_t keepTopK, float* dst)
+        {
+            return SynetDetectionOutput32f(boxes, scores, count, classes, background, *confidence, *overlap, topK, keepTopK, DetectionSelect, DetectionOverlaps, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void SynetDecodeSsd32f(const float* loc, const float* prior, const float* variance, size_t count, float* dst)
+        {
+            for (size_t i = 0; i < count; ++i, loc += 4, prior += 4, variance += 4, dst += 4)
+                DecodeSsd(loc, prior, variance, dst);
+        }
+
+        void SynetDecodeYolo32f(const float* src, size_t anchors, size_t classes, size_t height, size_t width, const float* sizes, float* boxes, float* scores)
+        {
+            size_t spatial = height * width, count = anchors * spatial;
+            for (size_t a = 0; a < anchors; ++a)
+            {
+                const float* x = src + 0 * spatial, * y = src + 1 * spatial, * w = src + 2 * spatial, * h = src + 3 * spatial, * obj = src + 4 * spatial;
+                float anchorW = sizes[2 * a + 0] * 0.5f, anchorH = sizes[2 * a + 1] * 0.5f;
+                for (size_t row = 0, s = 0; row < height; ++row)
+                {
+                    for (size_t col = 0; col < width; ++col, ++s, boxes += 4)
+                    {
+                        float centerX = (float(col) + SynetSigmoid32f(x[s], 1.0f)) / float(width);
+                        float centerY = (float(row) + SynetSigmoid32f(y[s], 1.0f)) / float(height);
+                        float halfW = ::exp(w[s]) * anchorW;
+                        float halfH = ::exp(h[s]) * anchorH;
+                        boxes[0] = centerX - halfW;
+                        boxes[1] = centerY - halfH;
+                        boxes[2] = centerX + halfW;
+                        boxes[3] = centerY + halfH;
+                    }
+                }
+                for (size_t c = 0; c < classes; ++c)
+                {
+                    const float* cls = src + (5 + c) * spatial;
+                    float* dst = scores + c * count + a * spatial;
+                    for (size_t s = 0; s < spatial; ++s)
+                        dst[s] = SynetSigmoid32f(obj[s], 1.0f) * SynetSigmoid32f(cls[s], 1.0f);
+                }
+                src += (5 + classes) * spatial;
+            }
+        }
+    }
+#endif
+}
@@ -25,6 +25,7 @@
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdFloat16.h"
 
 namespace Simd
 {
@@ -158,6 +159,7 @@ namespace Simd
         {
             return
                 p.activation == SimdConvolutionActivationIdentity &&
+                p.weightType == SimdTensorData32f &&
                 p.batch == 1 &&
                 p.output >= 4 &&
                 Base::AlgCacheL3() > p.input * p.output * sizeof(float);
@@ -210,13 +212,171 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        template<SimdTensorDataType type> SIMD_INLINE float LoadWeight(const uint16_t* src);
 
-        void * SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation)
+        template<> SIMD_INLINE float LoadWeight<SimdTensorData16f>(const uint16_t* src)
         {
-            InnerProductParam32f param(batch, input, output, transpose, activation);
+            return Float16ToFloat32(src[0]);
+        }
+
+        template<> SIMD_INLINE float LoadWeight<SimdTensorData16b>(const uint16_t* src)
+        {
+            return BFloat16ToFloat32(src[0]);
+        }
+
+        template<SimdTensorDataType type> void InnerProduct16(const float* src, const uint16_t* weight, const float* bias, size_t input, size_t output, float* dst)
+        {
+            const size_t F = 4;
+            for (size_t o = 0; o < output; o += F)
+            {
+                float sums[F] = { bias[o + 0], bias[o + 1], bias[o + 2], bias[o + 3] };
+                for (size_t i = 0; i < input; ++i, weight += F)
+                {
+                    float s = src[i];
+                    sums[0] += s * LoadWeight<type>(weight + 0);
+                    sums[1] += s * LoadWeight<type>(weight + 1);
+                    sums[2] += s * LoadWeight<type>(weight + 2);
+                    sums[3] += s * LoadWeight<type>(weight + 3);
+                }
+                for (size_t f = 0, n = Simd::Min(F, output - o); f < n; ++f)
+                    dst[o + f] = sums[f];
+            }
+        }
+
+        SynetInnerProduct32fProd16::SynetInnerProduct32fProd16(const InnerProductParam32f& p)
+            : SynetInnerProduct32f(p)
+        {
+            _N = _param.output;
+            _K = _param.input;
+            SetSize(4);
+            _prod = _param.weightType == SimdTensorData16f ? InnerProduct16<SimdTensorData16f> : InnerProduct16<SimdTensorData16b>;
+        }
+
+        void SynetInnerProduct32fProd16::SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params)
+        {
+            SynetInnerProduct32f::SetParams(weight, internal, bias, params);
+            ReorderWeight(_weight, _rWeight.data);
+            if (internal)
+                *internal = SimdTrue;
+            if (bias)
+                memcpy(_rBias.data, bias, _param.output * sizeof(float));
+        }
+
+        void SynetInnerProduct32fProd16::Forward(const float* src, float* dst)
+        {
+            size_t M = _param.batch, N = _N;
+            if (M > 1) // blocks of weights are kept in L2 cache and are reused by all rows
+                N = Simd::Max(_F, AlignLo(AlgCacheL2() / 2 / (_K * sizeof(uint16_t)), _F));
+            for (size_t n = 0; n < _N; n += N)
+            {
+                size_t nB = Simd::Min(_N, n + N) - n;
+                for (size_t m = 0; m < M; ++m)
+                    _prod(src + m * _K, _rWeight.data + n * _K, _rBias.data + n, _K, nB, dst + m * _N + n);
+            }
+        }
+
+        void SynetInnerProduct32fProd16::SetSize(size_t F)
+        {
+            _F = F;
+            _rWeight.Resize(AlignHi(_N, _F) * _K);
+            _rBias.Resize(AlignHi(_N, _F), true);
+        }
+
+        void SynetInnerProduct32fProd16::ReorderWeight(const float* src, uint16_t* dst)
+        {
+            bool fp16 = _param.weightType == SimdTensorData16f;
+            size_t strideN = _param.transpose ? _K : 1;
+            size_t strideK = _param.transpose ? 1 : _N;
+            for (size_t n = 0; n < _N; n += _F)
+            {
+                size_t F = Simd::Min(_N, n + _F) - n;
+                const float* psrc = src + n * strideN;
+                for (size_t k = 0; k < _K; ++k)
+                {
+                    size_t f = 0;
+                    for (; f < F; ++f)
+                        *(dst++) = fp16 ? Float32ToFloat16(psrc[f * strideN]) : Float32ToBFloat16(psrc[f * strideN]);
+                    for (; f < _F; ++f)
+                        *(dst++) = 0;
+                    psrc += strideK;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        static InnerProductParam32f Prod16Param(const ConvParam32f & p, SimdTensorDataType weightType)
+        {
+            return InnerProductParam32f(p.batch * p.dstH * p.dstW, p.srcC, p.dstC, SimdFalse, SimdConvolutionActivationIdentity, weightType);
+        }
+
+        SynetConvolution32fProd16::SynetConvolution32fProd16(const ConvParam32f & p, SimdTensorDataType weightType)
+            : SynetConvolution32f(p)
+            , _prod(new SynetInnerProduct32fProd16(Prod16Param(p, weightType)))
+        {
+            _biasAndActivation = Base::ConvolutionBiasAndActivation;
+        }
+
+        SynetConvolution32fProd16::SynetConvolution32fProd16(const ConvParam32f & p, SynetInnerProduct32f * prod)
+            : SynetConvolution32f(p)
+            , _prod(prod)
+        {
+            _biasAndActivation = Base::ConvolutionBiasAndActivation;
+        }
+
+        SynetConvolution32fProd16::~SynetConvolution32fProd16()
+        {
+            delete _prod;
+        }
+
+        String SynetConvolution32fProd16::Desc() const
+        {
+            return Ext() + "::Prod" + (_prod->Param().weightType == SimdTensorData16f ? "16f" : "16b");
+        }
+
+        size_t SynetConvolution32fProd16::InternalBufferSize() const
+        {
+            return _prod->InternalBufferSize();
+        }
+
+        void SynetConvolution32fProd16::SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
+        {
+            SynetConvolution32f::SetParams(weight, internal, bias, params);
+            _prod->SetParams(weight, internal, bias, NULL);
+        }
+
+        void SynetConvolution32fProd16::Forward(const float * src, float * buf, float * dst)
+        {
+            const ConvParam32f & p = _param;
+            _prod->Forward(src, dst);
+            if (p.activation != SimdConvolutionActivationIdentity)
+                _biasAndActivation(NULL, p.dstC, p.batch * p.dstH * p.dstW, p.activation, _params, p.trans, dst);
+        }
+
+        bool SynetConvolution32fProd16::Preferable(const ConvParam32f & p, SimdTensorDataType weightType)
+        {
+            return (weightType == SimdTensorData16f || weightType == SimdTensorData16b) && p.trans && p.Is1x1() && p.group == 1 &&
+                p.batch * p.dstH * p.dstW <= 64;
+        }
+
+        //---------------------------------------------------------------------
+
+        static SynetInnerProduct32f * SynetInnerProduct32fDenseInit(const InnerProductParam32f & param)
+        {
+            if (param.weightType != SimdTensorData32f)
+                return new SynetInnerProduct32fProd16(param);
+            return new SynetInnerProduct32fGemm(param);
+        }
+
+        void * SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType)
+        {
+            InnerProductParam32f param(batch, input, output, transpose, activation, weightType);
             if (!param.Valid())
                 return NULL;
-            return new SynetInnerProduct32fGemm(param);
+            else if (SynetInnerProduct32fSparse::Preferable(param))
+                return new SynetInnerProduct32fSparse(param, SynetInnerProduct32fDenseInit(param));
+            else
+                return SynetInnerProduct32fDenseInit(param);
         }
     }
 #endif
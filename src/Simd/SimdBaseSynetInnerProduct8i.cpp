@@ -0,0 +1,98 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetInnerProduct8i.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    SynetInnerProduct8i::SynetInnerProduct8i(const InnerProductParam8i& p, ConvolutionInitPtr init)
+        : _param(p)
+#if defined(SIMD_PERFORMANCE_STATISTIC)
+        , _perf(NULL)
+#endif
+    {
+        SimdConvolutionParameters conv = p.Conv();
+        _conv = (SynetConvolution8i*)init(1, &conv, p.compatibility);
+    }
+
+    SynetInnerProduct8i::~SynetInnerProduct8i()
+    {
+        if (_conv)
+            delete _conv;
+    }
+
+    size_t SynetInnerProduct8i::ExternalBufferSize() const
+    {
+        return _conv->ExternalBufferSize();
+    }
+
+    size_t SynetInnerProduct8i::InternalBufferSize() const
+    {
+        return _conv->InternalBufferSize();
+    }
+
+    void SynetInnerProduct8i::SetParams(const float* weight, const float* bias, const float* params, const float* const* stats)
+    {
+        const InnerProductParam8i& p = _param;
+        if (p.transpose)
+        {
+            Array32f buffer(p.input * p.output);
+            for (size_t i = 0; i < p.input; ++i)
+                for (size_t o = 0; o < p.output; ++o)
+                    buffer[i * p.output + o] = weight[o * p.input + i];
+            _conv->SetParams(buffer.data, bias, params, stats);
+        }
+        else
+            _conv->SetParams(weight, bias, params, stats);
+    }
+
+    void SynetInnerProduct8i::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+    {
+        _conv->Forward(src, buf, dst);
+    }
+
+#if defined(SIMD_PERFORMANCE_STATISTIC)
+    Base::PerformanceMeasurer* SynetInnerProduct8i::Perf(const char* func)
+    {
+        if (_perf == NULL)
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
+        return _perf;
+    }
+#endif
+
+    //-------------------------------------------------------------------------
+
+    namespace Base
+    {
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility)
+        {
+            InnerProductParam8i param(batch, input, output, transpose, srcT, dstT, activation, compatibility);
+            if (!param.Valid())
+                return NULL;
+            return new Simd::SynetInnerProduct8i(param, SynetConvolution8iInit);
+        }
+    }
+#endif
+}
@@ -0,0 +1,221 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdSynetNormalize.h"
+#include "Simd/SimdSynetConvolution32fCommon.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        template<SimdConvolutionActivationType type> void SynetLayerNormalize32fNchw(const float* src, size_t batch, size_t channels, size_t spatial,
+            const float* scale, const float* shift, float eps, const float* params, float* dst)
+        {
+            Array32f buf(spatial * 2);
+            float* mean = buf.data, * norm = mean + spatial;
+            for (size_t b = 0; b < batch; ++b)
+            {
+                for (size_t s = 0; s < spatial; ++s)
+                    mean[s] = 0.0f, norm[s] = 0.0f;
+                for (size_t c = 0, o = 0; c < channels; ++c)
+                {
+                    for (size_t s = 0; s < spatial; ++s, ++o)
+                    {
+                        mean[s] += src[o];
+                        norm[s] += Simd::Square(src[o]);
+                    }
+                }
+                for (size_t s = 0; s < spatial; ++s)
+                    NormalizeStatistics(mean[s], norm[s], channels, eps, mean[s], norm[s]);
+                for (size_t c = 0, o = 0; c < channels; ++c)
+                {
+                    for (size_t s = 0; s < spatial; ++s, ++o)
+                        dst[o] = Activate<type>((src[o] - mean[s]) * norm[s] * scale[c] + shift[c], params, c);
+                }
+                src += channels * spatial;
+                dst += channels * spatial;
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void SynetLayerNormalize32fNhwc(const float* src, size_t batch, size_t channels, size_t spatial,
+            const float* scale, const float* shift, float eps, const float* params, float* dst)
+        {
+            for (size_t i = 0, n = batch * spatial; i < n; ++i)
+            {
+                float sum = 0.0f, sqsum = 0.0f, mean, norm;
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    sum += src[c];
+                    sqsum += Simd::Square(src[c]);
+                }
+                NormalizeStatistics(sum, sqsum, channels, eps, mean, norm);
+                for (size_t c = 0; c < channels; ++c)
+                    dst[c] = Activate<type>((src[c] - mean) * norm * scale[c] + shift[c], params, c);
+                src += channels;
+                dst += channels;
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void SynetLayerNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial,
+            const float* scale, const float* shift, float eps, SimdTensorFormatType format, const float* params, float* dst)
+        {
+            if (format == SimdTensorFormatNchw)
+                SynetLayerNormalize32fNchw<type>(src, batch, channels, spatial, scale, shift, eps, params, dst);
+            else if (format == SimdTensorFormatNhwc)
+                SynetLayerNormalize32fNhwc<type>(src, batch, channels, spatial, scale, shift, eps, params, dst);
+            else
+                assert(0);
+        }
+
+        void SynetLayerNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst)
+        {
+            Array32f affine;
+            NormalizeAffine(channels, scale, shift, affine);
+            switch (activation)
+            {
+            case SimdConvolutionActivationIdentity: SynetLayerNormalize32f<SimdConvolutionActivationIdentity>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationRelu: SynetLayerNormalize32f<SimdConvolutionActivationRelu>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationLeakyRelu: SynetLayerNormalize32f<SimdConvolutionActivationLeakyRelu>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationRestrictRange: SynetLayerNormalize32f<SimdConvolutionActivationRestrictRange>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationPrelu: SynetLayerNormalize32f<SimdConvolutionActivationPrelu>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationElu: SynetLayerNormalize32f<SimdConvolutionActivationElu>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationHswish: SynetLayerNormalize32f<SimdConvolutionActivationHswish>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationMish: SynetLayerNormalize32f<SimdConvolutionActivationMish>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationHardSigmoid: SynetLayerNormalize32f<SimdConvolutionActivationHardSigmoid>(src, batch, channels, spatial, scale, shift, *eps, format, params, dst); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<SimdConvolutionActivationType type> void SynetGroupNormalize32fNchw(const float* src, size_t batch, size_t channels, size_t spatial,
+            size_t group, const float* scale, const float* shift, float eps, const float* params, float* dst)
+        {
+            size_t groupC = channels / group, size = groupC * spatial;
+            for (size_t b = 0; b < batch; ++b)
+            {
+                for (size_t g = 0, c = 0; g < group; ++g)
+                {
+                    float sum = 0.0f, sqsum = 0.0f, mean, norm;
+                    for (size_t i = 0; i < size; ++i)
+                    {
+                        sum += src[i];
+                        sqsum += Simd::Square(src[i]);
+                    }
+                    NormalizeStatistics(sum, sqsum, size, eps, mean, norm);
+                    for (size_t e = c + groupC; c < e; ++c)
+                    {
+                        float k = norm * scale[c], s = shift[c] - mean * k;
+                        for (size_t i = 0; i < spatial; ++i)
+                            dst[i] = Activate<type>(src[i] * k + s, params, c);
+                        src += spatial;
+                        dst += spatial;
+                    }
+                }
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void SynetGroupNormalize32fNhwc(const float* src, size_t batch, size_t channels, size_t spatial,
+            size_t group, const float* scale, const float* shift, float eps, const float* params, float* dst)
+        {
+            size_t groupC = channels / group, size = groupC * spatial;
+            Array32f buf(channels * 2);
+            float* k = buf.data, * s = k + channels;
+            for (size_t b = 0; b < batch; ++b)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                    k[c] = 0.0f, s[c] = 0.0f;
+                for (size_t i = 0, o = 0; i < spatial; ++i)
+                {
+                    for (size_t c = 0; c < channels; ++c, ++o)
+                    {
+                        k[c] += src[o];
+                        s[c] += Simd::Square(src[o]);
+                    }
+                }
+                for (size_t g = 0, c = 0; g < group; ++g)
+                {
+                    float sum = 0.0f, sqsum = 0.0f, mean, norm;
+                    for (size_t i = c, e = c + groupC; i < e; ++i)
+                    {
+                        sum += k[i];
+                        sqsum += s[i];
+                    }
+                    NormalizeStatistics(sum, sqsum, size, eps, mean, norm);
+                    for (size_t e = c + groupC; c < e; ++c)
+                    {
+                        k[c] = norm * scale[c];
+                        s[c] = shift[c] - mean * k[c];
+                    }
+                }
+                for (size_t i = 0; i < spatial; ++i)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                        dst[c] = Activate<type>(src[c] * k[c] + s[c], params, c);
+                    src += channels;
+                    dst += channels;
+                }
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void SynetGroupNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial,
+            size_t group, const float* scale, const float* shift, float eps, SimdTensorFormatType format, const float* params, float* dst)
+        {
+            if (format == SimdTensorFormatNchw)
+                SynetGroupNormalize32fNchw<type>(src, batch, channels, spatial, group, scale, shift, eps, params, dst);
+            else if (format == SimdTensorFormatNhwc)
+                SynetGroupNormalize32fNhwc<type>(src, batch, channels, spatial, group, scale, shift, eps, params, dst);
+            else
+                assert(0);
+        }
+
+        void SynetGroupNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst)
+        {
+            assert(channels % group == 0);
+            Array32f affine;
+            NormalizeAffine(channels, scale, shift, affine);
+            switch (activation)
+            {
+            case SimdConvolutionActivationIdentity: SynetGroupNormalize32f<SimdConvolutionActivationIdentity>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationRelu: SynetGroupNormalize32f<SimdConvolutionActivationRelu>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationLeakyRelu: SynetGroupNormalize32f<SimdConvolutionActivationLeakyRelu>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationRestrictRange: SynetGroupNormalize32f<SimdConvolutionActivationRestrictRange>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationPrelu: SynetGroupNormalize32f<SimdConvolutionActivationPrelu>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationElu: SynetGroupNormalize32f<SimdConvolutionActivationElu>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationHswish: SynetGroupNormalize32f<SimdConvolutionActivationHswish>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationMish: SynetGroupNormalize32f<SimdConvolutionActivationMish>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            case SimdConvolutionActivationHardSigmoid: SynetGroupNormalize32f<SimdConvolutionActivationHardSigmoid>(src, batch, channels, spatial, group, scale, shift, *eps, format, params, dst); break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif
+}
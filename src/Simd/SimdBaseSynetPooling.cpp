@@ -98,6 +98,70 @@ namespace Simd
                 assert(0);
         }
 
+        void SynetPoolingForwardAverage8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+            size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format)
+        {
+            if (format == SimdTensorFormatNhwc)
+            {
+                Array32u sums(srcC);
+                for (size_t ph = 0; ph < dstH; ++ph)
+                {
+                    size_t hStart = ph * strideY - padY;
+                    size_t hEnd = Simd::Min(hStart + kernelY, srcH);
+                    hStart = Simd::Max<ptrdiff_t>(0, hStart);
+                    for (size_t pw = 0; pw < dstW; ++pw)
+                    {
+                        size_t wStart = pw * strideX - padX;
+                        size_t wEnd = Simd::Min(wStart + kernelX, srcW);
+                        wStart = Simd::Max<ptrdiff_t>(0, wStart);
+                        for (size_t c = 0; c < srcC; ++c)
+                            sums[c] = 0;
+                        for (size_t h = hStart; h < hEnd; ++h)
+                        {
+                            for (size_t w = wStart; w < wEnd; ++w)
+                            {
+                                const uint8_t* ps = src + (h * srcW + w) * srcC;
+                                for (size_t c = 0; c < srcC; ++c)
+                                    sums[c] += ps[c];
+                            }
+                        }
+                        uint32_t area = uint32_t(excludePad ? (hEnd - hStart) * (wEnd - wStart) : kernelY * kernelX);
+                        for (size_t c = 0; c < srcC; ++c)
+                            dst[c] = uint8_t((sums[c] + area / 2) / area);
+                        dst += srcC;
+                    }
+                }
+            }
+            else if (format == SimdTensorFormatNchw)
+            {
+                for (size_t c = 0; c < srcC; ++c)
+                {
+                    for (size_t ph = 0; ph < dstH; ++ph)
+                    {
+                        size_t hStart = ph * strideY - padY;
+                        size_t hEnd = Simd::Min(hStart + kernelY, srcH);
+                        hStart = Simd::Max<ptrdiff_t>(0, hStart);
+                        for (size_t pw = 0; pw < dstW; ++pw)
+                        {
+                            size_t wStart = pw * strideX - padX;
+                            size_t wEnd = Simd::Min(wStart + kernelX, srcW);
+                            wStart = Simd::Max<ptrdiff_t>(0, wStart);
+                            uint32_t sum = 0;
+                            for (size_t h = hStart; h < hEnd; ++h)
+                                for (size_t w = wStart; w < wEnd; ++w)
+                                    sum += src[h * srcW + w];
+                            uint32_t area = uint32_t(excludePad ? (hEnd - hStart) * (wEnd - wStart) : kernelY * kernelX);
+                            dst[ph * dstW + pw] = uint8_t((sum + area / 2) / area);
+                        }
+                    }
+                    src += srcW * srcH;
+                    dst += dstW * dstH;
+                }
+            }
+            else
+                assert(0);
+        }
+
         //---------------------------------------------------------------------
 
         template<class T> void SynetPoolingForwardMax(const T* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
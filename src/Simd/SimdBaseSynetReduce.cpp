@@ -0,0 +1,162 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        void SynetReduceLayerForward(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+            SimdBool reduceChannels, SimdBool reduceSpatial, float* dst, SynetReducePtr reduceRows, SynetReducePtr reduceCols)
+        {
+            assert(format == SimdTensorFormatNchw || format == SimdTensorFormatNhwc);
+            bool nchw = format == SimdTensorFormatNchw;
+            size_t size = channels * spatial;
+            for (size_t b = 0; b < batch; ++b)
+            {
+                if (reduceChannels && reduceSpatial)
+                {
+                    reduceCols(src, 1, size, dst);
+                    dst += 1;
+                }
+                else if (reduceChannels)
+                {
+                    if (nchw)
+                        reduceRows(src, channels, spatial, dst);
+                    else
+                        reduceCols(src, spatial, channels, dst);
+                    dst += spatial;
+                }
+                else if (reduceSpatial)
+                {
+                    if (nchw)
+                        reduceCols(src, channels, spatial, dst);
+                    else
+                        reduceRows(src, spatial, channels, dst);
+                    dst += channels;
+                }
+                else
+                {
+                    reduceRows(src, 1, size, dst);
+                    dst += size;
+                }
+                src += size;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<SimdSynetReduceType type> void SynetReduceRows(const float* src, size_t rows, size_t cols, float* dst)
+        {
+            for (size_t j = 0; j < cols; ++j)
+                dst[j] = SynetReduceInit<type>();
+            for (size_t i = 0; i < rows; ++i, src += cols)
+                for (size_t j = 0; j < cols; ++j)
+                    dst[j] = SynetReduce<type>(dst[j], src[j]);
+            for (size_t j = 0; j < cols; ++j)
+                dst[j] = SynetReduceFinal<type>(dst[j], float(rows));
+        }
+
+        template<SimdSynetReduceType type> void SynetReduceCols(const float* src, size_t rows, size_t cols, float* dst)
+        {
+            for (size_t i = 0; i < rows; ++i, src += cols)
+            {
+                float sum = SynetReduceInit<type>();
+                for (size_t j = 0; j < cols; ++j)
+                    sum = SynetReduce<type>(sum, src[j]);
+                dst[i] = SynetReduceFinal<type>(sum, float(cols));
+            }
+        }
+
+        void SynetReduceLayerForward(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+            SimdSynetReduceType type, SimdBool reduceChannels, SimdBool reduceSpatial, float* dst)
+        {
+            switch (type)
+            {
+            case SimdSynetReduceL2: SynetReduceLayerForward(src, batch, channels, spatial, format, reduceChannels, reduceSpatial, dst, SynetReduceRows<SimdSynetReduceL2>, SynetReduceCols<SimdSynetReduceL2>); break;
+            case SimdSynetReduceMax: SynetReduceLayerForward(src, batch, channels, spatial, format, reduceChannels, reduceSpatial, dst, SynetReduceRows<SimdSynetReduceMax>, SynetReduceCols<SimdSynetReduceMax>); break;
+            case SimdSynetReduceMean: SynetReduceLayerForward(src, batch, channels, spatial, format, reduceChannels, reduceSpatial, dst, SynetReduceRows<SimdSynetReduceMean>, SynetReduceCols<SimdSynetReduceMean>); break;
+            case SimdSynetReduceMin: SynetReduceLayerForward(src, batch, channels, spatial, format, reduceChannels, reduceSpatial, dst, SynetReduceRows<SimdSynetReduceMin>, SynetReduceCols<SimdSynetReduceMin>); break;
+            case SimdSynetReduceSum: SynetReduceLayerForward(src, batch, channels, spatial, format, reduceChannels, reduceSpatial, dst, SynetReduceRows<SimdSynetReduceSum>, SynetReduceCols<SimdSynetReduceSum>); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void SynetL2Normalize32f(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+            SimdBool acrossSpatial, const float* eps, float* dst)
+        {
+            assert(format == SimdTensorFormatNchw || format == SimdTensorFormatNhwc);
+            float epsilon = eps[0];
+            size_t size = channels * spatial;
+            if (acrossSpatial)
+            {
+                for (size_t b = 0; b < batch; ++b, src += size, dst += size)
+                {
+                    float sum = 0.0f;
+                    for (size_t i = 0; i < size; ++i)
+                        sum += Simd::Square(src[i]);
+                    float norm = 1.0f / ::sqrt(sum + epsilon);
+                    for (size_t i = 0; i < size; ++i)
+                        dst[i] = src[i] * norm;
+                }
+            }
+            else if (format == SimdTensorFormatNchw)
+            {
+                Array32f buf(spatial);
+                for (size_t b = 0; b < batch; ++b, src += size, dst += size)
+                {
+                    buf.Clear();
+                    for (size_t c = 0; c < channels; ++c)
+                        for (size_t s = 0; s < spatial; ++s)
+                            buf[s] += Simd::Square(src[c * spatial + s]);
+                    for (size_t s = 0; s < spatial; ++s)
+                        buf[s] = 1.0f / ::sqrt(buf[s] + epsilon);
+                    for (size_t c = 0; c < channels; ++c)
+                        for (size_t s = 0; s < spatial; ++s)
+                            dst[c * spatial + s] = src[c * spatial + s] * buf[s];
+                }
+            }
+            else
+            {
+                for (size_t s = 0, n = batch * spatial; s < n; ++s, src += channels, dst += channels)
+                {
+                    float sum = 0.0f;
+                    for (size_t c = 0; c < channels; ++c)
+                        sum += Simd::Square(src[c]);
+                    float norm = 1.0f / ::sqrt(sum + epsilon);
+                    for (size_t c = 0; c < channels; ++c)
+                        dst[c] = src[c] * norm;
+                }
+            }
+        }
+    }
+#endif
+}
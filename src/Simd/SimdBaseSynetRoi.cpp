@@ -0,0 +1,215 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdSynetRoi.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        static void RoiAlignIndexAlpha(float start, float bin, size_t pooled, size_t grid, size_t size, int32_t* index, float* alpha)
+        {
+            float step = bin / grid, norm = 1.0f / grid;
+            for (size_t p = 0, i = 0; p < pooled; ++p)
+            {
+                for (size_t g = 0; g < grid; ++g, i += 2)
+                {
+                    float pos = start + p * bin + (g + 0.5f) * step;
+                    if (pos < -1.0f || pos > (float)size)
+                    {
+                        index[i + 0] = 0, index[i + 1] = 0;
+                        alpha[i + 0] = 0, alpha[i + 1] = 0;
+                    }
+                    else
+                    {
+                        ptrdiff_t lo;
+                        float a;
+                        BilinearIndexAlpha(pos, size, lo, a);
+                        index[i + 0] = (int32_t)Simd::Max<ptrdiff_t>(lo, 0);
+                        index[i + 1] = (int32_t)Simd::Min<ptrdiff_t>(lo + 1, size - 1);
+                        alpha[i + 0] = (1.0f - a) * norm;
+                        alpha[i + 1] = a * norm;
+                    }
+                }
+            }
+        }
+
+        void RoiAlignNchw(const float* src, size_t channels, size_t height, size_t width, const int32_t* iy, const float* ay, size_t gridH,
+            const int32_t* ix, const float* ax, size_t gridW, size_t pooledH, size_t pooledW, float* dst)
+        {
+            size_t sizeY = gridH * 2, sizeX = gridW * 2;
+            for (size_t c = 0; c < channels; ++c, src += height * width)
+            {
+                for (size_t ph = 0; ph < pooledH; ++ph)
+                {
+                    const int32_t* py = iy + ph * sizeY;
+                    const float* wy = ay + ph * sizeY;
+                    for (size_t pw = 0; pw < pooledW; ++pw)
+                        *dst++ = RoiAlignNhwc1(src, 1, width, py, wy, sizeY, ix + pw * sizeX, ax + pw * sizeX, sizeX);
+                }
+            }
+        }
+
+        static void RoiAlignNhwc(const float* src, size_t channels, size_t height, size_t width, const int32_t* iy, const float* ay, size_t gridH,
+            const int32_t* ix, const float* ax, size_t gridW, size_t pooledH, size_t pooledW, float* dst)
+        {
+            size_t sizeY = gridH * 2, sizeX = gridW * 2, stride = width * channels;
+            for (size_t ph = 0; ph < pooledH; ++ph)
+            {
+                const int32_t* py = iy + ph * sizeY;
+                const float* wy = ay + ph * sizeY;
+                for (size_t pw = 0; pw < pooledW; ++pw, dst += channels)
+                {
+                    const int32_t* px = ix + pw * sizeX;
+                    const float* wx = ax + pw * sizeX;
+                    for (size_t c = 0; c < channels; ++c)
+                        dst[c] = RoiAlignNhwc1(src + c, channels, stride, py, wy, sizeY, px, wx, sizeX);
+                }
+            }
+        }
+
+        void SynetRoiAlign32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+            size_t pooledH, size_t pooledW, float spatialScale, size_t samplingRatio, bool aligned, float* dst, RoiAlignPtr nchw, RoiAlignPtr nhwc)
+        {
+            RoiAlignPtr kernel = format == SimdTensorFormatNhwc ? nhwc : nchw;
+            size_t srcSize = channels * height * width, dstSize = channels * pooledH * pooledW;
+            float offset = aligned ? 0.5f : 0.0f;
+            Simd::Parallel(0, number, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array32i iy, ix;
+                Array32f ay, ax;
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const float* roi = rois + i * 5;
+                    float x1 = roi[1] * spatialScale - offset, y1 = roi[2] * spatialScale - offset;
+                    float roiW = roi[3] * spatialScale - offset - x1, roiH = roi[4] * spatialScale - offset - y1;
+                    if (!aligned)
+                    {
+                        roiW = Simd::Max(roiW, 1.0f);
+                        roiH = Simd::Max(roiH, 1.0f);
+                    }
+                    float binW = roiW / pooledW, binH = roiH / pooledH;
+                    size_t gridW = samplingRatio ? samplingRatio : (size_t)Simd::Max(::ceil(binW), 1.0f);
+                    size_t gridH = samplingRatio ? samplingRatio : (size_t)Simd::Max(::ceil(binH), 1.0f);
+                    if (iy.size < pooledH * gridH * 2)
+                    {
+                        iy.Resize(pooledH * gridH * 2);
+                        ay.Resize(pooledH * gridH * 2);
+                    }
+                    if (ix.size < pooledW * gridW * 2)
+                    {
+                        ix.Resize(pooledW * gridW * 2);
+                        ax.Resize(pooledW * gridW * 2);
+                    }
+                    RoiAlignIndexAlpha(y1, binH, pooledH, gridH, height, iy.data, ay.data);
+                    RoiAlignIndexAlpha(x1, binW, pooledW, gridW, width, ix.data, ax.data);
+                    kernel(src + (size_t)roi[0] * srcSize, channels, height, width, iy.data, ay.data, gridH, ix.data, ax.data, gridW, pooledH, pooledW, dst + i * dstSize);
+                }
+            }, GetThreadNumber());
+        }
+
+        void SynetRoiAlign32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+            size_t pooledH, size_t pooledW, const float* spatialScale, size_t samplingRatio, SimdBool aligned, float* dst)
+        {
+            SynetRoiAlign32f(src, channels, height, width, format, rois, number, pooledH, pooledW, *spatialScale, 
+                samplingRatio, aligned == SimdTrue, dst, RoiAlignNchw, RoiAlignNhwc);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void RoiPoolingIndex(float start, float end, size_t pooled, size_t size, int32_t* index)
+        {
+            ptrdiff_t roiStart = (ptrdiff_t)::round(start), roiSize = Simd::Max<ptrdiff_t>((ptrdiff_t)::round(end) - roiStart + 1, 1);
+            float bin = (float)roiSize / pooled;
+            for (size_t p = 0; p < pooled; ++p)
+            {
+                ptrdiff_t lo = roiStart + (ptrdiff_t)::floor(p * bin);
+                ptrdiff_t hi = roiStart + (ptrdiff_t)::ceil((p + 1) * bin);
+                index[2 * p + 0] = (int32_t)Simd::RestrictRange<ptrdiff_t>(lo, 0, size);
+                index[2 * p + 1] = (int32_t)Simd::RestrictRange<ptrdiff_t>(hi, 0, size);
+            }
+        }
+
+        void RoiPoolingNchw(const float* src, size_t channels, size_t height, size_t width,
+            const int32_t* iy, const int32_t* ix, size_t pooledH, size_t pooledW, float* dst)
+        {
+            for (size_t c = 0; c < channels; ++c, src += height * width)
+            {
+                for (size_t ph = 0; ph < pooledH; ++ph)
+                {
+                    for (size_t pw = 0; pw < pooledW; ++pw)
+                    {
+                        size_t y0 = iy[2 * ph + 0], y1 = iy[2 * ph + 1], x0 = ix[2 * pw + 0], x1 = ix[2 * pw + 1];
+                        *dst++ = y0 < y1 && x0 < x1 ? RoiPoolingNhwc1(src, 1, width, y0, y1, x0, x1) : 0.0f;
+                    }
+                }
+            }
+        }
+
+        static void RoiPoolingNhwc(const float* src, size_t channels, size_t height, size_t width,
+            const int32_t* iy, const int32_t* ix, size_t pooledH, size_t pooledW, float* dst)
+        {
+            size_t stride = width * channels;
+            for (size_t ph = 0; ph < pooledH; ++ph)
+            {
+                for (size_t pw = 0; pw < pooledW; ++pw, dst += channels)
+                {
+                    size_t y0 = iy[2 * ph + 0], y1 = iy[2 * ph + 1], x0 = ix[2 * pw + 0], x1 = ix[2 * pw + 1];
+                    for (size_t c = 0; c < channels; ++c)
+                        dst[c] = y0 < y1 && x0 < x1 ? RoiPoolingNhwc1(src + c, channels, stride, y0, y1, x0, x1) : 0.0f;
+                }
+            }
+        }
+
+        void SynetRoiPooling32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+            size_t pooledH, size_t pooledW, float spatialScale, float* dst, RoiPoolingPtr nchw, RoiPoolingPtr nhwc)
+        {
+            RoiPoolingPtr kernel = format == SimdTensorFormatNhwc ? nhwc : nchw;
+            size_t srcSize = channels * height * width, dstSize = channels * pooledH * pooledW;
+            Simd::Parallel(0, number, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array32i iy(pooledH * 2), ix(pooledW * 2);
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const float* roi = rois + i * 5;
+                    RoiPoolingIndex(roi[2] * spatialScale, roi[4] * spatialScale, pooledH, height, iy.data);
+                    RoiPoolingIndex(roi[1] * spatialScale, roi[3] * spatialScale, pooledW, width, ix.data);
+                    kernel(src + (size_t)roi[0] * srcSize, channels, height, width, iy.data, ix.data, pooledH, pooledW, dst + i * dstSize);
+                }
+            }, GetThreadNumber());
+        }
+
+        void SynetRoiPooling32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+            size_t pooledH, size_t pooledW, const float* spatialScale, float* dst)
+        {
+            SynetRoiPooling32f(src, channels, height, width, format, rois, number, pooledH, pooledW, *spatialScale, dst, RoiPoolingNchw, RoiPoolingNhwc);
+        }
+    }
+#endif
+}
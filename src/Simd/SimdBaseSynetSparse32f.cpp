@@ -0,0 +1,285 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetSparse32f.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSynetInnerProduct32f.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    static size_t SparseNonZeroBlocks(const float * weight, size_t N, size_t K, size_t ldN, size_t ldK, size_t B)
+    {
+        size_t count = 0;
+        for (size_t n = 0; n < N; n += B)
+        {
+            size_t nn = Simd::Min(N, n + B);
+            for (size_t k = 0; k < K; ++k)
+            {
+                for (size_t i = n; i < nn; ++i)
+                {
+                    if (weight[i * ldN + k * ldK] != 0.0f)
+                    {
+                        count++;
+                        break;
+                    }
+                }
+            }
+        }
+        return count;
+    }
+
+    bool SparseWeight32f::Init(const float * weight, size_t N, size_t K, size_t ldN, size_t ldK, float blockDensity, float singleDensity)
+    {
+        Clear();
+        const size_t blocks[4] = { 16, 8, 4, 1 };
+        size_t best = 0, work = N * K;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            size_t B = blocks[i], w = SparseNonZeroBlocks(weight, N, K, ldN, ldK, B) * B;
+            if (best == 0 || w * 5 < work * 4)
+                best = B, work = w;
+        }
+        if (float(work) > float(N * K) * (best == 1 ? singleDensity : blockDensity))
+            return false;
+        this->N = N;
+        this->K = K;
+        this->B = best;
+        size_t NB = DivHi(N, B);
+        offset.Resize(NB + 1);
+        index.Resize(work / B);
+        value.Resize(work, true);
+        offset[0] = 0;
+        for (size_t nb = 0, j = 0; nb < NB; ++nb)
+        {
+            size_t n = nb * B, nn = Simd::Min(N, n + B) - n;
+            for (size_t k = 0; k < K; ++k)
+            {
+                bool zero = true;
+                for (size_t i = 0; i < nn && zero; ++i)
+                    zero = weight[(n + i) * ldN + k * ldK] == 0.0f;
+                if (zero)
+                    continue;
+                index[j] = int32_t(k);
+                for (size_t i = 0; i < nn; ++i)
+                    value[j * B + i] = weight[(n + i) * ldN + k * ldK];
+                j++;
+            }
+            offset[nb + 1] = int32_t(j);
+        }
+        return true;
+    }
+
+    void SparseWeight32f::Clear()
+    {
+        N = 0, K = 0, B = 0;
+        offset.Resize(0);
+        index.Resize(0);
+        value.Resize(0);
+    }
+
+    namespace Base
+    {
+        void SparseGemm32fNS(size_t M, const float * A, size_t lda, const SparseWeight32f & B, float * C, size_t ldc)
+        {
+            const size_t NB = DivHi(B.N, B.B);
+            for (size_t m = 0; m < M; ++m, A += lda, C += ldc)
+            {
+                for (size_t nb = 0; nb < NB; ++nb)
+                {
+                    size_t n = nb * B.B, nn = Simd::Min(B.N, n + B.B) - n;
+                    float sum[16] = { 0 };
+                    for (int32_t j = B.offset[nb]; j < B.offset[nb + 1]; ++j)
+                    {
+                        float a = A[B.index[j]];
+                        const float * w = B.value.data + j * B.B;
+                        for (size_t i = 0; i < nn; ++i)
+                            sum[i] += a * w[i];
+                    }
+                    for (size_t i = 0; i < nn; ++i)
+                        C[n + i] = sum[i];
+                }
+            }
+        }
+
+        void SparseGemm32fSN(const SparseWeight32f & A, size_t M, const float * B, size_t ldb, float * C, size_t ldc)
+        {
+            const size_t NB = DivHi(A.N, A.B);
+            for (size_t nb = 0; nb < NB; ++nb)
+            {
+                size_t n = nb * A.B, nn = Simd::Min(A.N, n + A.B) - n;
+                for (size_t i = 0; i < nn; ++i)
+                {
+                    float * c = C + (n + i) * ldc;
+                    for (size_t m = 0; m < M; ++m)
+                        c[m] = 0.0f;
+                    for (int32_t j = A.offset[nb]; j < A.offset[nb + 1]; ++j)
+                    {
+                        float a = A.value[j * A.B + i];
+                        const float * b = B + A.index[j] * ldb;
+                        for (size_t m = 0; m < M; ++m)
+                            c[m] += a * b[m];
+                    }
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetConvolution32fSparse::SynetConvolution32fSparse(const ConvParam32f & p, SynetConvolution32f * dense)
+            : SynetConvolution32f(p)
+            , _dense(dense)
+        {
+            _gemmNS = Base::SparseGemm32fNS;
+            _gemmSN = Base::SparseGemm32fSN;
+            _biasAndActivation = Base::ConvolutionBiasAndActivation;
+        }
+
+        SynetConvolution32fSparse::~SynetConvolution32fSparse()
+        {
+            delete _dense;
+        }
+
+        String SynetConvolution32fSparse::Desc() const
+        {
+            return _sparse.Enable() ? Ext() + "::Sparse-" + ToStr(_sparse.B) : _dense->Desc();
+        }
+
+        size_t SynetConvolution32fSparse::ExternalBufferSize() const
+        {
+            return _dense->ExternalBufferSize();
+        }
+
+        size_t SynetConvolution32fSparse::InternalBufferSize() const
+        {
+            return _sparse.Enable() ? _sparse.Size() : _dense->InternalBufferSize();
+        }
+
+        void SynetConvolution32fSparse::SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
+        {
+            const ConvParam32f & p = _param;
+            SynetConvolution32f::SetParams(weight, internal, bias, params);
+            bool sparse = p.trans ?
+                _sparse.Init(weight, p.dstC, p.srcC, 1, p.dstC, SPARSE_DENSITY_BLOCK, SPARSE_DENSITY_SINGLE) :
+                _sparse.Init(weight, p.dstC, p.srcC, p.srcC, 1, SPARSE_DENSITY_BLOCK, SPARSE_DENSITY_BLOCK);
+            if (sparse)
+            {
+                if (internal)
+                    *internal = SimdTrue;
+            }
+            else
+                _dense->SetParams(weight, internal, bias, params);
+        }
+
+        void SynetConvolution32fSparse::Forward(const float * src, float * buf, float * dst)
+        {
+            const ConvParam32f & p = _param;
+            if (_sparse.Enable())
+            {
+                size_t size = p.dstH * p.dstW;
+                if (p.trans)
+                {
+                    _gemmNS(p.batch * size, src, p.srcC, _sparse, dst, p.dstC);
+                    _biasAndActivation(_bias, p.dstC, p.batch * size, p.activation, _params, p.trans, dst);
+                }
+                else
+                {
+                    for (size_t b = 0; b < p.batch; ++b)
+                    {
+                        _gemmSN(_sparse, size, src, size, dst, size);
+                        _biasAndActivation(_bias, p.dstC, size, p.activation, _params, p.trans, dst);
+                        src += p.srcC * size;
+                        dst += p.dstC * size;
+                    }
+                }
+            }
+            else
+                _dense->Forward(src, buf, dst);
+        }
+
+        bool SynetConvolution32fSparse::Preferable(const ConvParam32f & p)
+        {
+            return p.Is1x1() && p.group == 1 && p.srcC * p.dstC >= 1024;
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetInnerProduct32fSparse::SynetInnerProduct32fSparse(const InnerProductParam32f & p, SynetInnerProduct32f * dense)
+            : SynetInnerProduct32f(p)
+            , _dense(dense)
+        {
+            _gemm = Base::SparseGemm32fNS;
+            _biasAndActivation = Base::ConvolutionBiasAndActivation;
+        }
+
+        SynetInnerProduct32fSparse::~SynetInnerProduct32fSparse()
+        {
+            delete _dense;
+        }
+
+        String SynetInnerProduct32fSparse::Desc() const
+        {
+            return _sparse.Enable() ? Ext() + "::Sparse-" + ToStr(_sparse.B) : _dense->Desc();
+        }
+
+        size_t SynetInnerProduct32fSparse::InternalBufferSize() const
+        {
+            return _sparse.Enable() ? _sparse.Size() : _dense->InternalBufferSize();
+        }
+
+        void SynetInnerProduct32fSparse::SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
+        {
+            const InnerProductParam32f & p = _param;
+            SynetInnerProduct32f::SetParams(weight, internal, bias, params);
+            bool sparse = p.transpose ?
+                _sparse.Init(weight, p.output, p.input, p.input, 1, SPARSE_DENSITY_BLOCK, SPARSE_DENSITY_SINGLE) :
+                _sparse.Init(weight, p.output, p.input, 1, p.output, SPARSE_DENSITY_BLOCK, SPARSE_DENSITY_SINGLE);
+            if (sparse)
+            {
+                if (internal)
+                    *internal = SimdTrue;
+            }
+            else
+                _dense->SetParams(weight, internal, bias, params);
+        }
+
+        void SynetInnerProduct32fSparse::Forward(const float * src, float * dst)
+        {
+            const InnerProductParam32f & p = _param;
+            if (_sparse.Enable())
+            {
+                _gemm(p.batch, src, p.input, _sparse, dst, p.output);
+                _biasAndActivation(_bias, p.output, p.batch, p.activation, _params, SimdTrue, dst);
+            }
+            else
+                _dense->Forward(src, dst);
+        }
+
+        bool SynetInnerProduct32fSparse::Preferable(const InnerProductParam32f & p)
+        {
+            return p.weightType == SimdTensorData32f && p.input * p.output >= 1024;
+        }
+    }
+#endif//SIMD_SYNET_ENABLE
+}
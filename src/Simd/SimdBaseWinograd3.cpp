@@ -1265,6 +1265,264 @@ namespace Simd
                 }
             }
         }
+
+        //-----------------------------------------------------------------------
+
+        void WinogradKernel3x3Block6x6SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
+        {
+            if (trans)
+            {
+                for (size_t i = 0; i < size; i += 1)
+                    Base::WinogradKernel3x3Block6x6SetFilter1t(src + i, dst + i, size);
+            }
+            else
+            {
+                for (size_t i = 0; i < size; i += 1, src += 9, dst += 1)
+                    Base::WinogradKernel3x3Block6x6SetFilter1n(src, dst, size);
+            }
+        }
+
+        //-----------------------------------------------------------------------
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput8(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        {
+            float s0 = src[0 * srcStride], s1 = src[1 * srcStride], s2 = src[2 * srcStride], s3 = src[3 * srcStride];
+            float s4 = src[4 * srcStride], s5 = src[5 * srcStride], s6 = src[6 * srcStride], s7 = src[7 * srcStride];
+            dst[0 * dstStride] = s0 - s6 + 5.25f * (s4 - s2);
+            float t1 = s2 + s6 - 4.25f * s4;
+            float t2 = s1 + s5 - 4.25f * s3;
+            dst[1 * dstStride] = t1 + t2;
+            dst[2 * dstStride] = t1 - t2;
+            t1 = 0.25f * s2 - 1.25f * s4 + s6;
+            t2 = 0.5f * s1 - 2.5f * s3 + 2.0f * s5;
+            dst[3 * dstStride] = t1 + t2;
+            dst[4 * dstStride] = t1 - t2;
+            t1 = 4.0f * s2 - 5.0f * s4 + s6;
+            t2 = 2.0f * s1 - 2.5f * s3 + 0.5f * s5;
+            dst[5 * dstStride] = t1 + t2;
+            dst[6 * dstStride] = t1 - t2;
+            dst[7 * dstStride] = s7 - s1 + 5.25f * (s3 - s5);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput1(const float src[64], float * dst, size_t stride)
+        {
+            float tmp[64];
+            for (size_t col = 0; col < 8; ++col)
+                WinogradKernel3x3Block6x6SetInput8(src + col, 8, tmp + col, 8);
+            for (size_t row = 0; row < 8; ++row)
+                WinogradKernel3x3Block6x6SetInput8(tmp + row * 8, 1, dst + row * 8 * stride, stride);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput1n(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        {
+            float tmp[64];
+            for (size_t row = 0; row < 8; ++row)
+                for (size_t col = 0; col < 8; ++col)
+                    tmp[row * 8 + col] = src[row * srcStride + col];
+            WinogradKernel3x3Block6x6SetInput1(tmp, dst, dstStride);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput1n(const float * src, size_t srcStride, size_t rowB, size_t rowE, size_t colB, size_t colE, float * dst, size_t dstStride)
+        {
+            float tmp[64] = { 0 };
+            for (size_t row = rowB; row < rowE; ++row)
+                for (size_t col = colB; col < colE; ++col)
+                    tmp[row * 8 + col] = src[row * srcStride + col];
+            WinogradKernel3x3Block6x6SetInput1(tmp, dst, dstStride);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput1t(const float * src, size_t srcW, size_t srcC, float * dst, size_t dstStride)
+        {
+            size_t srcS = srcW * srcC;
+            for (size_t c = 0; c < srcC; ++c, src++, dst++)
+            {
+                float tmp[64];
+                for (size_t row = 0; row < 8; ++row)
+                    for (size_t col = 0; col < 8; ++col)
+                        tmp[row * 8 + col] = src[row * srcS + col * srcC];
+                WinogradKernel3x3Block6x6SetInput1(tmp, dst, dstStride);
+            }
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput1t(const float * src, size_t srcW, size_t srcC, size_t rowB, size_t rowE, size_t colB, size_t colE, float * dst, size_t dstStride)
+        {
+            size_t srcS = srcW * srcC;
+            for (size_t c = 0; c < srcC; ++c, src++, dst++)
+            {
+                float tmp[64] = { 0 };
+                for (size_t row = rowB; row < rowE; ++row)
+                    for (size_t col = colB; col < colE; ++col)
+                        tmp[row * 8 + col] = src[row * srcS + col * srcC];
+                WinogradKernel3x3Block6x6SetInput1(tmp, dst, dstStride);
+            }
+        }
+
+        void WinogradKernel3x3Block6x6SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
+            size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
+        {
+            assert(padY + padH <= 2 && padX + padW <= 2);
+            size_t dstH = srcHeight - 2 + padY + padH;
+            size_t dstW = srcWidth - 2 + padX + padW;
+            size_t dstH6 = dstH / 6 * 6;
+            size_t dstW6 = dstW / 6 * 6;
+            size_t noseW = Simd::Min<size_t>(8, srcWidth + padX);
+            size_t noseH = Simd::Min<size_t>(8, srcHeight + padY);
+            size_t startY = padY ? 6 : 0;
+            size_t startX = padX ? 6 : 0;
+            if (padH && dstH == dstH6)
+                dstH6 -= 6;
+            if (padY)
+                src -= srcWidth * (trans ? srcChannels : 1);
+            if (padW && dstW == dstW6)
+                dstW6 -= 6;
+            if (padX)
+                src -= 1 * (trans ? srcChannels : 1);
+            size_t tailW = dstW - dstW6 + (padW ? 1 : 2);
+            size_t tailH = dstH - dstH6 + (padH ? 1 : 2);
+            if (trans)
+            {
+                size_t row = 0, col = 0;
+                if (padY)
+                {
+                    if (padX)
+                        WinogradKernel3x3Block6x6SetInput1t(src, srcWidth, srcChannels, 1, noseH, 1, noseW, dst, dstStride), dst += srcChannels;
+                    for (col = startX; col < dstW6; col += 6)
+                        WinogradKernel3x3Block6x6SetInput1t(src + col * srcChannels, srcWidth, srcChannels, 1, noseH, 0, 8, dst, dstStride), dst += srcChannels;
+                    if (col < dstW)
+                        WinogradKernel3x3Block6x6SetInput1t(src + col * srcChannels, srcWidth, srcChannels, 1, noseH, 0, tailW, dst, dstStride), dst += srcChannels;
+                }
+                for (row = startY; row < dstH6; row += 6)
+                {
+                    if (padX)
+                        WinogradKernel3x3Block6x6SetInput1t(src + row * srcWidth * srcChannels, srcWidth, srcChannels, 0, 8, 1, noseW, dst, dstStride), dst += srcChannels;
+                    for (col = startX; col < dstW6; col += 6)
+                        WinogradKernel3x3Block6x6SetInput1t(src + (row * srcWidth + col) * srcChannels, srcWidth, srcChannels, dst, dstStride), dst += srcChannels;
+                    if (col < dstW)
+                        WinogradKernel3x3Block6x6SetInput1t(src + (row * srcWidth + col) * srcChannels, srcWidth, srcChannels, 0, 8, 0, tailW, dst, dstStride), dst += srcChannels;
+                }
+                if (row < dstH)
+                {
+                    if (padX)
+                        WinogradKernel3x3Block6x6SetInput1t(src + row * srcWidth * srcChannels, srcWidth, srcChannels, 0, tailH, 1, noseW, dst, dstStride), dst += srcChannels;
+                    for (col = startX; col < dstW6; col += 6)
+                        WinogradKernel3x3Block6x6SetInput1t(src + (row * srcWidth + col) * srcChannels, srcWidth, srcChannels, 0, tailH, 0, 8, dst, dstStride), dst += srcChannels;
+                    if (col < dstW)
+                        WinogradKernel3x3Block6x6SetInput1t(src + (row * srcWidth + col) * srcChannels, srcWidth, srcChannels, 0, tailH, 0, tailW, dst, dstStride), dst += srcChannels;
+                }
+            }
+            else
+            {
+                for (size_t c = 0; c < srcChannels; ++c)
+                {
+                    size_t row = 0, col = 0;
+                    if (padY)
+                    {
+                        if (padX)
+                            WinogradKernel3x3Block6x6SetInput1n(src, srcWidth, 1, noseH, 1, noseW, dst++, dstStride);
+                        for (col = startX; col < dstW6; col += 6)
+                            WinogradKernel3x3Block6x6SetInput1n(src + col, srcWidth, 1, noseH, 0, 8, dst++, dstStride);
+                        if (col < dstW)
+                            WinogradKernel3x3Block6x6SetInput1n(src + col, srcWidth, 1, noseH, 0, tailW, dst++, dstStride);
+                    }
+                    for (row = startY; row < dstH6; row += 6)
+                    {
+                        if (padX)
+                            WinogradKernel3x3Block6x6SetInput1n(src + row * srcWidth, srcWidth, 0, 8, 1, noseW, dst++, dstStride);
+                        for (col = startX; col < dstW6; col += 6)
+                            WinogradKernel3x3Block6x6SetInput1n(src + row * srcWidth + col, srcWidth, dst++, dstStride);
+                        if (col < dstW)
+                            WinogradKernel3x3Block6x6SetInput1n(src + row * srcWidth + col, srcWidth, 0, 8, 0, tailW, dst++, dstStride);
+                    }
+                    if (row < dstH)
+                    {
+                        if (padX)
+                            WinogradKernel3x3Block6x6SetInput1n(src + row * srcWidth, srcWidth, 0, tailH, 1, noseW, dst++, dstStride);
+                        for (col = startX; col < dstW6; col += 6)
+                            WinogradKernel3x3Block6x6SetInput1n(src + row * srcWidth + col, srcWidth, 0, tailH, 0, 8, dst++, dstStride);
+                        if (col < dstW)
+                            WinogradKernel3x3Block6x6SetInput1n(src + row * srcWidth + col, srcWidth, 0, tailH, 0, tailW, dst++, dstStride);
+                    }
+                    src += srcWidth * srcHeight;
+                }
+            }
+        }
+
+        //-----------------------------------------------------------------------
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetOutput8(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        {
+            float s0 = src[0 * srcStride], s1 = src[1 * srcStride], s2 = src[2 * srcStride], s3 = src[3 * srcStride];
+            float s4 = src[4 * srcStride], s5 = src[5 * srcStride], s6 = src[6 * srcStride], s7 = src[7 * srcStride];
+            float a12 = s1 + s2, a34 = s3 + s4, a56 = s5 + s6;
+            float d12 = s1 - s2, d34 = s3 - s4, d56 = s5 - s6;
+            dst[0 * dstStride] = s0 + a12 + a34 + a56;
+            dst[1 * dstStride] = d12 + 2.0f * d34 + 0.5f * d56;
+            dst[2 * dstStride] = a12 + 4.0f * a34 + 0.25f * a56;
+            dst[3 * dstStride] = d12 + 8.0f * d34 + 0.125f * d56;
+            dst[4 * dstStride] = a12 + 16.0f * a34 + 0.0625f * a56;
+            dst[5 * dstStride] = d12 + 32.0f * d34 + 0.03125f * d56 + s7;
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetOutput1(const float * src, size_t stride, float dst[36])
+        {
+            float tmp[48];
+            for (size_t col = 0; col < 8; ++col)
+                WinogradKernel3x3Block6x6SetOutput8(src + col * stride, 8 * stride, tmp + col, 8);
+            for (size_t row = 0; row < 6; ++row)
+                WinogradKernel3x3Block6x6SetOutput8(tmp + row * 8, 1, dst + row * 6, 1);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetOutput1n(const float * src, size_t srcStride, float * dst, size_t dstStride, size_t rowE, size_t colE)
+        {
+            float tmp[36];
+            WinogradKernel3x3Block6x6SetOutput1(src, srcStride, tmp);
+            for (size_t row = 0; row < rowE; ++row)
+                for (size_t col = 0; col < colE; ++col)
+                    dst[row * dstStride + col] = tmp[row * 6 + col];
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetOutput1t(const float * src, size_t srcStride, float * dst, size_t dstW, size_t dstC, size_t rowE, size_t colE)
+        {
+            size_t dstS = dstW * dstC;
+            for (size_t d = 0; d < dstC; ++d, src++, dst++)
+            {
+                float tmp[36];
+                WinogradKernel3x3Block6x6SetOutput1(src, srcStride, tmp);
+                for (size_t row = 0; row < rowE; ++row)
+                    for (size_t col = 0; col < colE; ++col)
+                        dst[row * dstS + col * dstC] = tmp[row * 6 + col];
+            }
+        }
+
+        void WinogradKernel3x3Block6x6SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
+        {
+            if (trans)
+            {
+                for (size_t row = 0; row < dstHeight; row += 6)
+                {
+                    size_t rowE = Simd::Min<size_t>(6, dstHeight - row);
+                    for (size_t col = 0; col < dstWidth; col += 6)
+                    {
+                        size_t colE = Simd::Min<size_t>(6, dstWidth - col);
+                        WinogradKernel3x3Block6x6SetOutput1t(src, srcStride, dst + (row * dstWidth + col) * dstChannels, dstWidth, dstChannels, rowE, colE);
+                        src += dstChannels;
+                    }
+                }
+            }
+            else
+            {
+                for (size_t c = 0; c < dstChannels; ++c)
+                {
+                    for (size_t row = 0; row < dstHeight; row += 6)
+                    {
+                        size_t rowE = Simd::Min<size_t>(6, dstHeight - row);
+                        for (size_t col = 0; col < dstWidth; col += 6)
+                            WinogradKernel3x3Block6x6SetOutput1n(src++, srcStride, dst + row * dstWidth + col, dstWidth, rowE, Simd::Min<size_t>(6, dstWidth - col));
+                    }
+                    dst += dstHeight * dstWidth;
+                }
+            }
+        }
     }
 #endif
 }
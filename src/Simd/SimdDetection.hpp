@@ -30,7 +30,12 @@
 
 #include <vector>
 #include <map>
+#include <fstream>
 #include <memory>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <cmath>
 
 #include <limits.h>
 
@@ -209,6 +214,7 @@ namespace Simd
             Creates a new empty Detection structure.
         */
         Detection()
+            : _frame(0)
         {
         }
 
@@ -251,7 +257,7 @@ namespace Simd
         }
 
         /*!
-            Loads from file classifier cascade. Supports OpenCV HAAR and LBP cascades type.
+            Loads from file classifier cascade. Supports OpenCV HAAR and LBP cascades type and binary format created by Detection::SaveBinary.
             You can call this function more than once if you want to use several object detectors at the same time.
 
             \note Tree based cascades and old cascade formats are not supported!
@@ -274,6 +280,51 @@ namespace Simd
             return handle != NULL;
         }
 
+        /*!
+            Loads classifier cascade from memory buffer in binary format. This format is created by function Detection::SaveBinary. 
+            Its loading does not need XML parsing, so the buffer can be read from file (or mapped to memory) by user and passed as is.
+            You can call this function more than once if you want to use several object detectors at the same time.
+
+            \param [in] buffer - a pointer to the buffer with binary cascade.
+            \param [in] size - a size of the buffer.
+            \param [in] tag - an user defined tag. This tag will be inserted in output Object structure.
+            \return a result of this operation.
+        */
+        bool LoadBinary(const uint8_t * buffer, size_t size, Tag tag = UNDEFINED_OBJECT_TAG)
+        {
+            Handle handle = ::SimdDetectionLoadBinary(buffer, size);
+            if (handle)
+            {
+                Data data;
+                data.handle = handle;
+                data.tag = tag;
+                ::SimdDetectionInfo(handle, (size_t*)&data.size.x, (size_t*)&data.size.y, &data.flags);
+                _data.push_back(data);
+            }
+            return handle != NULL;
+        }
+
+        /*!
+            Saves loaded classifier cascade to file in binary format. 
+            It can be used to convert OpenCV XML cascade to binary format which is loaded much faster by functions Detection::Load and Detection::LoadBinary.
+
+            \param [in] path - a path to output file.
+            \param [in] index - an index of saved cascade (in order of loading).
+            \return a result of this operation.
+        */
+        bool SaveBinary(const std::string & path, size_t index = 0) const
+        {
+            if (index >= _data.size())
+                return false;
+            std::vector<uint8_t> buffer(::SimdDetectionSaveBinary(_data[index].handle, NULL, 0));
+            ::SimdDetectionSaveBinary(_data[index].handle, buffer.data(), buffer.size());
+            std::ofstream ofs(path.c_str(), std::ofstream::binary);
+            if (!ofs.is_open())
+                return false;
+            ofs.write((const char*)buffer.data(), buffer.size());
+            return ofs.good();
+        }
+
         /*!
             Prepares Detection structure to work with image of given size.
 
@@ -295,7 +346,9 @@ namespace Simd
             _imageSize = imageSize;
             ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
             _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
-            return InitLevels(scaleFactor, sizeMin, sizeMax, roi);
+            _frame = 0;
+            _tracked.clear();
+            return InitLevels(_imageSize, scaleFactor, sizeMin, sizeMax, roi, _levels);
         }
 
         /*!
@@ -318,41 +371,189 @@ namespace Simd
             if (_levels.empty() || src.Size() != _imageSize)
                 return false;
 
-            FillLevels(src);
+            for (size_t i = 0; i < _levels.size(); ++i)
+            {
+                Level & level = *_levels[i];
+                level.active = level.rect;
+                level.masked = motionMask;
+                if (motionMask)
+                    FillMotionMask(motionRegions, level, level.active);
+            }
 
-            typedef std::map<Tag, Objects> Candidates;
-            Candidates candidates;
+            DetectLevels(src, _levels, objects, groupSizeMin, sizeDifferenceMax, _threadNumber);
+
+            return true;
+        }
+
+        /*!
+            Detects objects at given frame of video stream.
+
+            The function performs full detection at every period-th frame. At other frames it scans only neighborhoods of objects
+            detected at previous frame (at pyramid levels with nearby scales) and given motion regions.
+            So cost of detection at the most frames is proportional to number of detected objects instead of image area.
+
+            \note The detection state is reset by Init().
+
+            \param [in] src - a input frame.
+            \param [out] objects - detected objects.
+            \param [in] period - a period (in frames) of full detection. Use value 1 to perform full detection at every frame.
+            \param [in] neighborhood - a relative size of neighborhood of previously detected object which is scanned at next frame.
+            \param [in] scaleRange - a maximal ratio between size of previously detected object and size of scanning window.
+            \param [in] groupSizeMin - a minimal weight (number of elementary detections) of detected image.
+            \param [in] sizeDifferenceMax - a parameter to group elementary detections.
+            \param [in] motionRegions - a set of rectangles (motion regions) which are additionally scanned at frames without full detection.
+                                        The regions affect to the center of detected object.
+            \return a result of this operation.
+        */
+        bool DetectVideo(const View & src, Objects & objects, size_t period = 8, double neighborhood = 0.5, double scaleRange = 1.5,
+            int groupSizeMin = 3, double sizeDifferenceMax = 0.2, const Rects & motionRegions = Rects())
+        {
+            SIMD_CHECK_PERFORMANCE();
+
+            if (_levels.empty() || src.Size() != _imageSize)
+                return false;
+
+            bool full = period <= 1 || _frame % period == 0;
+            _frame++;
 
+            Rects regions;
             for (size_t i = 0; i < _levels.size(); ++i)
             {
                 Level & level = *_levels[i];
-                View mask = level.roi;
-                Rect rect = level.rect;
-                if (motionMask)
-                {
-                    FillMotionMask(motionRegions, level, rect);
-                    mask = level.mask;
-                }
-                if (rect.Empty())
+                level.active = level.rect;
+                level.masked = !full;
+                if (full)
                     continue;
-                for (size_t j = 0; j < level.hids.size(); ++j)
+                regions = motionRegions;
+                for (size_t j = 0; j < _tracked.size(); ++j)
                 {
-                    Hid & hid = level.hids[j];
+                    const Rect & r = _tracked[j].rect;
+                    bool nearby = false;
+                    for (size_t k = 0; k < level.hids.size() && !nearby; ++k)
+                    {
+                        double size = level.hids[k].data->size.x * level.scale;
+                        nearby = r.Width() * scaleRange >= size && r.Width() <= size * scaleRange;
+                    }
+                    if (nearby)
+                    {
+                        ptrdiff_t dx = ptrdiff_t(r.Width() * neighborhood), dy = ptrdiff_t(r.Height() * neighborhood);
+                        regions.push_back(Rect(r.left - dx, r.top - dy, r.right + dx, r.bottom + dy));
+                    }
+                }
+                FillMotionMask(regions, level, level.active);
+            }
 
-                    hid.Detect(mask, rect, level.dst, _threadNumber, level.throughColumn);
+            DetectLevels(src, _levels, objects, groupSizeMin, sizeDifferenceMax, _threadNumber);
 
-                    AddObjects(candidates[hid.data->tag], level.dst, rect, hid.data->size, level.scale,
-                        level.throughColumn ? 2 : 1, hid.data->tag);
+            _tracked = objects;
+
+            return true;
+        }
+
+        typedef std::vector<View> Views; /*!< A vector of images type definition. */
+        typedef std::vector<Objects> ObjectsVector; /*!< A vector of detected objects (for several images) type definition. */
+
+        /*!
+            Prepares Detection structure to work with batches of images of arbitrary sizes (see DetectBatch()).
+
+            \param [in] scaleFactor - a scale factor. To detect objects of different sizes the algorithm uses many scaled image.
+                                      This parameter defines size difference between neighboring images. This parameter strongly affects to performance.
+            \param [in] sizeMin - a minimal size of detected objects. This parameter strongly affects to performance.
+            \param [in] sizeMax - a maximal size of detected objects.
+            \param [in] threadNumber - a number of work threads. It useful for multi core CPU. Use value -1 to auto choose of thread number.
+            \param [in] poolMax - a maximal number of cached image pyramids (see DetectBatch()). Use value 0 to auto choose (2 * threadNumber).
+            \return a result of this operation.
+        */
+        bool InitBatch(double scaleFactor = 1.1, const Size & sizeMin = Size(0, 0), const Size & sizeMax = Size(INT_MAX, INT_MAX), 
+            ptrdiff_t threadNumber = -1, size_t poolMax = 0)
+        {
+            if (_data.empty())
+                return false;
+            ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
+            _batch.threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
+            _batch.scaleFactor = scaleFactor;
+            _batch.sizeMin = sizeMin;
+            _batch.sizeMax = sizeMax;
+            _batch.poolMax = poolMax ? poolMax : 2 * _batch.threadNumber;
+            _batch.call = 0;
+            _batch.pool.clear();
+            return true;
+        }
+
+        /*!
+            Detects objects at batch of images of different sizes.
+
+            Images are processed in parallel. If the batch is smaller than number of threads then every image is processed by several threads.
+            Buffers of image pyramid are allocated for size classes (image sizes are rounded up to multiple of Detection::BATCH_QUANTUM) 
+            and are reused in following calls of this function. The number of cached pyramids is restricted by parameter poolMax of InitBatch():
+            pyramids of the least recently used size classes are released. The function doesn't change state of Detect() and DetectVideo().
+
+            \note Detection structure must be prepared by InitBatch().
+
+            \param [in] images - a batch of input images.
+            \param [out] objects - detected objects for every image of the batch.
+            \param [in] groupSizeMin - a minimal weight (number of elementary detections) of detected image.
+            \param [in] sizeDifferenceMax - a parameter to group elementary detections.
+            \return a result of this operation.
+        */
+        bool DetectBatch(const Views & images, ObjectsVector & objects, int groupSizeMin = 3, double sizeDifferenceMax = 0.2)
+        {
+            SIMD_CHECK_PERFORMANCE();
+
+            if (_data.empty() || _batch.threadNumber <= 0)
+                return false;
+
+            size_t threadNumber = std::min<size_t>(_batch.threadNumber, images.size());
+            size_t imageThreadNumber = std::max<size_t>(_batch.threadNumber / std::max<size_t>(threadNumber, 1), 1);
+            _batch.call++;
+            std::map<SizeKey, size_t> counts;
+            for (size_t i = 0; i < images.size(); ++i)
+                counts[BatchClass(images[i].Size())]++;
+            for (typename std::map<SizeKey, size_t>::const_iterator it = counts.begin(); it != counts.end(); ++it)
+            {
+                typename Batch::Class & cls = _batch.pool[it->first];
+                cls.used = _batch.call;
+                size_t need = std::min(it->second, threadNumber);
+                while (cls.sets.size() < need)
+                {
+                    cls.sets.push_back(LevelPtrs());
+                    InitLevels(Size(it->first.first, it->first.second), _batch.scaleFactor, _batch.sizeMin, _batch.sizeMax, View(), cls.sets.back());
                 }
             }
+            EvictBatchPool();
 
-            objects.clear();
-            for (typename Candidates::iterator it = candidates.begin(); it != candidates.end(); ++it)
-                GroupObjects(objects, it->second, groupSizeMin, sizeDifferenceMax);
+            std::map<SizeKey, std::vector<size_t> > idle;
+            for (typename std::map<SizeKey, size_t>::const_iterator it = counts.begin(); it != counts.end(); ++it)
+                for (size_t j = 0; j < std::min(it->second, threadNumber); ++j)
+                    idle[it->first].push_back(j);
+
+            std::mutex mutex;
+            objects.resize(images.size());
+            RunParallel(images.size(), threadNumber, [&](size_t i)
+            {
+                SizeKey key = BatchClass(images[i].Size());
+                size_t index;
+                const LevelPtrs * levels;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    index = idle[key].back();
+                    idle[key].pop_back();
+                    levels = &_batch.pool[key].sets[index];
+                }
+                LevelPtrs cropped;
+                CropLevels(*levels, images[i].Size(), cropped);
+                DetectLevels(images[i], cropped, objects[i], groupSizeMin, sizeDifferenceMax, imageThreadNumber);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    idle[key].push_back(index);
+                }
+            });
 
             return true;
         }
 
+        static const ptrdiff_t BATCH_QUANTUM = 64; /*!< A granularity of image size classes used in DetectBatch(). */
+
     private:
 
         typedef void * Handle;
@@ -376,26 +577,61 @@ namespace Simd
         typedef std::shared_ptr<Worker> WorkerPtr;
         typedef std::vector<WorkerPtr> WorkerPtrs;
 
+        struct Hid;
+
+        struct Task
+        {
+            Hid * hid;
+            View mask;
+            Rect rect;
+            size_t cost;
+
+            Task(Hid * h, const View & m, const Rect & r, size_t c)
+                : hid(h), mask(m), rect(r), cost(c)
+            {
+            }
+
+            SIMD_INLINE bool operator < (const Task & other) const
+            {
+                return cost > other.cost;
+            }
+        };
+        typedef std::vector<Task> Tasks;
+
         struct Hid
         {
             Handle handle;
             Data * data;
             DetectPtr detect;
+            View dst;
 
-            void Detect(const View & mask, const Rect & rect, View & dst, size_t threadNumber, bool throughColumn)
+            void Prepare(const View & mask, const Rect & rect, bool throughColumn, Tasks & tasks)
             {
-                SIMD_CHECK_PERFORMANCE();
-
                 Size s = dst.Size() - data->size;
                 View m = mask.Region(s, View::MiddleCenter);
-                Rect r = rect.Shifted(-data->size / 2).Intersection(Rect(s));
+                Rect r = rect.Shifted(-data->size / 2);
+                if (throughColumn)
+                    r.left += r.left & 1, r.top += r.top & 1; // keeps the grid of even rows and columns
+                r = r.Intersection(Rect(s));
                 Simd::Fill(dst, 0);
                 ::SimdDetectionPrepare(handle);
-
-                Parallel(r.top, r.bottom, [&](size_t thread, size_t begin, size_t end)
+                if (r.Empty())
+                    return;
+                size_t weight = data->Haar() ? 3 : 1, step = throughColumn ? 2 : 1, area = 8192, rowsMin = 4;
+                size_t band = (std::max<size_t>(area / r.Width(), rowsMin) + step - 1) / step * step;
+                for (ptrdiff_t top = r.top; top < r.bottom; top += band)
                 {
-                    detect(handle, m.data, m.stride, r.left, begin, r.right, end, dst.data, dst.stride);
-                }, rect.Area() >= (data->Haar() ? 10000 : 30000) ? threadNumber : 1, throughColumn ? 2 : 1);
+                    ptrdiff_t bottom = std::min<ptrdiff_t>(top + band, r.bottom);
+                    tasks.push_back(Task(this, m, Rect(r.left, top, r.right, bottom), (bottom - top) * r.Width() * weight));
+                }
+            }
+
+            void Detect(const Task & task)
+            {
+                SIMD_CHECK_PERFORMANCE();
+
+                const Rect & r = task.rect;
+                detect(handle, task.mask.data, task.mask.stride, r.left, r.top, r.right, r.bottom, dst.data, dst.stride);
             }
         };
         typedef std::vector<Hid> Hids;
@@ -410,20 +646,23 @@ namespace Simd
             View mask;
 
             Rect rect;
+            Rect active;
+            bool masked;
 
             View sum;
             View sqsum;
             View tilted;
 
-            View dst;
-
             bool throughColumn;
             bool needSqsum;
             bool needTilted;
+            bool owner;
+
+            Level() : owner(true) {}
 
             ~Level()
             {
-                for (size_t i = 0; i < hids.size(); ++i)
+                for (size_t i = 0; owner && i < hids.size(); ++i)
                     ::SimdRelease(hids[i].handle);
             }
         };
@@ -432,15 +671,97 @@ namespace Simd
 
         std::vector<Data> _data;
         Size _imageSize;
-        bool _needNormalization;
         ptrdiff_t _threadNumber;
         LevelPtrs _levels;
+        size_t _frame;
+        Objects _tracked;
+
+        typedef std::pair<ptrdiff_t, ptrdiff_t> SizeKey;
+
+        struct Batch
+        {
+            struct Class
+            {
+                std::vector<LevelPtrs> sets;
+                size_t used;
+
+                Class() : used(0) {}
+            };
+            typedef std::map<SizeKey, Class> Pool;
+
+            ptrdiff_t threadNumber;
+            double scaleFactor;
+            Size sizeMin, sizeMax;
+            size_t poolMax, call;
+            Pool pool;
+
+            Batch() : threadNumber(0), scaleFactor(1.1), poolMax(0), call(0) {}
+        } _batch;
+
+        static SizeKey BatchClass(const Size & size)
+        {
+            return SizeKey((size.x + BATCH_QUANTUM - 1) / BATCH_QUANTUM * BATCH_QUANTUM, (size.y + BATCH_QUANTUM - 1) / BATCH_QUANTUM * BATCH_QUANTUM);
+        }
+
+        void EvictBatchPool()
+        {
+            size_t total = 0;
+            for (typename Batch::Pool::const_iterator it = _batch.pool.begin(); it != _batch.pool.end(); ++it)
+                total += it->second.sets.size();
+            while (total > _batch.poolMax)
+            {
+                typename Batch::Pool::iterator lru = _batch.pool.end();
+                for (typename Batch::Pool::iterator it = _batch.pool.begin(); it != _batch.pool.end(); ++it)
+                    if (it->second.used != _batch.call && (lru == _batch.pool.end() || it->second.used < lru->second.used))
+                        lru = it;
+                if (lru == _batch.pool.end())
+                    break;
+                total -= lru->second.sets.size();
+                _batch.pool.erase(lru);
+            }
+        }
+
+        void CropLevels(const LevelPtrs & full, const Size & imageSize, LevelPtrs & levels) const
+        {
+            levels.clear();
+            for (size_t i = 0; i < full.size(); ++i)
+            {
+                const Level & src = *full[i];
+                Size scaledSize(imageSize / src.scale);
+                LevelPtr dst(new Level());
+                dst->owner = false;
+                dst->scale = src.scale;
+                dst->throughColumn = src.throughColumn;
+                dst->needSqsum = false, dst->needTilted = false;
+                for (size_t j = 0; j < src.hids.size(); ++j)
+                {
+                    Size windowSize = src.hids[j].data->size * src.scale;
+                    if (windowSize.x > imageSize.x || windowSize.y > imageSize.y)
+                        continue;
+                    dst->hids.push_back(src.hids[j]);
+                    dst->hids.back().dst = src.hids[j].dst.Region(Rect(scaledSize));
+                    dst->needSqsum = dst->needSqsum | src.hids[j].data->Haar();
+                    dst->needTilted = dst->needTilted | src.hids[j].data->Tilted();
+                }
+                if (dst->hids.empty())
+                    continue;
+                dst->src = src.src.Region(Rect(scaledSize));
+                dst->roi = src.roi.Region(Rect(scaledSize));
+                dst->mask = src.mask.Region(Rect(scaledSize));
+                dst->sum = src.sum.Region(Rect(scaledSize + Size(1, 1)));
+                dst->sqsum = src.sqsum.Region(Rect(scaledSize + Size(1, 1)));
+                dst->tilted = src.tilted.Region(Rect(scaledSize + Size(1, 1)));
+                dst->rect = Rect(scaledSize);
+                dst->active = dst->rect;
+                dst->masked = false;
+                levels.push_back(dst);
+            }
+        }
 
-        bool InitLevels(double scaleFactor, const Size & sizeMin, const Size & sizeMax, const View & roi)
+        bool InitLevels(const Size & imageSize, double scaleFactor, const Size & sizeMin, const Size & sizeMax, const View & roi, LevelPtrs & levels)
         {
-            _needNormalization = false;
-            _levels.clear();
-            _levels.reserve(100);
+            levels.clear();
+            levels.reserve(100);
             double scale = 1.0;
             do
             {
@@ -450,7 +771,7 @@ namespace Simd
                 {
                     Size windowSize = _data[i].size * scale;
                     if (windowSize.x <= sizeMax.x && windowSize.y <= sizeMax.y &&
-                        windowSize.x <= _imageSize.x && windowSize.y <= _imageSize.y)
+                        windowSize.x <= imageSize.x && windowSize.y <= imageSize.y)
                     {
                         if (windowSize.x >= sizeMin.x && windowSize.y >= sizeMin.y)
                             insert = inserts[i] = true;
@@ -462,12 +783,12 @@ namespace Simd
 
                 if (insert)
                 {
-                    _levels.push_back(LevelPtr(new Level()));
-                    Level & level = *_levels.back();
+                    levels.push_back(LevelPtr(new Level()));
+                    Level & level = *levels.back();
 
                     level.scale = scale;
                     level.throughColumn = scale <= 2.0;
-                    Size scaledSize(_imageSize / scale);
+                    Size scaledSize(imageSize / scale);
 
                     level.src.Recreate(scaledSize, View::Gray8);
                     level.roi.Recreate(scaledSize, View::Gray8);
@@ -477,8 +798,6 @@ namespace Simd
                     level.sqsum.Recreate(scaledSize + Size(1, 1), View::Int32);
                     level.tilted.Recreate(scaledSize + Size(1, 1), View::Int32);
 
-                    level.dst.Recreate(scaledSize, View::Gray8);
-
                     level.needSqsum = false, level.needTilted = false;
                     for (size_t i = 0; i < _data.size(); ++i)
                     {
@@ -501,12 +820,12 @@ namespace Simd
                                     hid.detect = level.throughColumn ? ::SimdDetectionLbpDetect32fi : ::SimdDetectionLbpDetect32fp;
                             }
                             level.hids.push_back(hid);
+                            level.hids.back().dst.Recreate(scaledSize, View::Gray8);
                         }
                         else
                             return false;
                         level.needSqsum = level.needSqsum | _data[i].Haar();
                         level.needTilted = level.needTilted | _data[i].Tilted();
-                        _needNormalization = _needNormalization | _data[i].Haar();
                     }
 
                     level.rect = Rect(level.roi.Size());
@@ -521,10 +840,10 @@ namespace Simd
                 }
                 scale *= scaleFactor;
             } while (true);
-            return !_levels.empty();
+            return !levels.empty();
         }
 
-        void FillLevels(View src)
+        void FillLevels(View src, LevelPtrs & levels, size_t threadNumber)
         {
             View gray;
             if (src.format != View::Gray8)
@@ -534,48 +853,201 @@ namespace Simd
                 src = gray;
             }
 
-            Simd::ResizeBilinear(src, _levels[0]->src);
-            if (_needNormalization)
-                Simd::NormalizeHistogram(_levels[0]->src, _levels[0]->src);
-            EstimateIntegral(*_levels[0]);
-            for (size_t i = 1; i < _levels.size(); ++i)
+            Simd::ResizeBilinear(src, levels[0]->src);
+            if (NeedNormalization(levels))
+                Simd::NormalizeHistogram(levels[0]->src, levels[0]->src);
+            RunParallel(levels.size(), threadNumber, [&](size_t i)
+            {
+                if (levels[i]->active.Empty())
+                    return;
+                Rect region = IntegralRegion(*levels[i]);
+                if (i)
+                {
+                    if (region == Rect(levels[i]->src.Size()))
+                        Simd::ResizeBilinear(levels[0]->src, levels[i]->src);
+                    else
+                        ResizeBilinear(levels[0]->src, levels[i]->src, region);
+                }
+                EstimateIntegral(*levels[i], region);
+            });
+        }
+
+        static Rect IntegralRegion(const Level & level)
+        {
+            Rect full(level.src.Size());
+            if (!level.masked)
+                return full;
+            ptrdiff_t border = 0;
+            for (size_t i = 0; i < level.hids.size(); ++i)
+                border = std::max(border, std::max(level.hids[i].data->size.x, level.hids[i].data->size.y));
+            Rect region(level.active.left - border, level.active.top - border, level.active.right + border, level.active.bottom + border);
+            region &= full;
+            if (level.needTilted)
+                region = Rect(0, 0, full.right, region.bottom); // tilted integral depends on all pixels above.
+            return region;
+        }
+
+        static void AlphaIndex(size_t i, float scale, size_t size, ptrdiff_t & index, int & alpha)
+        {
+            float a = (float)((i + 0.5)*scale - 0.5);
+            index = (ptrdiff_t)::floor(a);
+            a -= index;
+            if (index < 0)
+            {
+                index = 0;
+                a = 0;
+            }
+            if (index > (ptrdiff_t)size - 2)
+            {
+                index = size - 2;
+                a = 1;
+            }
+            alpha = (int)(a * 16 + 0.5);
+        }
+
+        static void ResizeBilinear(const View & src, View & dst, const Rect & region)
+        {
+            // It gives the same result in the region as Simd::ResizeBilinear(src, dst) (the same 4-bit fixed point arithmetic).
+            float scaleX = (float)src.width / dst.width, scaleY = (float)src.height / dst.height;
+            std::vector<ptrdiff_t> ix(region.Width());
+            std::vector<int> ax(region.Width());
+            for (ptrdiff_t col = region.left; col < region.right; ++col)
+                AlphaIndex(col, scaleX, src.width, ix[col - region.left], ax[col - region.left]);
+            for (ptrdiff_t row = region.top; row < region.bottom; ++row)
+            {
+                ptrdiff_t iy;
+                int ay;
+                AlphaIndex(row, scaleY, src.height, iy, ay);
+                const uint8_t * s0 = src.data + iy * src.stride, * s1 = s0 + src.stride;
+                uint8_t * d = dst.data + row * dst.stride;
+                for (ptrdiff_t col = region.left; col < region.right; ++col)
+                {
+                    ptrdiff_t x = ix[col - region.left];
+                    int a = ax[col - region.left];
+                    int p0 = (s0[x] << 4) + (s0[x + 1] - s0[x]) * a;
+                    int p1 = (s1[x] << 4) + (s1[x + 1] - s1[x]) * a;
+                    d[col] = uint8_t(((p0 << 4) + (p1 - p0) * ay + 128) >> 8);
+                }
+            }
+        }
+
+        static bool NeedNormalization(const LevelPtrs & levels)
+        {
+            for (size_t i = 0; i < levels.size(); ++i)
+                for (size_t j = 0; j < levels[i]->hids.size(); ++j)
+                    if (levels[i]->hids[j].data->Haar())
+                        return true;
+            return false;
+        }
+
+        void DetectLevels(const View & src, LevelPtrs & levels, Objects & objects, int groupSizeMin, double sizeDifferenceMax, size_t threadNumber)
+        {
+            objects.clear();
+            if (levels.empty())
+                return;
+
+            FillLevels(src, levels, threadNumber);
+
+            Tasks tasks;
+            for (size_t i = 0; i < levels.size(); ++i)
+            {
+                Level & level = *levels[i];
+                if (level.active.Empty())
+                    continue;
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                    level.hids[j].Prepare(level.masked ? level.mask : level.roi, level.active, level.throughColumn, tasks);
+            }
+            RunTasks(tasks, threadNumber);
+
+            typedef std::map<Tag, Objects> Candidates;
+            Candidates candidates;
+
+            for (size_t i = 0; i < levels.size(); ++i)
+            {
+                Level & level = *levels[i];
+                if (level.active.Empty())
+                    continue;
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                {
+                    Hid & hid = level.hids[j];
+                    AddObjects(candidates[hid.data->tag], hid.dst, level.active, hid.data->size, level.scale,
+                        level.throughColumn ? 2 : 1, hid.data->tag);
+                }
+            }
+
+            for (typename Candidates::iterator it = candidates.begin(); it != candidates.end(); ++it)
+                GroupObjects(objects, it->second, groupSizeMin, sizeDifferenceMax);
+        }
+
+        template<class Function> void RunParallel(size_t count, size_t threadNumber, const Function & function)
+        {
+            threadNumber = std::min<size_t>(threadNumber, count);
+            if (threadNumber <= 1)
             {
-                Simd::ResizeBilinear(_levels[0]->src, _levels[i]->src);
-                EstimateIntegral(*_levels[i]);
+                for (size_t i = 0; i < count; ++i)
+                    function(i);
             }
+            else
+            {
+                std::atomic<size_t> next(0);
+                Parallel(0, threadNumber, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = next++; i < count; i = next++)
+                        function(i);
+                }, threadNumber);
+            }
+        }
+
+        void RunTasks(Tasks & tasks, size_t threadNumber)
+        {
+            std::stable_sort(tasks.begin(), tasks.end());
+            RunParallel(tasks.size(), threadNumber, [&](size_t i)
+            {
+                tasks[i].hid->Detect(tasks[i]);
+            });
         }
 
-        void EstimateIntegral(Level & level)
+        void EstimateIntegral(Level & level, const Rect & region)
         {
+            // Integrals of the region differ from the full ones by constants which are cancelled in features of windows inside the region.
+            View src = level.src.Region(region);
+            Rect r(region.left, region.top, region.right + 1, region.bottom + 1);
+            View sum = level.sum.Region(r), sqsum = level.sqsum.Region(r), tilted = level.tilted.Region(r);
             if (level.needSqsum)
             {
                 if (level.needTilted)
-                    Simd::Integral(level.src, level.sum, level.sqsum, level.tilted);
+                    Simd::Integral(src, sum, sqsum, tilted);
                 else
-                    Simd::Integral(level.src, level.sum, level.sqsum);
+                    Simd::Integral(src, sum, sqsum);
             }
             else
-                Simd::Integral(level.src, level.sum);
+                Simd::Integral(src, sum);
         }
 
         void FillMotionMask(const Rects & rects, Level & level, Rect & rect) const
         {
-            Simd::Fill(level.mask, 0);
             rect = Rect();
+            for (size_t i = 0; i < rects.size(); i++)
+                rect |= rects[i] / level.scale;
+            rect &= level.rect;
+            if (rect.Empty())
+                return;
+            View mask = level.mask.Region(rect);
+            Simd::Fill(mask, 0);
             for (size_t i = 0; i < rects.size(); i++)
             {
-                Rect r = rects[i] / level.scale;
-                rect |= r;
-                Simd::Fill(level.mask.Region(r).Ref(), 0xFF);
+                Rect r = (rects[i] / level.scale).Intersection(rect);
+                if (!r.Empty())
+                    Simd::Fill(level.mask.Region(r).Ref(), 0xFF);
             }
-            rect &= level.rect;
-            Simd::OperationBinary8u(level.mask, level.roi, level.mask, SimdOperationBinary8uAnd);
+            Simd::OperationBinary8u(mask, level.roi.Region(rect), mask, SimdOperationBinary8uAnd);
         }
 
         void AddObjects(Objects & objects, const View & dst, const Rect & rect, const Size & size, double scale, size_t step, Tag tag)
         {
             Size s = dst.Size() - size;
             Rect r = rect.Shifted(-size / 2).Intersection(Rect(s));
+            r.left = (r.left + step - 1) / step * step, r.top = (r.top + step - 1) / step * step;
             for (ptrdiff_t row = r.top; row < r.bottom; row += step)
             {
                 const uint8_t * mask = dst.data + row*dst.stride;
@@ -587,35 +1059,105 @@ namespace Simd
             }
         }
 
-        struct Similar
+        struct Grid
         {
-            Similar(double sizeDifferenceMax)
-                : _sizeDifferenceMax(sizeDifferenceMax)
-            {}
+            std::vector<ptrdiff_t> left, top, right, bottom;
+            std::vector<int> start, index;
+            ptrdiff_t xMin, yMin, width, height;
+            double cell, sizeDifferenceMax;
+
+            Grid(const Objects & objects, double sdm)
+                : sizeDifferenceMax(sdm)
+            {
+                size_t size = objects.size();
+                left.resize(size), top.resize(size), right.resize(size), bottom.resize(size);
+                ptrdiff_t xMax = 0, yMax = 0;
+                xMin = size ? objects[0].rect.left : 0, yMin = size ? objects[0].rect.top : 0;
+                cell = 0;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    const Rect & r = objects[i].rect;
+                    left[i] = r.left, top[i] = r.top, right[i] = r.right, bottom[i] = r.bottom;
+                    xMin = std::min(xMin, r.left), xMax = std::max(xMax, r.left);
+                    yMin = std::min(yMin, r.top), yMax = std::max(yMax, r.top);
+                    cell += Range(i);
+                }
+                cell = std::max(cell / std::max<size_t>(size, 1), 1.0);
+                width = Cell(xMax - xMin) + 1, height = Cell(yMax - yMin) + 1;
+                if (double(width) * double(height) > double(size) * 4.0)
+                {
+                    cell *= std::sqrt(double(width) * double(height) / (double(size) * 4.0));
+                    width = Cell(xMax - xMin) + 1, height = Cell(yMax - yMin) + 1;
+                }
+
+                start.assign(width * height + 1, 0);
+                index.resize(size);
+                for (size_t i = 0; i < size; ++i)
+                    start[Offset(i) + 1]++;
+                for (size_t c = 0; c < start.size() - 1; ++c)
+                    start[c + 1] += start[c];
+                std::vector<int> fill(start.begin(), start.end() - 1);
+                for (size_t i = 0; i < size; ++i)
+                    index[fill[Offset(i)]++] = (int)i;
+            }
+
+            SIMD_INLINE double Range(size_t i) const
+            {
+                return sizeDifferenceMax * ((right[i] - left[i]) + (bottom[i] - top[i])) * 0.5;
+            }
+
+            SIMD_INLINE ptrdiff_t Cell(double value) const
+            {
+                return (ptrdiff_t)std::floor(value / cell);
+            }
+
+            SIMD_INLINE size_t Offset(size_t i) const
+            {
+                return Cell(double(top[i] - yMin)) * width + Cell(double(left[i] - xMin));
+            }
 
-            SIMD_INLINE bool operator() (const Object & o1, const Object & o2) const
+            SIMD_INLINE bool Similar(size_t i, size_t j) const
             {
-                const Rect & r1 = o1.rect;
-                const Rect & r2 = o2.rect;
-                double delta = _sizeDifferenceMax*(std::min(r1.Width(), r2.Width()) + std::min(r1.Height(), r2.Height()))*0.5;
+                double delta = sizeDifferenceMax * (std::min(right[i] - left[i], right[j] - left[j]) + std::min(bottom[i] - top[i], bottom[j] - top[j])) * 0.5;
                 return
-                    std::abs(r1.left - r2.left) <= delta && std::abs(r1.top - r2.top) <= delta &&
-                    std::abs(r1.right - r2.right) <= delta && std::abs(r1.bottom - r2.bottom) <= delta;
+                    std::abs(left[i] - left[j]) <= delta && std::abs(top[i] - top[j]) <= delta &&
+                    std::abs(right[i] - right[j]) <= delta && std::abs(bottom[i] - bottom[j]) <= delta;
             }
 
-        private:
-            double _sizeDifferenceMax;
+            template<class Function> SIMD_INLINE void ForEachNeighbor(size_t i, Function function) const
+            {
+                double range = Range(i);
+                ptrdiff_t x0 = std::max<ptrdiff_t>(Cell(left[i] - xMin - range), 0);
+                ptrdiff_t x1 = std::min<ptrdiff_t>(Cell(left[i] - xMin + range), width - 1);
+                ptrdiff_t y0 = std::max<ptrdiff_t>(Cell(top[i] - yMin - range), 0);
+                ptrdiff_t y1 = std::min<ptrdiff_t>(Cell(top[i] - yMin + range), height - 1);
+                for (ptrdiff_t y = y0; y <= y1; ++y)
+                {
+                    for (ptrdiff_t x = x0; x <= x1; ++x)
+                    {
+                        for (int k = start[y * width + x], end = start[y * width + x + 1]; k < end; ++k)
+                        {
+                            int j = index[k];
+                            if (j != (int)i && Similar(i, j))
+                                function(j);
+                        }
+                    }
+                }
+            }
         };
 
-        template<typename T> int Partition(const std::vector<T> & vec, std::vector<int> & labels, double sizeDifferenceMax)
+    public:
+        /*! \cond PRIVATE */
+        // Splits objects into classes of similar ones (it is public to be tested).
+        static int Partition(const Objects & vec, std::vector<int> & labels, double sizeDifferenceMax)
         {
-            Similar similar(sizeDifferenceMax);
-            int i, j, N = (int)vec.size();
+            Grid grid(vec, sizeDifferenceMax);
+            int i, N = (int)vec.size();
             const int PARENT = 0;
             const int RANK = 1;
 
             std::vector<int> _nodes(N * 2);
-            int(*nodes)[2] = (int(*)[2])&_nodes[0];
+            int(*nodes)[2] = (int(*)[2])_nodes.data();
 
             for (i = 0; i < N; i++)
             {
@@ -629,10 +1171,8 @@ namespace Simd
                 while (nodes[root][PARENT] >= 0)
                     root = nodes[root][PARENT];
 
-                for (j = 0; j < N; j++)
+                grid.ForEachNeighbor(i, [&](int j)
                 {
-                    if (i == j || !similar(vec[i], vec[j]))
-                        continue;
                     int root2 = j;
 
                     while (nodes[root2][PARENT] >= 0)
@@ -665,7 +1205,7 @@ namespace Simd
                             k = parent;
                         }
                     }
-                }
+                });
             }
 
             labels.resize(N);
@@ -683,7 +1223,9 @@ namespace Simd
 
             return nclasses;
         }
+        /*! \endcond */
 
+    private:
         void GroupObjects(Objects & dst, const Objects & src, size_t groupSizeMin, double sizeDifferenceMax)
         {
             if (groupSizeMin == 0 || src.size() < groupSizeMin)
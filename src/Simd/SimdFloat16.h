@@ -99,6 +99,28 @@ namespace Simd
             v.si |= sign;
             return v.f;
         }
+
+        //---------------------------------------------------------------------
+
+        const int BF16_SHIFT = 16;
+        const uint32_t BF16_ROUND = (1 << (BF16_SHIFT - 1)) - 1;
+        const uint32_t BF16_QNAN = 0x0040;
+
+        SIMD_INLINE uint16_t Float32ToBFloat16(float value)
+        {
+            Fp16::Bits v;
+            v.f = value;
+            if ((v.ui & 0x7FFFFFFF) > 0x7F800000)
+                return uint16_t((v.ui >> BF16_SHIFT) | BF16_QNAN); // keep NaN a NaN (quiet)
+            return uint16_t((v.ui + BF16_ROUND + ((v.ui >> BF16_SHIFT) & 1)) >> BF16_SHIFT); // round to nearest even
+        }
+
+        SIMD_INLINE float BFloat16ToFloat32(uint16_t value)
+        {
+            Fp16::Bits v;
+            v.ui = uint32_t(value) << BF16_SHIFT;
+            return v.f;
+        }
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -39,6 +39,13 @@
 
 namespace Simd
 {
+    const size_t GEMM_SMALL_MAX = 64;
+
+    SIMD_INLINE bool GemmSmall(size_t M, size_t N, size_t K)
+    {
+        return M <= GEMM_SMALL_MAX && N <= GEMM_SMALL_MAX && K <= GEMM_SMALL_MAX;
+    }
+
     template <class T, size_t F, class TM> class GemmNN
     {
     public:
@@ -287,6 +294,36 @@ namespace Simd
         Kernel _k1x1, _k1x4, _k2x1, _k2x4, _k3x1, _k3x4, _k6x1, _k6x4;
     };
 
+    template <class T> struct GemmPost
+    {
+        typedef void(*BiasAndActivationPtr)(const T * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const T * params, ::SimdBool trans, T * dst);
+
+        T beta;
+        BiasAndActivationPtr biasAndActivation;
+        const T * bias;
+        ::SimdConvolutionActivationType activation;
+        const T * params;
+
+        GemmPost(T b = T(0), BiasAndActivationPtr f = NULL, const T * bs = NULL, ::SimdConvolutionActivationType a = ::SimdConvolutionActivationIdentity, const T * ps = NULL)
+            : beta(b)
+            , biasAndActivation(f)
+            , bias(bs)
+            , activation(a)
+            , params(ps)
+        {
+        }
+
+        SIMD_INLINE void Apply(size_t M, size_t N, size_t j, T * C, size_t ldc) const
+        {
+            if (biasAndActivation == NULL || (bias == NULL && activation == ::SimdConvolutionActivationIdentity))
+                return;
+            const T * b = bias ? bias + j : NULL;
+            const T * p = activation == ::SimdConvolutionActivationPrelu ? params + j : params;
+            for (size_t i = 0; i < M; ++i, C += ldc)
+                biasAndActivation(b, N, 1, activation, p, ::SimdTrue, C);
+        }
+    };
+
     template <class T, size_t F, class TM> class GemmNNcb
     {
     public:
@@ -368,6 +405,11 @@ namespace Simd
         }
 
         void Run(size_t M, const T * A, size_t lda, const T * pB, T * C, size_t ldc)
+        {
+            Run(M, A, lda, pB, C, ldc, GemmPost<T>());
+        }
+
+        void Run(size_t M, const T * A, size_t lda, const T * pB, T * C, size_t ldc, const GemmPost<T> & post)
         {
             assert(M <= _M);
             for (size_t j = 0; j < _N; j += _macroN)
@@ -380,11 +422,13 @@ namespace Simd
                     {
                         size_t macroM = Simd::Min(M, i + _macroM) - i;
                         if (k == 0)
-                            _scaleC(macroM, macroN, _0, C + i * ldc + j, ldc);
+                            _scaleC(macroM, macroN, post.beta, C + i * ldc + j, ldc);
                         if (_compatible)
                             MacroKernelCompatible(macroM, macroN, macroK, A + i * lda + k, lda, pB + j * _K + k * F, C + i * ldc + j, ldc);
                         else
                             MacroKernelSpecific(macroM, macroN, macroK, A + i * lda + k, lda, pB, C + i * ldc + j, ldc);
+                        if (k + macroK == _K)
+                            post.Apply(macroM, macroN, j, C + i * ldc + j, ldc);
                     }
                     if(!_compatible)
                         pB += AlignHiAny(macroN, _microN)*macroK;
@@ -527,6 +571,8 @@ namespace Simd
         size_t Gemm32fNNcbBufferSize(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbReorderB(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, const float * pB, float * C, GemmKernelType type, bool compatibility);
+        void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, size_t lda, const float * pB, float * C, size_t ldc, const GemmPost<float> & post, GemmKernelType type, bool compatibility);
+        GemmKernelType Gemm32fNNcbKernelType(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
     }
 #endif//SIMD_SSE2_ENABLE
 
@@ -551,6 +597,8 @@ namespace Simd
         size_t Gemm32fNNcbBufferSize(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbReorderB(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, const float * pB, float * C, GemmKernelType type, bool compatibility);
+        void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, size_t lda, const float * pB, float * C, size_t ldc, const GemmPost<float> & post, GemmKernelType type, bool compatibility);
+        GemmKernelType Gemm32fNNcbKernelType(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
     }
 #endif//SIMD_AVX_ENABLE
 
@@ -571,6 +619,8 @@ namespace Simd
         size_t Gemm32fNNcbBufferSize(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbReorderB(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, const float * pB, float * C, GemmKernelType type, bool compatibility);
+        void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, size_t lda, const float * pB, float * C, size_t ldc, const GemmPost<float> & post, GemmKernelType type, bool compatibility);
+        GemmKernelType Gemm32fNNcbKernelType(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
     }
 #endif//SIMD_AVX_ENABLE
 
@@ -607,6 +657,8 @@ namespace Simd
         size_t Gemm32fNNcbBufferSize(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbReorderB(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, const float * pB, float * C, GemmKernelType type, bool compatibility);
+        void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, size_t lda, const float * pB, float * C, size_t ldc, const GemmPost<float> & post, GemmKernelType type, bool compatibility);
+        GemmKernelType Gemm32fNNcbKernelType(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
     }
 #endif//SIMD_AVX512F_ENABLE
 
@@ -631,6 +683,8 @@ namespace Simd
         size_t Gemm32fNNcbBufferSize(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbReorderB(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, const float * pB, float * C, GemmKernelType type, bool compatibility);
+        void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, size_t lda, const float * pB, float * C, size_t ldc, const GemmPost<float> & post, GemmKernelType type, bool compatibility);
+        GemmKernelType Gemm32fNNcbKernelType(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
     }
 #endif//SIMD_NEON_ENABLE
 }
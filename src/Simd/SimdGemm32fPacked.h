@@ -0,0 +1,179 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdGemm32fPacked_h__
+#define __SimdGemm32fPacked_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdGemm.h"
+
+namespace Simd
+{
+    struct GemmPackedParam32f
+    {
+        size_t M;
+        size_t N;
+        size_t K;
+        SimdConvolutionActivationType activation;
+
+        GemmPackedParam32f(size_t m, size_t n, size_t k, SimdConvolutionActivationType a)
+        {
+            M = m;
+            N = n;
+            K = k;
+            activation = a;
+        }
+
+        bool Valid() const
+        {
+            return N > 0 && K > 0;
+        }
+    };
+
+    class Gemm32fPacked : public Deletable
+    {
+    public:
+        Gemm32fPacked(const GemmPackedParam32f & p)
+            : _param(p)
+        {
+        }
+
+        const GemmPackedParam32f & Param() const
+        {
+            return _param;
+        }
+
+        virtual String Ext() const = 0;
+        virtual String Desc() const = 0;
+
+        virtual size_t InternalBufferSize() const = 0;
+
+        virtual void SetParams(const float * B, const float * bias, const float * params) = 0;
+
+        virtual void Run(size_t M, const float * A, size_t lda, const float * beta, float * C, size_t ldc) = 0;
+
+    protected:
+        GemmPackedParam32f _param;
+    };
+
+    namespace Base
+    {
+        class Gemm32fPackedNN : public Simd::Gemm32fPacked
+        {
+        public:
+            Gemm32fPackedNN(const GemmPackedParam32f & p);
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const;
+            virtual size_t InternalBufferSize() const { return _pB.size + _bias.size + _params.size; }
+            virtual void SetParams(const float * B, const float * bias, const float * params);
+            virtual void Run(size_t M, const float * A, size_t lda, const float * beta, float * C, size_t ldc);
+
+        protected:
+            typedef size_t(*BufferSizePtr)(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
+            typedef void(*ReorderBPtr)(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
+            typedef void(*RunPtr)(size_t M, size_t N, size_t K, const float * A, size_t lda, const float * pB, float * C, size_t ldc, 
+                const GemmPost<float> & post, GemmKernelType type, bool compatibility);
+
+            GemmKernelType _type;
+            BufferSizePtr _bufferSize;
+            ReorderBPtr _reorderB;
+            RunPtr _run;
+            GemmPost<float>::BiasAndActivationPtr _biasAndActivation;
+            Array32f _pB, _bias, _params;
+        };
+
+        void * Gemm32fPackedInit(size_t M, size_t N, size_t K, SimdConvolutionActivationType activation);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        class Gemm32fPackedNN : public Base::Gemm32fPackedNN
+        {
+        public:
+            Gemm32fPackedNN(const GemmPackedParam32f & p);
+            virtual String Ext() const { return "Sse2"; }
+        };
+
+        void * Gemm32fPackedInit(size_t M, size_t N, size_t K, SimdConvolutionActivationType activation);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX_ENABLE    
+    namespace Avx
+    {
+        class Gemm32fPackedNN : public Sse2::Gemm32fPackedNN
+        {
+        public:
+            Gemm32fPackedNN(const GemmPackedParam32f & p);
+            virtual String Ext() const { return "Avx"; }
+        };
+
+        void * Gemm32fPackedInit(size_t M, size_t N, size_t K, SimdConvolutionActivationType activation);
+    }
+#endif//SIMD_AVX_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class Gemm32fPackedNN : public Avx::Gemm32fPackedNN
+        {
+        public:
+            Gemm32fPackedNN(const GemmPackedParam32f & p);
+            virtual String Ext() const { return "Avx2"; }
+        };
+
+        void * Gemm32fPackedInit(size_t M, size_t N, size_t K, SimdConvolutionActivationType activation);
+    }
+#endif//SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512F_ENABLE    
+    namespace Avx512f
+    {
+        class Gemm32fPackedNN : public Avx2::Gemm32fPackedNN
+        {
+        public:
+            Gemm32fPackedNN(const GemmPackedParam32f & p);
+            virtual String Ext() const { return "Avx512f"; }
+        };
+
+        void * Gemm32fPackedInit(size_t M, size_t N, size_t K, SimdConvolutionActivationType activation);
+    }
+#endif//SIMD_AVX512F_ENABLE
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class Gemm32fPackedNN : public Base::Gemm32fPackedNN
+        {
+        public:
+            Gemm32fPackedNN(const GemmPackedParam32f & p);
+            virtual String Ext() const { return "Neon"; }
+        };
+
+        void * Gemm32fPackedInit(size_t M, size_t N, size_t K, SimdConvolutionActivationType activation);
+    }
+#endif//SIMD_NEON_ENABLE
+}
+
+#endif//__SimdGemm32fPacked_h__
@@ -0,0 +1,172 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdGemm8iPacked_h__
+#define __SimdGemm8iPacked_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdPerformance.h"
+
+namespace Simd
+{
+    struct GemmPackedParam8i
+    {
+        size_t M;
+        size_t N;
+        size_t K;
+        SimdTensorDataType dstT;
+        SimdSynetCompatibilityType compatibility;
+
+        GemmPackedParam8i(size_t m, size_t n, size_t k, SimdTensorDataType d, SimdSynetCompatibilityType c)
+        {
+            M = m;
+            N = n;
+            K = k;
+            dstT = d;
+            compatibility = c;
+        }
+
+        bool Valid() const
+        {
+            return N > 0 && K > 0 && (dstT == SimdTensorData32i || dstT == SimdTensorData32f || dstT == SimdTensorData8u);
+        }
+
+        bool Precise() const
+        {
+            return (compatibility & SimdSynetCompatibility8iMask) == SimdSynetCompatibility8iPrecise;
+        }
+
+        size_t DstSize() const
+        {
+            return dstT == SimdTensorData8u ? 1 : 4;
+        }
+    };
+
+    class Gemm8iPacked : public Deletable
+    {
+    public:
+        Gemm8iPacked(const GemmPackedParam8i & p)
+            : _param(p)
+        {
+        }
+
+        const GemmPackedParam8i & Param() const
+        {
+            return _param;
+        }
+
+        virtual String Ext() const = 0;
+        virtual String Desc() const = 0;
+
+        virtual size_t InternalBufferSize() const = 0;
+
+        virtual void SetParams(const int8_t * B, uint8_t aZero, const int8_t * bZero, const float * scale, const float * shift) = 0;
+
+        virtual void Run(size_t M, const uint8_t * A, size_t lda, uint8_t * C, size_t ldc) = 0;
+
+    protected:
+        GemmPackedParam8i _param;
+    };
+
+    namespace Base
+    {
+        class Gemm8iPackedNN : public Simd::Gemm8iPacked
+        {
+        public:
+            Gemm8iPackedNN(const GemmPackedParam8i & p);
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const int8_t * B, uint8_t aZero, const int8_t * bZero, const float * scale, const float * shift);
+            virtual void Run(size_t M, const uint8_t * A, size_t lda, uint8_t * C, size_t ldc);
+
+            struct Post
+            {
+                const int32_t * comp;
+                const int32_t * zero;
+                const int32_t * sums;
+                const float * scale;
+                const float * shift;
+            };
+
+            typedef void(*RunPtr)(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, const int8_t * pB, uint8_t * C, size_t ldc, const Post & post);
+
+        protected:
+
+            void ReorderB(const int8_t * B);
+
+            size_t _microN, _microK;
+            RunPtr _run;
+            Array8i _pB;
+            Array32i _comp, _zero;
+            Array32f _scale, _shift;
+        };
+
+        void * Gemm8iPackedInit(size_t M, size_t N, size_t K, SimdTensorDataType dstT, SimdSynetCompatibilityType compatibility);
+    }
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class Gemm8iPackedNN : public Base::Gemm8iPackedNN
+        {
+        public:
+            Gemm8iPackedNN(const GemmPackedParam8i & p);
+            virtual String Ext() const { return "Avx2"; }
+        };
+
+        void * Gemm8iPackedInit(size_t M, size_t N, size_t K, SimdTensorDataType dstT, SimdSynetCompatibilityType compatibility);
+    }
+#endif//SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class Gemm8iPackedNN : public Avx2::Gemm8iPackedNN
+        {
+        public:
+            Gemm8iPackedNN(const GemmPackedParam8i & p);
+            virtual String Ext() const { return "Avx512bw"; }
+        };
+
+        void * Gemm8iPackedInit(size_t M, size_t N, size_t K, SimdTensorDataType dstT, SimdSynetCompatibilityType compatibility);
+    }
+#endif//SIMD_AVX512BW_ENABLE
+
+#ifdef SIMD_AVX512VNNI_ENABLE    
+    namespace Avx512vnni
+    {
+        class Gemm8iPackedNN : public Avx512bw::Gemm8iPackedNN
+        {
+        public:
+            Gemm8iPackedNN(const GemmPackedParam8i & p);
+            virtual String Ext() const { return "Avx512vnni"; }
+        };
+
+        void * Gemm8iPackedInit(size_t M, size_t N, size_t K, SimdTensorDataType dstT, SimdSynetCompatibilityType compatibility);
+    }
+#endif//SIMD_AVX512VNNI_ENABLE
+}
+
+#endif//__SimdGemm8iPacked_h__
@@ -0,0 +1,360 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdHogDetector_hpp__
+#define __SimdHogDetector_hpp__
+
+#include "Simd/SimdLib.hpp"
+#include "Simd/SimdParallel.hpp"
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <thread>
+
+#include <limits.h>
+#include <float.h>
+
+#ifndef SIMD_CHECK_PERFORMANCE
+#define SIMD_CHECK_PERFORMANCE()
+#endif
+
+namespace Simd
+{
+    /*! @ingroup cpp_hog_detector
+
+        \short The HogDetector structure provides sliding window object detection with using of lite HOG features and linear SVM.
+
+        The detector extracts lite HOG features only once per frame. The feature pyramid is built by resizing of features (not pixels).
+        Then linear filter is applied to every level of the pyramid in parallel, local maxima of responses are found and overlapped boxes are suppressed.
+
+        Using example (pedestrian detection in the image):
+        \code
+        #include "Simd/SimdHogDetector.hpp"
+        #include "Simd/SimdDrawing.hpp"
+
+        int main()
+        {
+            typedef Simd::HogDetector<Simd::Allocator> HogDetector;
+
+            HogDetector::View image;
+            image.Load("street.pgm");
+
+            std::vector<float> filter = LoadPedestrianModel(); // 8x16 cells with 16 features per cell.
+
+            HogDetector detector;
+            detector.SetFilter(filter.data(), 8, 16, -0.5f);
+            detector.Init(image.Size(), 1.1);
+
+            HogDetector::Objects objects;
+            detector.Detect(image, objects);
+
+            for (size_t i = 0; i < objects.size(); ++i)
+                Simd::DrawRectangle(image, objects[i].rect, uint8_t(255));
+
+            image.Save("result.pgm");
+
+            return 0;
+        }
+        \endcode
+    */
+    template <template<class> class A>
+    class HogDetector
+    {
+    public:
+        typedef A<uint8_t> Allocator; /*!< Allocator type definition. */
+        typedef Simd::View<A> View; /*!< An image type definition. */
+        typedef Simd::Point<ptrdiff_t> Size; /*!< An image size type definition. */
+        typedef Simd::Rectangle<ptrdiff_t> Rect; /*!< A rectangle type definition. */
+
+        /*!
+            \short The Object structure describes detected object.
+        */
+        struct Object
+        {
+            Rect rect; /*!< \brief A bounding box around of detected object. */
+            float score; /*!< \brief A response of the filter (SVM decision function) for detected object. */
+
+            /*!
+                Creates a new Object structure.
+
+                \param [in] r - initial bounding box.
+                \param [in] s - initial score.
+            */
+            Object(const Rect & r = Rect(), float s = 0.0f)
+                : rect(r)
+                , score(s)
+            {
+            }
+        };
+        typedef std::vector<Object> Objects; /*!< A vector of objects type definition. */
+
+        /*!
+            Creates a new empty HogDetector structure.
+        */
+        HogDetector()
+            : _cell(8)
+            , _width(0)
+            , _height(0)
+            , _bias(0.0f)
+            , _threadNumber(1)
+        {
+        }
+
+        /*!
+            Sets linear filter (weights of linear SVM).
+
+            \param [in] filter - a pointer to filter weights. Its size is width*height*16. Weights are ordered as lite HOG features: rows of cells, 16 features per cell.
+            \param [in] width - a width of the filter (in cells).
+            \param [in] height - a height of the filter (in cells).
+            \param [in] bias - a bias of linear SVM decision function.
+            \param [in] cell - a size of HOG cell. It must be 4 or 8.
+            \return a result of this operation.
+        */
+        bool SetFilter(const float * filter, size_t width, size_t height, float bias = 0.0f, size_t cell = 8)
+        {
+            if (filter == NULL || width == 0 || height == 0 || (cell != 4 && cell != 8))
+                return false;
+            _filter.assign(filter, filter + width * height * FEATURE_SIZE);
+            _width = width;
+            _height = height;
+            _bias = bias;
+            _cell = cell;
+            _levels.clear();
+            return true;
+        }
+
+        /*!
+            Sets linear SVM model given by support vectors. The support vectors are collapsed to single linear filter.
+
+            \param [in] svs - a pointer to the support vectors (count x width*height*16).
+            \param [in] weights - a pointer to the weights of the support vectors (count).
+            \param [in] count - a number of the support vectors.
+            \param [in] width - a width of the filter (in cells).
+            \param [in] height - a height of the filter (in cells).
+            \param [in] bias - a bias of linear SVM decision function.
+            \param [in] cell - a size of HOG cell. It must be 4 or 8.
+            \return a result of this operation.
+        */
+        bool SetSvm(const float * svs, const float * weights, size_t count, size_t width, size_t height, float bias = 0.0f, size_t cell = 8)
+        {
+            if (svs == NULL || weights == NULL || count == 0)
+                return false;
+            size_t length = width * height * FEATURE_SIZE;
+            std::vector<float> filter(length, 0.0f);
+            for (size_t i = 0; i < count; ++i)
+                for (size_t j = 0; j < length; ++j)
+                    filter[j] += weights[i] * svs[i * length + j];
+            return SetFilter(filter.data(), width, height, bias, cell);
+        }
+
+        /*!
+            Prepares HogDetector structure to work with image of given size.
+
+            \param [in] imageSize - a size of input image.
+            \param [in] scaleFactor - a scale factor between neighboring levels of feature pyramid.
+            \param [in] sizeMin - a minimal size of detected objects.
+            \param [in] sizeMax - a maximal size of detected objects.
+            \param [in] threadNumber - a number of work threads. Use value -1 to auto choose of thread number.
+            \return a result of this operation.
+        */
+        bool Init(const Size & imageSize, double scaleFactor = 1.1, const Size & sizeMin = Size(0, 0),
+            const Size & sizeMax = Size(INT_MAX, INT_MAX), ptrdiff_t threadNumber = -1)
+        {
+            _levels.clear();
+            if (_filter.empty() || scaleFactor <= 1.0)
+                return false;
+            ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
+            _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
+            _imageSize = imageSize;
+
+            ptrdiff_t width = imageSize.x / _cell - 2, height = imageSize.y / _cell - 2;
+            if (width < (ptrdiff_t)_width || height < (ptrdiff_t)_height)
+                return false;
+            _features.Recreate(width * FEATURE_SIZE, height, View::Float);
+            for (double scale = 1.0;; scale *= scaleFactor)
+            {
+                Size size(Simd::Round(width / scale), Simd::Round(height / scale));
+                if (size.x < (ptrdiff_t)_width || size.y < (ptrdiff_t)_height)
+                    break;
+                Size window = Size(_width * _cell, _height * _cell) * scale;
+                if (window.x > sizeMax.x || window.y > sizeMax.y)
+                    break;
+                if (window.x < sizeMin.x || window.y < sizeMin.y)
+                    continue;
+                _levels.push_back(Level());
+                Level & level = _levels.back();
+                level.scaleX = double(width) / double(size.x);
+                level.scaleY = double(height) / double(size.y);
+                if (level.Scaled())
+                    level.features.Recreate(size.x * FEATURE_SIZE, size.y, View::Float);
+                Size scores = size - Size(_width, _height) + Size(1, 1);
+                level.scores.Recreate((scores.x + BLOCK - 1) / BLOCK * BLOCK + 1, scores.y, View::Float); // SimdHogLiteFindMax7x7 loads 8 values per row.
+            }
+            return !_levels.empty();
+        }
+
+        /*!
+            Detects objects at given image.
+
+            \param [in] src - a input image.
+            \param [out] objects - detected objects.
+            \param [in] threshold - a threshold of SVM decision function.
+            \param [in] overlapMax - a maximal overlap (intersection over union) of detected objects.
+            \return a result of this operation.
+        */
+        bool Detect(const View & src, Objects & objects, float threshold = 0.0f, double overlapMax = 0.3)
+        {
+            SIMD_CHECK_PERFORMANCE();
+
+            objects.clear();
+            if (_levels.empty() || src.Size() != _imageSize)
+                return false;
+
+            View gray = src;
+            if (src.format != View::Gray8)
+            {
+                gray.Recreate(src.Size(), View::Gray8);
+                Convert(src, gray);
+            }
+            Simd::HogLiteExtractFeatures(gray, _cell, (float*)_features.data, _features.stride / sizeof(float));
+
+            std::vector<Objects> candidates(_levels.size());
+            RunParallel(_levels.size(), [&](size_t i)
+            {
+                Level & level = _levels[i];
+                View & features = level.Scaled() ? level.features : _features;
+                if (level.Scaled())
+                    ::SimdHogLiteResizeFeatures((float*)_features.data, _features.stride / sizeof(float), _features.width / FEATURE_SIZE, _features.height,
+                        FEATURE_SIZE, (float*)level.features.data, level.features.stride / sizeof(float), level.features.width / FEATURE_SIZE, level.features.height);
+                const float lowest = -FLT_MAX;
+                for (size_t row = 0; row < level.scores.height; ++row)
+                    ::SimdFill32f((float*)(level.scores.data + row * level.scores.stride), level.scores.width, &lowest);
+                ::SimdHogLiteFilterFeatures((float*)features.data, features.stride / sizeof(float), features.width / FEATURE_SIZE, features.height,
+                    FEATURE_SIZE, _filter.data(), _width, _height, NULL, 0, (float*)level.scores.data, level.scores.stride / sizeof(float));
+                FindMaxima(level, features.width / FEATURE_SIZE - _width + 1, features.height - _height + 1, threshold, candidates[i]);
+            });
+
+            Objects all;
+            for (size_t i = 0; i < candidates.size(); ++i)
+                all.insert(all.end(), candidates[i].begin(), candidates[i].end());
+            Suppress(all, overlapMax, objects);
+
+            return true;
+        }
+
+    private:
+        enum
+        {
+            FEATURE_SIZE = 16,
+            BLOCK = 7,
+        };
+
+        struct Level
+        {
+            double scaleX, scaleY;
+            View features;
+            View scores;
+
+            bool Scaled() const { return scaleX != 1.0 || scaleY != 1.0; }
+        };
+        typedef std::vector<Level> Levels;
+
+        size_t _cell, _width, _height;
+        float _bias;
+        std::vector<float> _filter;
+        Size _imageSize;
+        ptrdiff_t _threadNumber;
+        View _features;
+        Levels _levels;
+
+        void FindMaxima(const Level & level, size_t width, size_t height, float threshold, Objects & objects) const
+        {
+            float bias[BLOCK + 1]; // the same row of bias for all rows of block.
+            for (size_t i = 0; i <= BLOCK; ++i)
+                bias[i] = _bias;
+            size_t stride = level.scores.stride / sizeof(float);
+            for (size_t y = 0; y < height; y += BLOCK)
+            {
+                for (size_t x = 0; x < width; x += BLOCK)
+                {
+                    const float * scores = (float*)level.scores.data + y * stride + x;
+                    float value;
+                    size_t col, row;
+                    ::SimdHogLiteFindMax7x7(scores, stride, bias, 0, std::min<size_t>(BLOCK, height - y), &value, &col, &row);
+                    if (value <= threshold || x + col >= width)
+                        continue;
+                    double scaleX = level.scaleX * _cell, scaleY = level.scaleY * _cell;
+                    Rect rect(Simd::Round((x + col + 1) * scaleX), Simd::Round((y + row + 1) * scaleY),
+                        Simd::Round((x + col + 1 + _width) * scaleX), Simd::Round((y + row + 1 + _height) * scaleY));
+                    objects.push_back(Object(rect, value));
+                }
+            }
+        }
+
+        static double Overlap(const Rect & a, const Rect & b)
+        {
+            double intersection = double(a.Intersection(b).Area());
+            return intersection / (double(a.Area()) + double(b.Area()) - intersection);
+        }
+
+        static bool Greater(const Object & a, const Object & b)
+        {
+            return a.score > b.score;
+        }
+
+        static void Suppress(Objects & src, double overlapMax, Objects & dst)
+        {
+            std::stable_sort(src.begin(), src.end(), Greater);
+            for (size_t i = 0; i < src.size(); ++i)
+            {
+                bool suppressed = false;
+                for (size_t j = 0; j < dst.size() && !suppressed; ++j)
+                    suppressed = Overlap(src[i].rect, dst[j].rect) > overlapMax;
+                if (!suppressed)
+                    dst.push_back(src[i]);
+            }
+        }
+
+        template<class Function> void RunParallel(size_t count, const Function & function)
+        {
+            size_t threadNumber = std::min<size_t>(_threadNumber, count);
+            if (threadNumber <= 1)
+            {
+                for (size_t i = 0; i < count; ++i)
+                    function(i);
+            }
+            else
+            {
+                std::atomic<size_t> next(0);
+                Parallel(0, threadNumber, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = next++; i < count; i = next++)
+                        function(i);
+                }, threadNumber);
+            }
+        }
+    };
+}
+
+#endif//__SimdHogDetector_hpp__
@@ -63,6 +63,8 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdPerformance.h"
 
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdGemm32fPacked.h"
+#include "Simd/SimdGemm8iPacked.h"
 #include "Simd/SimdImageLoad.h"
 #include "Simd/SimdImageSave.h"
 #include "Simd/SimdResizer.h"
@@ -70,6 +72,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynetDeconvolution32f.h"
 #include "Simd/SimdSynetInnerProduct32f.h"
+#include "Simd/SimdSynetInnerProduct8i.h"
 #include "Simd/SimdSynetMergedConvolution32f.h"
 #include "Simd/SimdSynetMergedConvolution8i.h"
 #include "Simd/SimdSynetScale8i.h"
@@ -1775,6 +1778,16 @@ SIMD_API void * SimdDetectionLoadA(const char * path)
     return Base::DetectionLoadA(path);
 }
 
+SIMD_API void * SimdDetectionLoadBinary(const uint8_t * buffer, size_t size)
+{
+    return Base::DetectionLoadBinary(buffer, size);
+}
+
+SIMD_API size_t SimdDetectionSaveBinary(const void * data, uint8_t * buffer, size_t size)
+{
+    return Base::DetectionSaveBinary(data, buffer, size);
+}
+
 SIMD_API void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags)
 {
     Base::DetectionInfo(data, width, height, flags);
@@ -2542,6 +2555,86 @@ SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, c
     simdGemm32fNT(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
+SIMD_API void SimdGemm32fNNStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA,
+    const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC)
+{
+    const static SimdGemm32fPtr simdGemm32fNN = SIMD_FUNC5(Gemm32fNN, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+
+    for (size_t b = 0; b < batch; ++b)
+        simdGemm32fNN(M, N, K, alpha, A + b * strideA, lda, B + b * strideB, ldb, beta, C + b * strideC, ldc);
+}
+
+SIMD_API void SimdGemm32fNTStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA,
+    const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC)
+{
+    const static SimdGemm32fPtr simdGemm32fNT = SIMD_FUNC5(Gemm32fNT, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    for (size_t b = 0; b < batch; ++b)
+        simdGemm32fNT(M, N, K, alpha, A + b * strideA, lda, B + b * strideB, ldb, beta, C + b * strideC, ldc);
+}
+
+SIMD_API void * SimdGemm32fPackedInit(size_t M, size_t N, size_t K, SimdConvolutionActivationType activation)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdGemm32fPackedInitPtr) (size_t M, size_t N, size_t K, SimdConvolutionActivationType activation);
+    const static SimdGemm32fPackedInitPtr simdGemm32fPackedInit = SIMD_FUNC5(Gemm32fPackedInit, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+
+    return simdGemm32fPackedInit(M, N, K, activation);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdGemm32fPackedSetParams(void * context, const float * B, const float * bias, const float * params)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    ((Gemm32fPacked*)context)->SetParams(B, bias, params);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdGemm32fPackedRun(void * context, size_t M, const float * A, size_t lda, const float * beta, float * C, size_t ldc)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    ((Gemm32fPacked*)context)->Run(M, A, lda, beta, C, ldc);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void * SimdGemm8iPackedInit(size_t M, size_t N, size_t K, SimdTensorDataType dstT, SimdSynetCompatibilityType compatibility)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdGemm8iPackedInitPtr) (size_t M, size_t N, size_t K, SimdTensorDataType dstT, SimdSynetCompatibilityType compatibility);
+    const static SimdGemm8iPackedInitPtr simdGemm8iPackedInit = SIMD_FUNC3(Gemm8iPackedInit, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC);
+
+    return simdGemm8iPackedInit(M, N, K, dstT, compatibility);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdGemm8iPackedSetParams(void * context, const int8_t * B, uint8_t aZero, const int8_t * bZero, const float * scale, const float * shift)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    ((Gemm8iPacked*)context)->SetParams(B, aZero, bZero, scale, shift);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdGemm8iPackedRun(void * context, size_t M, const uint8_t * A, size_t lda, uint8_t * C, size_t ldc)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    ((Gemm8iPacked*)context)->Run(M, A, lda, C, ldc);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -5552,6 +5645,20 @@ SIMD_API void SimdSynetAdd8i(const uint8_t* aData, const float* aScale, const fl
 #endif
 }
 
+SIMD_API void SimdSynetBinaryOperation32fLayerForward(const float* a, const size_t* aShape, size_t aCount, const float* b, const size_t* bShape, size_t bCount,
+    SimdSynetBinaryOperation32fType type, float* dst)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetBinaryOperation32fLayerForwardPtr) (const float* a, const size_t* aShape, size_t aCount, const float* b, const size_t* bShape, size_t bCount,
+        SimdSynetBinaryOperation32fType type, float* dst);
+    const static SimdSynetBinaryOperation32fLayerForwardPtr simdSynetBinaryOperation32fLayerForward = SIMD_FUNC3(SynetBinaryOperation32fLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdSynetBinaryOperation32fLayerForward(a, aShape, aCount, b, bShape, bCount, type, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetConvert32fTo8u(const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility)
 {
 #if defined(SIMD_SYNET_ENABLE)
@@ -5589,6 +5696,19 @@ SIMD_API void * SimdSynetConvolution32fInit(size_t batch, const SimdConvolutionP
 #endif
 }
 
+SIMD_API void * SimdSynetConvolution32fInitV2(size_t batch, const SimdConvolutionParameters * params, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetConvolution32fInitV2Ptr) (size_t batch, const SimdConvolutionParameters * params, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType);
+    const static SimdSynetConvolution32fInitV2Ptr simdSynetConvolution32fInitV2 = SIMD_FUNC6(SynetConvolution32fInitV2, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+
+    return simdSynetConvolution32fInitV2(batch, params, gemm, weightType);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
 SIMD_API size_t SimdSynetConvolution32fExternalBufferSize(const void * context)
 {
 #if defined(SIMD_SYNET_ENABLE)
@@ -5639,6 +5759,17 @@ SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src,
 #endif
 }
 
+SIMD_API void SimdSynetConvolution32fForwardStrided(void * context, const float * src, float * buf, float * dst, size_t dstStride)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    SynetConvolution32f * c = (SynetConvolution32f*)context;
+    SIMD_PERF_EXT(c);
+    c->ForwardStrided(src, buf, dst, dstStride);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void* SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
 {
 #if defined(SIMD_SYNET_ENABLE)
@@ -5765,6 +5896,45 @@ SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src
 #endif
 }
 
+SIMD_API void SimdSynetDecodeSsd32f(const float * loc, const float * prior, const float * variance, size_t count, float * dst)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetDecodeSsd32fPtr) (const float* loc, const float* prior, const float* variance, size_t count, float* dst);
+    const static SimdSynetDecodeSsd32fPtr simdSynetDecodeSsd32f = SIMD_FUNC3(SynetDecodeSsd32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdSynetDecodeSsd32f(loc, prior, variance, count, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetDecodeYolo32f(const float * src, size_t anchors, size_t classes, size_t height, size_t width, const float * sizes, float * boxes, float * scores)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetDecodeYolo32fPtr) (const float* src, size_t anchors, size_t classes, size_t height, size_t width, const float* sizes, float* boxes, float* scores);
+    const static SimdSynetDecodeYolo32fPtr simdSynetDecodeYolo32f = SIMD_FUNC3(SynetDecodeYolo32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdSynetDecodeYolo32f(src, anchors, classes, height, width, sizes, boxes, scores);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API size_t SimdSynetDetectionOutput32f(const float * boxes, const float * scores, size_t count, size_t classes, size_t background,
+    const float * confidence, const float * overlap, size_t topK, size_t keepTopK, float * dst)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef size_t(*SimdSynetDetectionOutput32fPtr) (const float* boxes, const float* scores, size_t count, size_t classes, size_t background,
+        const float* confidence, const float* overlap, size_t topK, size_t keepTopK, float* dst);
+    const static SimdSynetDetectionOutput32fPtr simdSynetDetectionOutput32f = SIMD_FUNC3(SynetDetectionOutput32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    return simdSynetDetectionOutput32f(boxes, scores, count, classes, background, confidence, overlap, topK, keepTopK, dst);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
 SIMD_API void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst)
 {
 #if defined(SIMD_SYNET_ENABLE)
@@ -5873,6 +6043,20 @@ SIMD_API void SimdSynetFusedLayerForward9(const float * src0, const float * src1
 #endif
 }
 
+SIMD_API void SimdSynetGroupNormalize32f(const float * src, size_t batch, size_t channels, size_t spatial, size_t group, const float * scale, const float * shift,
+    const float * eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float * params, float * dst)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetGroupNormalize32fPtr) (const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+        const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst);
+    const static SimdSynetGroupNormalize32fPtr simdSynetGroupNormalize32f = SIMD_FUNC3(SynetGroupNormalize32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdSynetGroupNormalize32f(src, batch, channels, spatial, group, scale, shift, eps, format, activation, params, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetHardSigmoid32f(const float* src, size_t size, const float* scale, const float* shift, float* dst)
 {
 #if defined(SIMD_SYNET_ENABLE)
@@ -5900,10 +6084,20 @@ assert(0);
 SIMD_API void* SimdSynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation)
 {
 #if defined(SIMD_SYNET_ENABLE)
-    typedef void* (*SimdSynetInnerProduct32fInitPtr) (size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+    return SimdSynetInnerProduct32fInitV2(batch, input, output, transpose, activation, SimdTensorData32f);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void* SimdSynetInnerProduct32fInitV2(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetInnerProduct32fInitPtr) (size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType);
     const static SimdSynetInnerProduct32fInitPtr simdSynetInnerProduct32fInit = SIMD_FUNC5(SynetInnerProduct32fInit, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
 
-    return simdSynetInnerProduct32fInit(batch, input, output, transpose, activation);
+    return simdSynetInnerProduct32fInit(batch, input, output, transpose, activation, weightType);
 #else
     assert(0);
     return 0;
@@ -5964,6 +6158,109 @@ SIMD_API void SimdSynetInnerProduct8i(size_t M, size_t N, size_t K, const uint8_
 #endif
 }
 
+SIMD_API void* SimdSynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetInnerProduct8iInitPtr) (size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    const static SimdSynetInnerProduct8iInitPtr simdSynetInnerProduct8iInit = SIMD_FUNC5(SynetInnerProduct8iInit, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdSynetInnerProduct8iInit(batch, input, output, transpose, srcT, dstT, activation, compatibility);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetInnerProduct8iExternalBufferSize(const void* context)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetInnerProduct8i*)context)->ExternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetInnerProduct8iInternalBufferSize(const void* context)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetInnerProduct8i*)context)->InternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API const char* SimdSynetInnerProduct8iInfo(const void* context)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetInnerProduct8i*)context)->Info();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetInnerProduct8iSetParams(void* context, const float* weight, const float* bias, const float* params, const float* const* stats)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetInnerProduct8i*)context)->SetParams(weight, bias, params, stats);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetInnerProduct8iForward(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    SynetInnerProduct8i* c = (SynetInnerProduct8i*)context;
+    SIMD_PERF_EXT(c);
+    c->Forward(src, buf, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetL2Normalize32f(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+    SimdBool acrossSpatial, const float* eps, float* dst)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetL2Normalize32fPtr) (const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+        SimdBool acrossSpatial, const float* eps, float* dst);
+    const static SimdSynetL2Normalize32fPtr simdSynetL2Normalize32f = SIMD_FUNC3(SynetL2Normalize32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdSynetL2Normalize32f(src, batch, channels, spatial, format, acrossSpatial, eps, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetLayerNormalize32f(const float * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift,
+    const float * eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float * params, float * dst)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetLayerNormalize32fPtr) (const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+        const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst);
+    const static SimdSynetLayerNormalize32fPtr simdSynetLayerNormalize32f = SIMD_FUNC3(SynetLayerNormalize32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdSynetLayerNormalize32f(src, batch, channels, spatial, scale, shift, eps, format, activation, params, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetLogSoftmaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetLogSoftmaxLayerForwardPtr) (const float* src, size_t outer, size_t count, size_t inner, float* dst);
+    const static SimdSynetLogSoftmaxLayerForwardPtr simdSynetLogSoftmaxLayerForward = SIMD_FUNC3(SynetLogSoftmaxLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdSynetLogSoftmaxLayerForward(src, outer, count, inner, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t channels, size_t spatial, const float * k, float * dst, SimdTensorFormatType format)
 {
 #if defined(SIMD_SYNET_ENABLE)
@@ -6114,6 +6411,18 @@ SIMD_API void SimdSynetMish32f(const float* src, size_t size, const float* thres
 #endif
 }
 
+SIMD_API void SimdSynetPermute32f(const float * src, const size_t * shape, const size_t * order, size_t count, float * dst)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetPermute32fPtr) (const float* src, const size_t* shape, const size_t* order, size_t count, float* dst);
+    const static SimdSynetPermute32fPtr simdSynetPermute32f = SIMD_FUNC3(SynetPermute32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE2_FUNC);
+
+    simdSynetPermute32f(src, shape, order, count, dst);
+#else
+    assert(0);
+#endif
+}
+
 void SimdSynetPoolingForwardAverage(const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
     size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format)
 {
@@ -6128,6 +6437,37 @@ void SimdSynetPoolingForwardAverage(const float* src, size_t srcC, size_t srcH,
 #endif
 }
 
+SIMD_API void SimdSynetPoolingForwardAverageStrided(const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+    size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, size_t dstStride, SimdBool excludePad, SimdTensorFormatType format)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    if (dstStride == srcC)
+        SimdSynetPoolingForwardAverage(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, excludePad, format);
+    else
+    {
+        Array32f buf(srcC * dstH * dstW);
+        SimdSynetPoolingForwardAverage(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, buf.data, dstH, dstW, excludePad, format);
+        Base::SynetCopyToStrided32f(buf.data, 1, srcC, dstH * dstW, format, dst, dstStride);
+    }
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetPoolingForwardAverage8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+    size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetPoolingForwardAverage8uPtr) (const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+        size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
+    const static SimdSynetPoolingForwardAverage8uPtr simdSynetPoolingForwardAverage8u = SIMD_FUNC3(SynetPoolingForwardAverage8u, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetPoolingForwardAverage8u(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, excludePad, format);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetPoolingForwardMax32f(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
     size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
 {
@@ -6142,6 +6482,23 @@ SIMD_API void SimdSynetPoolingForwardMax32f(const float * src, size_t srcC, size
 #endif
 }
 
+SIMD_API void SimdSynetPoolingForwardMax32fStrided(const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+    size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, size_t dstStride, SimdTensorFormatType format)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    if (dstStride == srcC)
+        SimdSynetPoolingForwardMax32f(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, format);
+    else
+    {
+        Array32f buf(srcC * dstH * dstW);
+        SimdSynetPoolingForwardMax32f(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, buf.data, dstH, dstW, format);
+        Base::SynetCopyToStrided32f(buf.data, 1, srcC, dstH * dstW, format, dst, dstStride);
+    }
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetPoolingForwardMax8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
     size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
 {
@@ -6168,6 +6525,20 @@ SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope,
 #endif
 }
 
+SIMD_API void SimdSynetReduceLayerForward(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+    SimdSynetReduceType type, SimdBool reduceChannels, SimdBool reduceSpatial, float* dst)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetReduceLayerForwardPtr) (const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+        SimdSynetReduceType type, SimdBool reduceChannels, SimdBool reduceSpatial, float* dst);
+    const static SimdSynetReduceLayerForwardPtr simdSynetReduceLayerForward = SIMD_FUNC3(SynetReduceLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdSynetReduceLayerForward(src, batch, channels, spatial, format, type, reduceChannels, reduceSpatial, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetRelu32f(const float* src, size_t size, const float* slope, float* dst)
 {
 #if defined(SIMD_SYNET_ENABLE)
@@ -6192,6 +6563,15 @@ SIMD_API void SimdSynetReorderImage(size_t batch, size_t channels, size_t spatia
 #endif
 }
 
+SIMD_API void SimdSynetReorderImage8u(size_t batch, size_t channels, size_t spatial, const uint8_t* src, SimdTensorFormatType srcFormat, uint8_t* dst, SimdTensorFormatType dstFormat)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    Base::SynetReorderImage8u(batch, channels, spatial, src, srcFormat, dst, dstFormat);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetReorderFilter(size_t output, size_t input, size_t kernel, const float* src, SimdTensorFormatType srcFormat, float* dst, SimdTensorFormatType dstFormat)
 {
 #if defined(SIMD_SYNET_ENABLE)
@@ -6216,6 +6596,34 @@ SIMD_API void SimdSynetRestrictRange32f(const float * src, size_t size, const fl
 #endif
 }
 
+SIMD_API void SimdSynetRoiAlign32f(const float * src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float * rois, size_t number,
+    size_t pooledH, size_t pooledW, const float * spatialScale, size_t samplingRatio, SimdBool aligned, float * dst)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetRoiAlign32fPtr) (const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+        size_t pooledH, size_t pooledW, const float* spatialScale, size_t samplingRatio, SimdBool aligned, float* dst);
+    const static SimdSynetRoiAlign32fPtr simdSynetRoiAlign32f = SIMD_FUNC3(SynetRoiAlign32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdSynetRoiAlign32f(src, channels, height, width, format, rois, number, pooledH, pooledW, spatialScale, samplingRatio, aligned, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetRoiPooling32f(const float * src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float * rois, size_t number,
+    size_t pooledH, size_t pooledW, const float * spatialScale, float * dst)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetRoiPooling32fPtr) (const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+        size_t pooledH, size_t pooledW, const float* spatialScale, float* dst);
+    const static SimdSynetRoiPooling32fPtr simdSynetRoiPooling32f = SIMD_FUNC3(SynetRoiPooling32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdSynetRoiPooling32f(src, channels, height, width, format, rois, number, pooledH, pooledW, spatialScale, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetScaleLayerForward(const float* src, const float* scale, const float* bias, size_t channels, size_t height, size_t width, float* dst, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility)
 {
 #if defined(SIMD_SYNET_ENABLE)
@@ -6228,6 +6636,20 @@ SIMD_API void SimdSynetScaleLayerForward(const float* src, const float* scale, c
 #endif
 }
 
+SIMD_API void SimdSynetScaledDotProductAttention32f(size_t batch, size_t queries, size_t keys, size_t depth, size_t valueDepth,
+    const float* query, const float* key, const float* value, const float* scale, float* dst)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetScaledDotProductAttention32fPtr) (size_t batch, size_t queries, size_t keys, size_t depth, size_t valueDepth,
+        const float* query, const float* key, const float* value, const float* scale, float* dst);
+    const static SimdSynetScaledDotProductAttention32fPtr simdSynetScaledDotProductAttention32f = SIMD_FUNC2(SynetScaledDotProductAttention32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC);
+
+    simdSynetScaledDotProductAttention32f(batch, queries, keys, depth, valueDepth, query, key, value, scale, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void* SimdSynetScale8iInit(size_t batch, size_t channels, size_t spatial, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility)
 {
 #if defined(SIMD_SYNET_ENABLE)
@@ -6323,6 +6745,18 @@ SIMD_API void SimdSynetSigmoid32f(const float* src, size_t size, const float* sl
 #endif
 }
 
+SIMD_API void SimdSynetSoftmaxArgMaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst, uint32_t* index)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetSoftmaxArgMaxLayerForwardPtr) (const float* src, size_t outer, size_t count, size_t inner, float* dst, uint32_t* index);
+    const static SimdSynetSoftmaxArgMaxLayerForwardPtr simdSynetSoftmaxArgMaxLayerForward = SIMD_FUNC3(SynetSoftmaxArgMaxLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdSynetSoftmaxArgMaxLayerForward(src, outer, count, inner, dst, index);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst)
 {
 #if defined(SIMD_SYNET_ENABLE)
@@ -6788,6 +7222,40 @@ SIMD_API void SimdWinogradKernel3x3Block4x4SetOutput(const float * src, size_t s
 #endif
 }
 
+SIMD_API void SimdWinogradKernel3x3Block6x6SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    const static SimdWinogradSetFilterPtr simdWinogradKernel3x3Block6x6SetFilter = SIMD_FUNC1(WinogradKernel3x3Block6x6SetFilter, SIMD_AVX512F_FUNC);
+
+    simdWinogradKernel3x3Block6x6SetFilter(src, size, dst, trans);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdWinogradKernel3x3Block6x6SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
+    size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    const static SimdWinogradSetInputPtr simdWinogradKernel3x3Block6x6SetInput = SIMD_FUNC1(WinogradKernel3x3Block6x6SetInput, SIMD_AVX512F_FUNC);
+
+    simdWinogradKernel3x3Block6x6SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdWinogradKernel3x3Block6x6SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    const static SimdWinogradSetOutputPtr simdWinogradKernel3x3Block6x6SetOutput = SIMD_FUNC1(WinogradKernel3x3Block6x6SetOutput, SIMD_AVX512F_FUNC);
+
+    simdWinogradKernel3x3Block6x6SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
     const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
 {
@@ -378,6 +378,44 @@ typedef enum
     SimdSynetEltwiseOperationMin, /*!< Minimum. */
 } SimdSynetEltwiseOperationType;
 
+/*! @ingroup synet
+    Describes operation type used in function ::SimdSynetBinaryOperation32fLayerForward.
+*/
+typedef enum
+{
+    /*! Addition: dst = a + b. */
+    SimdSynetBinaryOperation32fAdd,
+    /*! Division: dst = a / b. */
+    SimdSynetBinaryOperation32fDiv,
+    /*! Maximum: dst = Max(a, b). */
+    SimdSynetBinaryOperation32fMax,
+    /*! Minimum: dst = Min(a, b). */
+    SimdSynetBinaryOperation32fMin,
+    /*! Multiplication: dst = a * b. */
+    SimdSynetBinaryOperation32fMul,
+    /*! Power: dst = Pow(a, b) (base must be positive). */
+    SimdSynetBinaryOperation32fPow,
+    /*! Subtraction: dst = a - b. */
+    SimdSynetBinaryOperation32fSub,
+} SimdSynetBinaryOperation32fType;
+
+/*! @ingroup synet
+    Describes reduction type used in functions ::SimdSynetReduceLayerForward.
+*/
+typedef enum
+{
+    /*! L2 norm: dst = Sqrt(Sum(Square(src))). */
+    SimdSynetReduceL2,
+    /*! Maximum: dst = Max(src). */
+    SimdSynetReduceMax,
+    /*! Mean value: dst = Sum(src) / count. */
+    SimdSynetReduceMean,
+    /*! Minimum: dst = Min(src). */
+    SimdSynetReduceMin,
+    /*! Sum: dst = Sum(src). */
+    SimdSynetReduceSum,
+} SimdSynetReduceType;
+
 /*! @ingroup synet
     Describes operation type used in function ::SimdSynetUnaryOperation32fLayerForward.
 */
@@ -431,6 +469,8 @@ typedef enum
     SimdTensorData32i, /*!< 32-bit signed integer. */
     SimdTensorData8i, /*!< 8-bit signed integer. */
     SimdTensorData8u, /*!< 8-bit unsigned integer. */
+    SimdTensorData16f, /*!< 16-bit (half precision) float point. */
+    SimdTensorData16b, /*!< 16-bit brain float point (BF16). */
 } SimdTensorDataType;
 
 /*! @ingroup transform
@@ -2265,6 +2305,7 @@ extern "C"
 
         This function supports OpenCV HAAR and LBP cascades type.
         Tree based cascades and old cascade formats are not supported.
+        Also it loads cascades in binary format created by function ::SimdDetectionSaveBinary.
 
         \note This function is used for implementation of Simd::Detection.
 
@@ -2291,6 +2332,39 @@ extern "C"
     */
     SIMD_API void * SimdDetectionLoadStringXml(char * xml);
 
+    /*! @ingroup object_detection
+
+        \fn void * SimdDetectionLoadBinary(const uint8_t * buffer, size_t size);
+
+        \short Loads a classifier cascade from a memory buffer in binary format.
+
+        The binary format is a compact pre-parsed representation of classifier cascade which is created by function ::SimdDetectionSaveBinary.
+        Its loading does not require XML parsing. Function ::SimdDetectionLoadA also recognizes files in this format.
+
+        \note This function is used for implementation of Simd::Detection.
+
+        \param [in] buffer - a pointer to the buffer with binary cascade.
+        \param [in] size - a size of the buffer.
+        \return a pointer to loaded cascade. On error (wrong format or version) it returns NULL.
+                This pointer is used in functions ::SimdDetectionInfo and ::SimdDetectionInit, and must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdDetectionLoadBinary(const uint8_t * buffer, size_t size);
+
+    /*! @ingroup object_detection
+
+        \fn size_t SimdDetectionSaveBinary(const void * data, uint8_t * buffer, size_t size);
+
+        \short Saves a classifier cascade to a memory buffer in binary format.
+
+        The saved cascade can be loaded by functions ::SimdDetectionLoadBinary and ::SimdDetectionLoadA.
+
+        \param [in] data - a pointer to cascade which was received with using of function ::SimdDetectionLoadA, ::SimdDetectionLoadStringXml or ::SimdDetectionLoadBinary.
+        \param [out] buffer - a pointer to the output buffer. Can be NULL.
+        \param [in] size - a size of the output buffer.
+        \return a required size of the output buffer. If the buffer is NULL or its size is too small then nothing is written.
+    */
+    SIMD_API size_t SimdDetectionSaveBinary(const void * data, uint8_t * buffer, size_t size);
+
     /*! @ingroup object_detection
 
         \fn void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags);
@@ -3167,6 +3241,198 @@ extern "C"
     */
     SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
+    /*! @ingroup matrix
+
+        \fn void SimdGemm32fNNStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA, const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC);
+
+        \short Performs a batch of general matrix multiplications (for 32-bit float numbers).
+
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            C[b](M, N) = alpha*A[b](M, K)*B[b](K, N) + beta*C[b](M, N);
+        \endverbatim
+
+        Here A[b] = A + b*strideA, B[b] = B + b*strideB and C[b] = C + b*strideC. It is used for batched matrix products in attention layers.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] batch - a number of matrix multiplications.
+        \param [in] M - a height of A and height of C matrices.
+        \param [in] N - a width of B and width of C matrices.
+        \param [in] K - a width of A and height of B matrices.
+        \param [in] alpha - a pointer to multiplier of the first term.
+        \param [in] A - a pointer to input A matrices.
+        \param [in] lda - a leading dimension of A matrix.
+        \param [in] strideA - a distance (in elements) between neighboring A matrices.
+        \param [in] B - a pointer to input B matrices.
+        \param [in] ldb - a leading dimension of B matrix.
+        \param [in] strideB - a distance (in elements) between neighboring B matrices. Can be 0 (the same B matrix for all batch).
+        \param [in] beta - a pointer to multiplier of the second term.
+        \param [out] C - a pointer to output C matrices.
+        \param [in] ldc - a leading dimension of C matrix.
+        \param [in] strideC - a distance (in elements) between neighboring C matrices.
+    */
+    SIMD_API void SimdGemm32fNNStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA, 
+        const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC);
+
+    /*! @ingroup matrix
+
+        \fn void SimdGemm32fNTStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA, const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC);
+
+        \short Performs a batch of general matrix multiplications (for 32-bit float numbers).
+
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            C[b](M, N) = alpha*A[b](M, K)*Trans(B[b](N, K)) + beta*C[b](M, N);
+        \endverbatim
+
+        Here A[b] = A + b*strideA, B[b] = B + b*strideB and C[b] = C + b*strideC. It is used for batched matrix products in attention layers (Q*Trans(K)).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] batch - a number of matrix multiplications.
+        \param [in] M - a height of A and height of C matrices.
+        \param [in] N - a height of B and width of C matrices.
+        \param [in] K - a width of A and width of B matrices.
+        \param [in] alpha - a pointer to multiplier of the first term.
+        \param [in] A - a pointer to input A matrices.
+        \param [in] lda - a leading dimension of A matrix.
+        \param [in] strideA - a distance (in elements) between neighboring A matrices.
+        \param [in] B - a pointer to input B matrices.
+        \param [in] ldb - a leading dimension of B matrix.
+        \param [in] strideB - a distance (in elements) between neighboring B matrices. Can be 0 (the same B matrix for all batch).
+        \param [in] beta - a pointer to multiplier of the second term.
+        \param [out] C - a pointer to output C matrices.
+        \param [in] ldc - a leading dimension of C matrix.
+        \param [in] strideC - a distance (in elements) between neighboring C matrices.
+    */
+    SIMD_API void SimdGemm32fNTStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA, 
+        const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC);
+
+    /*! @ingroup matrix
+
+        \fn void * SimdGemm32fPackedInit(size_t M, size_t N, size_t K, SimdConvolutionActivationType activation);
+
+        \short Initializes context of matrix multiplication with pre-packed constant B matrix (for 32-bit float numbers).
+
+        The algorithm computes:
+        \verbatim
+        C(M, N) = Activation(A(M, K)*B(K, N) + beta*C(M, N) + bias(N));
+        \endverbatim
+        Matrix B is reordered to the internal format only once in function ::SimdGemm32fPackedSetParams, so the context is useful when the same weights are multiplied many times.
+        Bias, activation function and accumulation to C are applied to each output block while it is still in cache.
+
+        \param [in] M - an expected height of A and C matrices. It is used to choose optimal microkernel. Function ::SimdGemm32fPackedRun accepts any height.
+        \param [in] N - a width of B and C matrices.
+        \param [in] K - a width of A and height of B matrices.
+        \param [in] activation - an activation function type (see ::SimdConvolutionActivationType).
+        \return a pointer to matrix multiplication context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdGemm32fPackedSetParams and ::SimdGemm32fPackedRun.
+    */
+    SIMD_API void * SimdGemm32fPackedInit(size_t M, size_t N, size_t K, SimdConvolutionActivationType activation);
+
+    /*! @ingroup matrix
+
+        \fn void SimdGemm32fPackedSetParams(void * context, const float * B, const float * bias, const float * params);
+
+        \short Sets B matrix, bias and activation parameters of matrix multiplication with pre-packed B matrix.
+
+        Matrix multiplication context must be created by function ::SimdGemm32fPackedInit. All arrays are copied to the context.
+
+        \param [in, out] context - a matrix multiplication context. It must be created by function ::SimdGemm32fPackedInit and released by function ::SimdRelease.
+        \param [in] B - a pointer to B matrix (K x N, row-major, leading dimension is equal to N).
+        \param [in] bias - a pointer to bias (N elements). Can be NULL.
+        \param [in] params - a pointer to parameters of activation functions (see ::SimdConvolutionActivationType). Can be NULL.
+    */
+    SIMD_API void SimdGemm32fPackedSetParams(void * context, const float * B, const float * bias, const float * params);
+
+    /*! @ingroup matrix
+
+        \fn void SimdGemm32fPackedRun(void * context, size_t M, const float * A, size_t lda, const float * beta, float * C, size_t ldc);
+
+        \short Performs matrix multiplication with pre-packed B matrix.
+
+        Matrix multiplication context must be created by function ::SimdGemm32fPackedInit and initialized by function ::SimdGemm32fPackedSetParams.
+
+        \note The context keeps only packed B matrix, bias and parameters: the function does not change it and can be called from several threads at once.
+            So at every call the function chooses blocking for given M and allocates a temporary buffer for packing of A matrix 
+            (its size is limited by size of L2 cache). This overhead is negligible for large matrices, but it is noticeable when M is small (a few rows).
+
+        \param [in] context - a matrix multiplication context. It must be created by function ::SimdGemm32fPackedInit and released by function ::SimdRelease.
+        \param [in] M - a height of A and C matrices. It can differ from value passed to ::SimdGemm32fPackedInit.
+        \param [in] A - a pointer to input A matrix.
+        \param [in] lda - a leading dimension of A matrix.
+        \param [in] beta - a pointer to multiplier of accumulated C matrix. Can be NULL (is equal to 0).
+        \param [in, out] C - a pointer to output C matrix.
+        \param [in] ldc - a leading dimension of C matrix.
+    */
+    SIMD_API void SimdGemm32fPackedRun(void * context, size_t M, const float * A, size_t lda, const float * beta, float * C, size_t ldc);
+
+    /*! @ingroup matrix
+
+        \fn void * SimdGemm8iPackedInit(size_t M, size_t N, size_t K, SimdTensorDataType dstT, SimdSynetCompatibilityType compatibility);
+
+        \short Initializes context of quantized matrix multiplication with pre-packed constant B matrix (8-bit unsigned A and 8-bit signed B).
+
+        The algorithm computes:
+        \verbatim
+        sum(i, j) = Sum((A(i, k) - aZero)*(B(k, j) - bZero(j)), k = 0..K-1);
+        C(i, j) = sum(i, j); // dstT == SimdTensorData32i
+        C(i, j) = sum(i, j)*scale(j) + shift(j); // dstT == SimdTensorData32f
+        C(i, j) = Min(Max(Round(sum(i, j)*scale(j) + shift(j)), 0), 255); // dstT == SimdTensorData8u
+        \endverbatim
+        Matrix B is reordered to the internal format only once in function ::SimdGemm8iPackedSetParams. 
+        Zero point compensation and requantization are applied to each output block in registers.
+
+        \note Precise multiplication (SimdSynetCompatibility8iPrecise) uses VNNI or its 16-bit emulation. 
+            Other options use faster multiplication with possible 16-bit integer overflow (see ::SimdSynetCompatibilityType).
+
+        \param [in] M - an expected height of A and C matrices. Function ::SimdGemm8iPackedRun accepts any height.
+        \param [in] N - a width of B and C matrices.
+        \param [in] K - a width of A and height of B matrices.
+        \param [in] dstT - a type of output C matrix. It can be ::SimdTensorData32i, ::SimdTensorData32f or ::SimdTensorData8u.
+        \param [in] compatibility - a flags of bitwise compatibility.
+        \return a pointer to matrix multiplication context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdGemm8iPackedSetParams and ::SimdGemm8iPackedRun.
+    */
+    SIMD_API void * SimdGemm8iPackedInit(size_t M, size_t N, size_t K, SimdTensorDataType dstT, SimdSynetCompatibilityType compatibility);
+
+    /*! @ingroup matrix
+
+        \fn void SimdGemm8iPackedSetParams(void * context, const int8_t * B, uint8_t aZero, const int8_t * bZero, const float * scale, const float * shift);
+
+        \short Sets B matrix, zero points and output requantization parameters of quantized matrix multiplication with pre-packed B matrix.
+
+        Matrix multiplication context must be created by function ::SimdGemm8iPackedInit. All arrays are copied to the context.
+
+        \param [in, out] context - a matrix multiplication context. It must be created by function ::SimdGemm8iPackedInit and released by function ::SimdRelease.
+        \param [in] B - a pointer to B matrix (K x N, row-major, leading dimension is equal to N).
+        \param [in] aZero - a zero point of A matrix.
+        \param [in] bZero - a pointer to zero points of B matrix columns (N elements). Can be NULL (all zero points are equal to 0).
+        \param [in] scale - a pointer to output scales (N elements). Can be NULL (is equal to 1). It is ignored for ::SimdTensorData32i output.
+        \param [in] shift - a pointer to output shifts (N elements). Can be NULL (is equal to 0). It is ignored for ::SimdTensorData32i output.
+    */
+    SIMD_API void SimdGemm8iPackedSetParams(void * context, const int8_t * B, uint8_t aZero, const int8_t * bZero, const float * scale, const float * shift);
+
+    /*! @ingroup matrix
+
+        \fn void SimdGemm8iPackedRun(void * context, size_t M, const uint8_t * A, size_t lda, uint8_t * C, size_t ldc);
+
+        \short Performs quantized matrix multiplication with pre-packed B matrix.
+
+        Matrix multiplication context must be created by function ::SimdGemm8iPackedInit and initialized by function ::SimdGemm8iPackedSetParams.
+
+        \note The function does not change the context (row sums of A matrix are stored in a temporary buffer), so it can be called from several threads at once.
+
+        \param [in] context - a matrix multiplication context. It must be created by function ::SimdGemm8iPackedInit and released by function ::SimdRelease.
+        \param [in] M - a height of A and C matrices. It can differ from value passed to ::SimdGemm8iPackedInit.
+        \param [in] A - a pointer to input A matrix.
+        \param [in] lda - a leading dimension of A matrix.
+        \param [out] C - a pointer to output C matrix (its type is defined by parameter dstT of ::SimdGemm8iPackedInit).
+        \param [in] ldc - a leading dimension of C matrix (in elements).
+    */
+    SIMD_API void SimdGemm8iPackedRun(void * context, size_t M, const uint8_t * A, size_t lda, uint8_t * C, size_t ldc);
+
     /*! @ingroup gray_conversion
 
         \fn void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride);
@@ -6097,6 +6363,31 @@ extern "C"
     SIMD_API void SimdSynetAdd8i(const uint8_t * aData, const float * aScale, const float* aShift, const uint8_t* bData, const float* bScale, const float* bShift,
         uint8_t* cData, const float* cScale, const float* cShift, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetBinaryOperation32fLayerForward(const float* a, const size_t* aShape, size_t aCount, const float* b, const size_t* bShape, size_t bCount, SimdSynetBinaryOperation32fType type, float* dst);
+
+        \short This function is used for forward propagation of BinaryOperationLayer with NumPy-style broadcasting.
+
+        Shapes of the input tensors are aligned by their last dimensions. Each pair of aligned dimensions must be equal or one of them must be 1.
+        Missing leading dimensions are treated as 1. The output tensor has shape of per-dimension maximum of the input shapes.
+        Adjacent dimensions with the same broadcast pattern are merged, so the operation is reduced to a loop over contiguous vector-vector, 
+        vector-scalar or scalar-vector blocks.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] a - a pointer to the first input 32-bit float tensor.
+        \param [in] aShape - a pointer to the array with shape of the first input tensor.
+        \param [in] aCount - a number of dimensions of the first input tensor.
+        \param [in] b - a pointer to the second input 32-bit float tensor.
+        \param [in] bShape - a pointer to the array with shape of the second input tensor.
+        \param [in] bCount - a number of dimensions of the second input tensor.
+        \param [in] type - a binary operation type (see ::SimdSynetBinaryOperation32fType).
+        \param [out] dst - a pointer to the output 32-bit float tensor.
+    */
+    SIMD_API void SimdSynetBinaryOperation32fLayerForward(const float* a, const size_t* aShape, size_t aCount, const float* b, const size_t* bShape, size_t bCount,
+        SimdSynetBinaryOperation32fType type, float* dst);
+
     /*! @ingroup synet_conversion
 
         \fn void SimdSynetConvert32fTo8u(const float * src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float * shift, uint8_t * dst, SimdSynetCompatibilityType compatibility);
@@ -6110,7 +6401,7 @@ extern "C"
         \param [in] channels - a number of channels in the (input/output) image tensor.
         \param [in] height - a height of (input/output) image tensor.
         \param [in] width - a width of (input/output) image tensor.
-        \param [in] format - a format of (input/output) image tensor.
+        \param [in] format - a format of (input/output) image tensor. It can be ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc, ::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c, ::SimdTensorFormatNchw16c.
         \param [in] scale - a pointer to the 32-bit float array with scale coefficients. 
         \param [in] shift - a pointer to the 32-bit float array with shift coefficients. 
         \param [out] dst - a pointer to the 8-bit unsigned integer array with output image tensor. 
@@ -6131,7 +6422,7 @@ extern "C"
         \param [in] channels - a number of channels in the (input/output) image tensor.
         \param [in] height - a height of (input/output) image tensor.
         \param [in] width - a width of (input/output) image tensor.
-        \param [in] format - a format of (input/output) image tensor.
+        \param [in] format - a format of (input/output) image tensor. It can be ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc, ::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c, ::SimdTensorFormatNchw16c.
         \param [in] scale - a pointer to the 32-bit float array with scale coefficients.
         \param [in] shift - a pointer to the 32-bit float array with shift coefficients.
         \param [out] dst - a pointer to the array with 32-bit float output image tensor.
@@ -6154,13 +6445,36 @@ extern "C"
     */
     SIMD_API void * SimdSynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
 
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void * SimdSynetConvolution32fInitV2(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType);
+
+        \short Initilizes FP32 convolution algorithm with given type of internal storage of weights.
+
+        It is an extended version of function ::SimdSynetConvolution32fInit.
+        16-bit weights are supported for 1x1 convolutions (stride 1, no padding, group 1) in NHWC format 
+        with small output (batch * dstH * dstW <= 64), where the convolution is bound by loading of weights. 
+        They are converted to FP32 on the fly (for every output point) and accumulation is performed in FP32.
+        Other convolutions use FP32 weights.
+
+        \param [in] batch - a batch size.
+        \param [in] conv - a pointer to convolution parameters.
+        \param [in] gemm - a pointer to external function of matrix multiplication. Can be NULL.
+        \param [in] weightType - a type of internal storage of weights (SimdTensorData32f, SimdTensorData16f or SimdTensorData16b).
+            Value SimdTensorData32f gives the same result as ::SimdSynetConvolution32fInit.
+        \return a pointer to FP32 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetConvolution32fExternalBufferSize, ::SimdSynetConvolution32fInternalBufferSize, 
+            ::SimdSynetConvolution32fInfo, ::SimdSynetConvolution32fSetParams and ::SimdSynetConvolution32fForward.
+    */
+    SIMD_API void * SimdSynetConvolution32fInitV2(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType);
+
     /*! @ingroup synet_convolution_fp32
 
         \fn size_t SimdSynetConvolution32fExternalBufferSize(const void * context);
 
         \short Gets size of external temporary buffer required for FP32 convolution algorithm.
 
-        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit (::SimdSynetConvolution32fInitV2) and released by function ::SimdRelease.
         \return size of external temporary buffer required for FP32 convolution algorithm.
     */
     SIMD_API size_t SimdSynetConvolution32fExternalBufferSize(const void * context);
@@ -6171,7 +6485,7 @@ extern "C"
 
         \short Gets size of internal buffer used inside FP32 convolution algorithm.
 
-        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit (::SimdSynetConvolution32fInitV2) and released by function ::SimdRelease.
         \return size of internal buffer used inside FP32 convolution algorithm.
     */
     SIMD_API size_t SimdSynetConvolution32fInternalBufferSize(const void * context);
@@ -6182,7 +6496,7 @@ extern "C"
 
         \short Gets description of internal implementation of FP32 convolution algorithm.
 
-        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit (::SimdSynetConvolution32fInitV2) and released by function ::SimdRelease.
         \return string with description of internal implementation of FP32 convolution algorithm.
     */
     SIMD_API const char* SimdSynetConvolution32fInfo(const void* context);
@@ -6193,7 +6507,10 @@ extern "C"
 
         \short Sets weights, biases and parameters of activation function required for FP32 convolution algorithm.
 
-        \param [in, out] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \note For 1x1 convolutions the weights are checked for sparsity: if most of them are zero (pruned models) 
+            they are converted to block-compressed format and stored in the internal buffer.
+
+        \param [in, out] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit (::SimdSynetConvolution32fInitV2) and released by function ::SimdRelease.
         \param [in] weight - a pointer to convolution weights.
         \param [out] internal - a flag signalized that weight is stored in the internal buffer. Can be NULL.
         \param [in] bias - a pointer to bias. Can be NULL.
@@ -6207,19 +6524,46 @@ extern "C"
 
         \short Performs forward propagation of FP32 convolution algorithm.
 
-        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit (::SimdSynetConvolution32fInitV2) and released by function ::SimdRelease.
         \param [in] src - a pointer to input tensor.
         \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetConvolution32fExternalBufferSize. Can be NULL (it causes usage of internal buffer).
         \param [out] dst - a pointer to output tensor.
     */
     SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void SimdSynetConvolution32fForwardStrided(void * context, const float * src, float * buf, float * dst, size_t dstStride);
+
+        \short Performs forward propagation of FP32 convolution algorithm with output to a part of bigger tensor.
+
+        The output of the convolution is stored to channels [offset, offset + dstC) of output tensor which has dstStride channels 
+        (and the same batch, height and width). It allows to concatenate outputs of several layers along channel dimension without separate Concat layer.
+        In NHWC format the output points are stored with step dstStride, in NCHW format the output images are stored with step dstStride*dstH*dstW.
+        Other channels of output tensor are not changed.
+
+        \note If dstStride is not equal to dstC, the convolution is calculated into an internal buffer and then it is copied to output tensor.
+
+        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit (::SimdSynetConvolution32fInitV2) and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor.
+        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetConvolution32fExternalBufferSize. Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to output tensor shifted to channel offset (dst + offset in NHWC format, dst + offset*dstH*dstW in NCHW format).
+        \param [in] dstStride - a number of channels of output tensor. It must be not less than dstC. 
+            If it is equal to dstC the function is equal to ::SimdSynetConvolution32fForward.
+    */
+    SIMD_API void SimdSynetConvolution32fForwardStrided(void * context, const float * src, float * buf, float * dst, size_t dstStride);
+
     /*! @ingroup synet_convolution_int8
 
         \fn void * SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
 
         \short Initilizes INT8 convolution algorithm.
 
+        Input and output images can have ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc, ::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c 
+        or ::SimdTensorFormatNchw16c format (formats of input and output must be the same). Channel-blocked formats are supported only for 
+        ordinary (group = 1) and depthwise (group = input channels = output channels) convolutions; the convolution weights for them 
+        have ::SimdTensorFormatOiyx format. ::SimdTensorFormatNchw16c is optimized for AVX-512BW and AVX-512VNNI.
+
         \param [in] batch - a batch size.
         \param [in] conv - a pointer to convolution parameters.
         \param [in] compatibility - a flags of bitwise compatibility.
@@ -6364,6 +6708,96 @@ extern "C"
     */
     SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetDecodeSsd32f(const float * loc, const float * prior, const float * variance, size_t count, float * dst);
+
+        \short Decodes bounding boxes of SSD detector (CENTER_SIZE code type).
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < count; ++i)
+        {
+            priorW = prior[i][2] - prior[i][0];
+            priorH = prior[i][3] - prior[i][1];
+            centerX = variance[i][0] * loc[i][0] * priorW + (prior[i][0] + prior[i][2]) / 2;
+            centerY = variance[i][1] * loc[i][1] * priorH + (prior[i][1] + prior[i][3]) / 2;
+            halfW = Exp(variance[i][2] * loc[i][2]) * priorW / 2;
+            halfH = Exp(variance[i][3] * loc[i][3]) * priorH / 2;
+            dst[i] = { centerX - halfW, centerY - halfH, centerX + halfW, centerY + halfH };
+        }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] loc - a pointer to the 32-bit float array with box offsets predicted by network. The size of the array is count * 4.
+        \param [in] prior - a pointer to the 32-bit float array with prior boxes (xmin, ymin, xmax, ymax). The size of the array is count * 4.
+        \param [in] variance - a pointer to the 32-bit float array with variances of prior boxes. The size of the array is count * 4.
+        \param [in] count - a number of boxes.
+        \param [out] dst - a pointer to the 32-bit float array with decoded boxes (xmin, ymin, xmax, ymax). The size of the array is count * 4.
+    */
+    SIMD_API void SimdSynetDecodeSsd32f(const float * loc, const float * prior, const float * variance, size_t count, float * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetDecodeYolo32f(const float * src, size_t anchors, size_t classes, size_t height, size_t width, const float * sizes, float * boxes, float * scores);
+
+        \short Decodes bounding boxes and class scores of YOLO (v2/v3) detector output.
+
+        Algorithm's details (for every anchor a, cell (y, x) and class c, i = (a * height + y) * width + x):
+        \verbatim
+        centerX = (x + Sigmoid(src[a][0][y][x])) / width;
+        centerY = (y + Sigmoid(src[a][1][y][x])) / height;
+        halfW = Exp(src[a][2][y][x]) * sizes[2 * a + 0] / 2;
+        halfH = Exp(src[a][3][y][x]) * sizes[2 * a + 1] / 2;
+        boxes[i] = { centerX - halfW, centerY - halfH, centerX + halfW, centerY + halfH };
+        scores[c][i] = Sigmoid(src[a][4][y][x]) * Sigmoid(src[a][5 + c][y][x]);
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the 32-bit float array with YOLO layer input in NCHW format. The size of the array is anchors * (5 + classes) * height * width.
+        \param [in] anchors - a number of anchors.
+        \param [in] classes - a number of classes.
+        \param [in] height - a height of the grid.
+        \param [in] width - a width of the grid.
+        \param [in] sizes - a pointer to the 32-bit float array with anchor sizes (width, height) normalized to the input image size. The size of the array is 2 * anchors.
+        \param [out] boxes - a pointer to the 32-bit float array with decoded boxes (xmin, ymin, xmax, ymax). The size of the array is anchors * height * width * 4.
+        \param [out] scores - a pointer to the 32-bit float array with class scores. The size of the array is classes * anchors * height * width.
+    */
+    SIMD_API void SimdSynetDecodeYolo32f(const float * src, size_t anchors, size_t classes, size_t height, size_t width, const float * sizes, float * boxes, float * scores);
+
+    /*! @ingroup synet
+
+        \fn size_t SimdSynetDetectionOutput32f(const float * boxes, const float * scores, size_t count, size_t classes, size_t background, const float * confidence, const float * overlap, size_t topK, size_t keepTopK, float * dst);
+
+        \short Selects detected objects with non-maximum suppression (NMS) for every class (output stage of SSD/YOLO detectors).
+
+        For every class (except background) candidates with score greater than confidence threshold are selected and sorted in descending order of score.
+        At most topK best candidates are checked. A candidate is kept if its intersection over union (IoU) with every box kept before in this class 
+        is not greater than overlap threshold. If the total number of kept boxes is greater than keepTopK then only keepTopK boxes with maximal score are returned.
+        Output boxes are ordered by class and then by descending score.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>. 
+            Scores in NHWC layout ([count][classes], as in Caffe SSD) can be converted with ::SimdSynetReorderImage (channels = classes, spatial = count).
+
+        \param [in] boxes - a pointer to the 32-bit float array with decoded boxes (xmin, ymin, xmax, ymax). The size of the array is count * 4.
+        \param [in] scores - a pointer to the 32-bit float array with class scores in [classes][count] layout. The size of the array is classes * count.
+        \param [in] count - a number of boxes.
+        \param [in] classes - a number of classes.
+        \param [in] background - an index of background class (it is skipped). Set it to classes if there is no background class.
+        \param [in] confidence - a pointer to confidence threshold.
+        \param [in] overlap - a pointer to NMS (IoU) threshold.
+        \param [in] topK - a maximal number of candidates of every class checked by NMS. 0 means no restriction.
+        \param [in] keepTopK - a maximal number of output boxes. 0 means no restriction.
+        \param [out] dst - a pointer to the 32-bit float array with output boxes (label, score, xmin, ymin, xmax, ymax).
+            The maximal number of output boxes is N = C * (topK ? Min(topK, count) : count), where C is a number of non-background classes 
+            (classes - 1 if background < classes, and classes otherwise). The size of the array must be at least (keepTopK ? Min(keepTopK, N) : N) * 6.
+        \return a number of output boxes.
+    */
+    SIMD_API size_t SimdSynetDetectionOutput32f(const float * boxes, const float * scores, size_t count, size_t classes, size_t background,
+        const float * confidence, const float * overlap, size_t topK, size_t keepTopK, float * dst);
+
     /*! @ingroup synet
 
         \fn void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
@@ -6655,6 +7089,47 @@ extern "C"
     */
     SIMD_API void SimdSynetFusedLayerForward9(const float * src0, const float * src1, const float * scale, const float * bias, size_t channels0, size_t channels1, size_t spatial, float * dst0, float * dst1, SimdTensorFormatType format);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetGroupNormalize32f(const float * src, size_t batch, size_t channels, size_t spatial, size_t group, const float * scale, const float * shift, const float * eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float * params, float * dst);
+
+        \short This function is used for forward propagation of GroupNorm (and InstanceNorm) layer.
+
+        Mean and variance are calculated for every group of channels of every image in the batch (in one pass over the input tensor).
+        InstanceNorm is a particular case of GroupNorm when group == channels.
+
+        Algorithm's details (example for NCHW tensor format):
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            for(g = 0; g < group; ++g)
+            {
+                size = channels / group * spatial;
+                mean = Sum(src[b, g]) / size;
+                norm = 1 / Sqrt(Sum(Square(src[b, g])) / size - Square(mean) + eps[0]);
+                for(c = g * channels / group; c < (g + 1) * channels / group; ++c)
+                    for(s = 0; s < spatial; ++s)
+                        dst[b, c, s] = Activate((src[b, c, s] - mean) * norm * scale[c] + shift[c]);
+            }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the 32-bit float array with input image tensor. The size of the array is batch * channels * spatial.
+        \param [in] batch - a batch size.
+        \param [in] channels - a number of channels in the (input/output) image tensor. It must be a multiple of group.
+        \param [in] spatial - a spatial size of (input/output) image tensor.
+        \param [in] group - a number of channel groups.
+        \param [in] scale - a pointer to the 32-bit float array with scale coefficients. The size of the array is channels. Can be NULL (scale is equal to 1).
+        \param [in] shift - a pointer to the 32-bit float array with shift coefficients. The size of the array is channels. Can be NULL (shift is equal to 0).
+        \param [in] eps - a pointer to epsilon parameter (it is added to variance).
+        \param [in] format - a format of (input/output) image tensor. Only ::SimdTensorFormatNchw and ::SimdTensorFormatNhwc are supported.
+        \param [in] activation - an activation function type fused to the output.
+        \param [in] params - a pointer to parameters of activation function (see ::SimdConvolutionActivationType). For ::SimdConvolutionActivationPrelu the size of the array is channels.
+        \param [out] dst - a pointer to the 32-bit float array with output image tensor. The size of the array is batch * channels * spatial. It can be equal to src.
+    */
+    SIMD_API void SimdSynetGroupNormalize32f(const float * src, size_t batch, size_t channels, size_t spatial, size_t group, const float * scale, const float * shift,
+        const float * eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float * params, float * dst);
+
     /*! @ingroup synet_activation
 
         \fn void SimdSynetHardSigmoid32f(const float * src, size_t size, const float * scale, const float * shift, float * dst);
@@ -6719,13 +7194,35 @@ extern "C"
     */
     SIMD_API void* SimdSynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
 
+    /*! @ingroup synet_inner_product
+
+        \fn void * SimdSynetInnerProduct32fInitV2(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType);
+
+        \short Initilizes FP32 inner product algorithm with given type of internal storage of weights.
+
+        It is an extended version of function ::SimdSynetInnerProduct32fInit.
+        16-bit weights are converted to FP32 on the fly and accumulation is performed in FP32.
+        It halves memory traffic of weights for memory-bound inner products (small batch).
+
+        \param [in] batch - a batch size.
+        \param [in] input - a input vector size.
+        \param [in] output - a output vector size.
+        \param [in] transpose - a flag of transposing of weight matrix.
+        \param [in] activation - an activation function type used after inner product.
+        \param [in] weightType - a type of internal storage of weights (SimdTensorData32f, SimdTensorData16f or SimdTensorData16b).
+            Value SimdTensorData32f gives the same result as ::SimdSynetInnerProduct32fInit.
+        \return a pointer to FP32 inner product context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetInnerProduct32fInternalBufferSize, :SimdSynetInnerProduct32fSetParams and ::SimdSynetInnerProduct32fForward.
+    */
+    SIMD_API void* SimdSynetInnerProduct32fInitV2(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType);
+
     /*! @ingroup synet_inner_product
 
         \fn size_t SimdSynetInnerProduct32fInternalBufferSize(const void * context);
 
         \short Gets size of internal buffer used inside FP32 inner product algorithm.
 
-        \param [in] context - a pointer to FP32 inner product context. It must be created by function ::SimdSynetInnerProduct32fInit and released by function ::SimdRelease.
+        \param [in] context - a pointer to FP32 inner product context. It must be created by function ::SimdSynetInnerProduct32fInit (::SimdSynetInnerProduct32fInitV2) and released by function ::SimdRelease.
         \return size of internal buffer used inside FP32 deconvolution algorithm.
     */
     SIMD_API size_t SimdSynetInnerProduct32fInternalBufferSize(const void* context);
@@ -6736,7 +7233,10 @@ extern "C"
 
         \short Sets weights, beases and parameters of activation function required for FP32 inner product algorithm.
 
-        \param [in, out] context - a pointer to FP32 inner product context. It must be created by function ::SimdSynetInnerProduct32fInit and released by function ::SimdRelease.
+        \note The weights are checked for sparsity: if most of them are zero (pruned models) 
+            they are converted to block-compressed format and stored in the internal buffer.
+
+        \param [in, out] context - a pointer to FP32 inner product context. It must be created by function ::SimdSynetInnerProduct32fInit (::SimdSynetInnerProduct32fInitV2) and released by function ::SimdRelease.
         \param [in] weight - a pointer to inner product weights.
         \param [out] internal - a flag signalized that weight is stored in the internal buffer. Can be NULL.
         \param [in] bias - a pointer to bias. Can be NULL.
@@ -6750,7 +7250,7 @@ extern "C"
 
         \short Performs forward propagation of FP32 inner product algorithm.
 
-        \param [in] context - a pointer to FP32 inner product context. It must be created by function ::SimdSynetInnerProduct32fInit and released by function ::SimdRelease.
+        \param [in] context - a pointer to FP32 inner product context. It must be created by function ::SimdSynetInnerProduct32fInit (::SimdSynetInnerProduct32fInitV2) and released by function ::SimdRelease.
         \param [in] src - a pointer to input tensor.
         \param [out] dst - a pointer to output tensor.
     */
@@ -6815,32 +7315,202 @@ extern "C"
     */
     SIMD_API void SimdSynetInnerProduct8i(size_t M, size_t N, size_t K, const uint8_t * src, const int8_t * weight, int32_t * dst, SimdSynetCompatibilityType compatibility);
 
-    /*! @ingroup synet
+    /*! @ingroup synet_inner_product
 
-        \fn void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t channels, size_t spatial, const float * k, float * dst, SimdTensorFormatType format);
+        \fn void * SimdSynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
 
-        \short This function is used for forward propagation of LrnLayer (cross channels normalization).
+        \short Initilizes INT8 inner product algorithm.
 
-        Algorithm's details (example for NCHW tensor format):
-        \verbatim
-        for(c = 0; c < channels; ++c)
-            for(s = 0; s < spatial; ++s)
-            {
-                lo = Max(0, c - half);
-                hi = Min(channels, c + half + 1);
-                sum = 0;
-                for(i = lo; i < ln; ++i)
-                    sum += Square(src[i*spatial + s]);
-                dst[c*spatial + s] = src[c*spatial + s]*Pow(k[0] + sum*k[1], k[2]);
-            }
-        \endverbatim
+        Input and output tensors have shapes [batch, input] and [batch, output]. 
+        The weights are quantized with per-output-channel scales and packed for the best available kernel (including AVX-512VNNI). 
+        Bias and activation function are fused in the output conversion.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        \param [in] batch - a batch size.
+        \param [in] input - a input vector size.
+        \param [in] output - a output vector size.
+        \param [in] transpose - a flag of transposing of weight matrix. If it is set then weight has shape [output, input] else [input, output].
+        \param [in] srcT - a type of input tensor (SimdTensorData32f or SimdTensorData8u).
+        \param [in] dstT - a type of output tensor (SimdTensorData32f or SimdTensorData8u).
+        \param [in] activation - an activation function type used after inner product.
+        \param [in] compatibility - a flags of bitwise compatibility.
+        \return a pointer to INT8 inner product context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetInnerProduct8iExternalBufferSize, ::SimdSynetInnerProduct8iInternalBufferSize, 
+            ::SimdSynetInnerProduct8iInfo, ::SimdSynetInnerProduct8iSetParams and ::SimdSynetInnerProduct8iForward.
+    */
+    SIMD_API void * SimdSynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
 
-        \param [in] src - a pointer to the 32-bit float array with input image tensor. The size of the array is ::SimdAlign (channels, ::SimdSynetTensorAlignment (format)) * spatial.
-        \param [in] half - a local normalization half size.
-        \param [in] channels - a number of channels in the (input/output) image tensor
-        \param [in] spatial - a spatial size of (input/output) image tensor.
+    /*! @ingroup synet_inner_product
+
+        \fn size_t SimdSynetInnerProduct8iExternalBufferSize(const void * context);
+
+        \short Gets size in bytes of external temporary buffer required for INT8 inner product algorithm.
+
+        \param [in] context - a pointer to INT8 inner product context. It must be created by function ::SimdSynetInnerProduct8iInit and released by function ::SimdRelease.
+        \return size of external temporary buffer required for INT8 inner product algorithm.
+    */
+    SIMD_API size_t SimdSynetInnerProduct8iExternalBufferSize(const void * context);
+
+    /*! @ingroup synet_inner_product
+
+        \fn size_t SimdSynetInnerProduct8iInternalBufferSize(const void * context);
+
+        \short Gets size of internal buffer used inside INT8 inner product algorithm.
+
+        \param [in] context - a pointer to INT8 inner product context. It must be created by function ::SimdSynetInnerProduct8iInit and released by function ::SimdRelease.
+        \return size of internal buffer used inside INT8 inner product algorithm.
+    */
+    SIMD_API size_t SimdSynetInnerProduct8iInternalBufferSize(const void * context);
+
+    /*! @ingroup synet_inner_product
+
+        \fn const char* SimdSynetInnerProduct8iInfo(const void* context);
+
+        \short Gets description of internal implementation of INT8 inner product algorithm.
+
+        \param [in] context - a pointer to INT8 inner product context. It must be created by function ::SimdSynetInnerProduct8iInit and released by function ::SimdRelease.
+        \return string with description of internal implementation of INT8 inner product algorithm.
+    */
+    SIMD_API const char* SimdSynetInnerProduct8iInfo(const void* context);
+
+    /*! @ingroup synet_inner_product
+
+        \fn void SimdSynetInnerProduct8iSetParams(void * context, const float * weight, const float * bias, const float * params, const float * const * stats);
+
+        \short Sets weights, biases, parameters of activation function, input/output tensor statistics required for INT8 inner product algorithm.
+
+        \param [in, out] context - a pointer to INT8 inner product context. It must be created by function ::SimdSynetInnerProduct8iInit and released by function ::SimdRelease.
+        \param [in] weight - a pointer to original (32-bit float point) inner product weights.
+        \param [in] bias - a pointer to original (32-bit float point) bias. Can be NULL.
+        \param [in] params - a pointer to original (32-bit float point) parameters of activation functions (see ::SimdConvolutionActivationType). Can be NULL.
+        \param [in] stats - a pointer to pointers with statistics of input(min - stats[0], max - stats[1]) and output(min - stats[2], max - stats[3]) tensors.
+    */
+    SIMD_API void SimdSynetInnerProduct8iSetParams(void * context, const float * weight, const float * bias, const float * params, const float * const* stats);
+
+    /*! @ingroup synet_inner_product
+
+        \fn void SimdSynetInnerProduct8iForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst);
+
+        \short Performs forward propagation of INT8 inner product algorithm.
+
+        \param [in] context - a pointer to INT8 inner product context. It must be created by function ::SimdSynetInnerProduct8iInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor.
+        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetInnerProduct8iExternalBufferSize. Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to output tensor.
+    */
+    SIMD_API void SimdSynetInnerProduct8iForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetL2Normalize32f(const float * src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdBool acrossSpatial, const float * eps, float * dst);
+
+        \short Performs L2 normalization of input tensor (fused reduction and scaling).
+
+        Algorithm's details (example for NCHW tensor format and acrossSpatial = ::SimdFalse):
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            for(s = 0; s < spatial; ++s)
+            {
+                norm = 1 / Sqrt(Sum(Square(src[b, c, s])) + eps[0]);
+                for(c = 0; c < channels; ++c)
+                    dst[b, c, s] = src[b, c, s] * norm;
+            }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the 32-bit float array with input tensor. The size of the array is batch * channels * spatial.
+        \param [in] batch - a batch size.
+        \param [in] channels - a number of channels in the (input/output) tensor.
+        \param [in] spatial - a spatial size of (input/output) tensor.
+        \param [in] format - a format of (input/output) tensor. Only ::SimdTensorFormatNchw and ::SimdTensorFormatNhwc are supported.
+        \param [in] acrossSpatial - a flag of normalization across all channels and spatial positions of each batch item (otherwise each spatial position is normalized across channels only).
+        \param [in] eps - a pointer to epsilon parameter (it is added to the sum of squares).
+        \param [out] dst - a pointer to the 32-bit float array with output tensor. The size of the array is batch * channels * spatial. It can be equal to src.
+    */
+    SIMD_API void SimdSynetL2Normalize32f(const float * src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, 
+        SimdBool acrossSpatial, const float * eps, float * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetLayerNormalize32f(const float * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift, const float * eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float * params, float * dst);
+
+        \short This function is used for forward propagation of LayerNorm layer (normalization across channels).
+
+        Mean and variance are calculated over channels for every spatial point of every image in the batch (in one pass over the input tensor).
+
+        Algorithm's details (example for NHWC tensor format):
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            for(s = 0; s < spatial; ++s)
+            {
+                mean = Sum(src[b, s]) / channels;
+                norm = 1 / Sqrt(Sum(Square(src[b, s])) / channels - Square(mean) + eps[0]);
+                for(c = 0; c < channels; ++c)
+                    dst[b, s, c] = Activate((src[b, s, c] - mean) * norm * scale[c] + shift[c]);
+            }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the 32-bit float array with input image tensor. The size of the array is batch * channels * spatial.
+        \param [in] batch - a batch size.
+        \param [in] channels - a number of channels in the (input/output) image tensor.
+        \param [in] spatial - a spatial size of (input/output) image tensor.
+        \param [in] scale - a pointer to the 32-bit float array with scale coefficients. The size of the array is channels. Can be NULL (scale is equal to 1).
+        \param [in] shift - a pointer to the 32-bit float array with shift coefficients. The size of the array is channels. Can be NULL (shift is equal to 0).
+        \param [in] eps - a pointer to epsilon parameter (it is added to variance).
+        \param [in] format - a format of (input/output) image tensor. Only ::SimdTensorFormatNchw and ::SimdTensorFormatNhwc are supported.
+        \param [in] activation - an activation function type fused to the output.
+        \param [in] params - a pointer to parameters of activation function (see ::SimdConvolutionActivationType). For ::SimdConvolutionActivationPrelu the size of the array is channels.
+        \param [out] dst - a pointer to the 32-bit float array with output image tensor. The size of the array is batch * channels * spatial. It can be equal to src.
+    */
+    SIMD_API void SimdSynetLayerNormalize32f(const float * src, size_t batch, size_t channels, size_t spatial, const float * scale, const float * shift,
+        const float * eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float * params, float * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetLogSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst);
+
+        \short This function is used for forward propagation of LogSoftmaxLayer.
+
+        The result is computed in numerically stable form: dst = src - max - Log(Sum(Exp(src - max))), where max and sum are taken along softmax dimension.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to outer*count*inner.
+        \param [in] outer - an outer size of input and output arrays.
+        \param [in] count - a size of softmax dimmension.
+        \param [in] inner - an inner size of input and output arrays.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to outer*count*inner.
+    */
+    SIMD_API void SimdSynetLogSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t channels, size_t spatial, const float * k, float * dst, SimdTensorFormatType format);
+
+        \short This function is used for forward propagation of LrnLayer (cross channels normalization).
+
+        Algorithm's details (example for NCHW tensor format):
+        \verbatim
+        for(c = 0; c < channels; ++c)
+            for(s = 0; s < spatial; ++s)
+            {
+                lo = Max(0, c - half);
+                hi = Min(channels, c + half + 1);
+                sum = 0;
+                for(i = lo; i < ln; ++i)
+                    sum += Square(src[i*spatial + s]);
+                dst[c*spatial + s] = src[c*spatial + s]*Pow(k[0] + sum*k[1], k[2]);
+            }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the 32-bit float array with input image tensor. The size of the array is ::SimdAlign (channels, ::SimdSynetTensorAlignment (format)) * spatial.
+        \param [in] half - a local normalization half size.
+        \param [in] channels - a number of channels in the (input/output) image tensor
+        \param [in] spatial - a spatial size of (input/output) image tensor.
         \param [in] k - a pointer to the 32-bit float array with 3 coefficients (see algorithm details). 
         \param [out] dst - a pointer to the 32-bit float array with output image tensor. The size of the array is ::SimdAlign (channels, ::SimdSynetTensorAlignment (format)) * spatial.
         \param [in] format - a format of (input/output) image tensor.
@@ -7021,6 +7691,34 @@ extern "C"
     */
     SIMD_API void SimdSynetMish32f(const float* src, size_t size, const float* threshold, float* dst);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetPermute32f(const float * src, const size_t * shape, const size_t * order, size_t count, float * dst);
+
+        \short Permutes (transposes) axes of N-dimensional 32-bit float tensor (Permute/Transpose layer).
+
+        Algorithm's details (for 3-dimensional tensor):
+        \verbatim
+        dstShape[i] = shape[order[i]];
+        for(i0 = 0; i0 < dstShape[0]; ++i0)
+            for(i1 = 0; i1 < dstShape[1]; ++i1)
+                for(i2 = 0; i2 < dstShape[2]; ++i2)
+                    dst[i0][i1][i2] = src[j0][j1][j2], where j[order[k]] = i[k];
+        \endverbatim
+
+        Axes of unit size are skipped and axes which stay adjacent are merged, so the permutation is reduced 
+        either to copying of contiguous rows or to a set of cache-tiled 2D transpositions.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the 32-bit float array with input tensor.
+        \param [in] shape - a pointer to the array with shape of input tensor. The size of the array is count.
+        \param [in] order - a pointer to the array with order of axes in output tensor. The size of the array is count.
+        \param [in] count - a number of tensor dimensions.
+        \param [out] dst - a pointer to the 32-bit float array with output tensor.
+    */
+    SIMD_API void SimdSynetPermute32f(const float * src, const size_t * shape, const size_t * order, size_t count, float * dst);
+
     /*! @ingroup synet
 
         \fn void SimdSynetPoolingForwardAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
@@ -7048,6 +7746,67 @@ extern "C"
     SIMD_API void SimdSynetPoolingForwardAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
         size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetPoolingForwardAverageStrided(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, size_t dstStride, SimdBool excludePad, SimdTensorFormatType format);
+
+        \short This function is used for forward propagation of PoolingLayer (AveragePooling, 32-bit float) with output to a part of bigger tensor.
+
+        It is the same as ::SimdSynetPoolingForwardAverage, but the output is stored to channels [offset, offset + srcC) of output tensor which has dstStride channels
+        (see ::SimdSynetConvolution32fForwardStrided). Other channels of output tensor are not changed.
+
+        \note If dstStride is not equal to srcC, the pooling is calculated into a temporary buffer and then it is copied to output tensor.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to srcC*srcH*srcW.
+        \param [in] srcC - a number of input and output channels.
+        \param [in] srcH - an input height.
+        \param [in] srcW - an input width.
+        \param [in] kernelY - a height of the pooling kernel.
+        \param [in] kernelX - a width of the pooling kernel.
+        \param [in] strideY - a y-stride of the pooling.
+        \param [in] strideX - a x-stride of the pooling.
+        \param [in] padY - a pad to the top of the input image.
+        \param [in] padX - a pad to the left of the input image.
+        \param [out] dst - a pointer to the output 32-bit float array shifted to channel offset (dst + offset in NHWC format, dst + offset*dstH*dstW in NCHW format).
+        \param [in] dstH - an output height.
+        \param [in] dstW - an output width.
+        \param [in] dstStride - a number of channels of output tensor. It must be not less than srcC.
+        \param [in] excludePad - a flag of exclude pad from average value calculation.
+        \param [in] format - a format of (input/output) image tensor.
+    */
+    SIMD_API void SimdSynetPoolingForwardAverageStrided(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+        size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, size_t dstStride, SimdBool excludePad, SimdTensorFormatType format);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetPoolingForwardAverage8u(const uint8_t * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
+
+        \short This function is used for forward propagation of PoolingLayer (AveragePooling, 8-bit unsigned integer).
+
+        Output value is rounded to nearest integer: dst = (sum + area/2) / area, where area is a number of averaged elements 
+        (it is equal to kernelY*kernelX if excludePad is false). 
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 8-bit unsigned integer array. The size of the array must be equal to srcC*srcH*srcW.
+        \param [in] srcC - a number of input and output channels.
+        \param [in] srcH - an input height.
+        \param [in] srcW - an input width.
+        \param [in] kernelY - a height of the pooling kernel.
+        \param [in] kernelX - a width of the pooling kernel.
+        \param [in] strideY - a y-stride of the pooling.
+        \param [in] strideX - a x-stride of the pooling.
+        \param [in] padY - a pad to the top of the input image.
+        \param [in] padX - a pad to the left of the input image.
+        \param [out] dst - a pointer to the output 8-bit unsigned integer array. The size of the array must be equal to srcC*dstH*dstW.
+        \param [in] dstH - an output height.
+        \param [in] dstW - an output width.
+        \param [in] excludePad - a flag of exclude pad from average value calculation.
+        \param [in] format - a format of (input/output) image tensor.
+    */
+    SIMD_API void SimdSynetPoolingForwardAverage8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+        size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
+
     /*! @ingroup synet
 
         \fn void SimdSynetPoolingForwardMax32f(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
@@ -7074,6 +7833,36 @@ extern "C"
     SIMD_API void SimdSynetPoolingForwardMax32f(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, 
         size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetPoolingForwardMax32fStrided(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, size_t dstStride, SimdTensorFormatType format);
+
+        \short This function is used for forward propagation of PoolingLayer (MaxPooling, 32-bit float) with output to a part of bigger tensor.
+
+        It is the same as ::SimdSynetPoolingForwardMax32f, but the output is stored to channels [offset, offset + srcC) of output tensor which has dstStride channels
+        (see ::SimdSynetConvolution32fForwardStrided). Other channels of output tensor are not changed.
+
+        \note If dstStride is not equal to srcC, the pooling is calculated into a temporary buffer and then it is copied to output tensor.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to srcC*srcH*srcW.
+        \param [in] srcC - a number of input and output channels.
+        \param [in] srcH - an input height.
+        \param [in] srcW - an input width.
+        \param [in] kernelY - a height of the pooling kernel.
+        \param [in] kernelX - a width of the pooling kernel.
+        \param [in] strideY - a y-stride of the pooling.
+        \param [in] strideX - a x-stride of the pooling.
+        \param [in] padY - a pad to the top of the input image.
+        \param [in] padX - a pad to the left of the input image.
+        \param [out] dst - a pointer to the output 32-bit float array shifted to channel offset (dst + offset in NHWC format, dst + offset*dstH*dstW in NCHW format).
+        \param [in] dstH - an output height.
+        \param [in] dstW - an output width.
+        \param [in] dstStride - a number of channels of output tensor. It must be not less than srcC.
+        \param [in] format - a format of (input/output) image tensor.
+    */
+    SIMD_API void SimdSynetPoolingForwardMax32fStrided(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+        size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, size_t dstStride, SimdTensorFormatType format);
+
     /*! @ingroup synet
 
         \fn void SimdSynetPoolingForwardMax8u(const uint8_t * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t * dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
@@ -7125,6 +7914,88 @@ extern "C"
     */
     SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetRoiAlign32f(const float * src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float * rois, size_t number, size_t pooledH, size_t pooledW, const float * spatialScale, size_t samplingRatio, SimdBool aligned, float * dst);
+
+        \short Performs forward propagation of RoiAlign layer (used in two-stage detectors such as Faster R-CNN and Mask R-CNN).
+
+        Every region of interest is scaled by spatialScale and divided into pooledH x pooledW bins. 
+        A value of output bin is an average of samplingRatio x samplingRatio bilinear interpolated samples of input feature map placed regularly inside the bin.
+        Samples which lie outside of input feature map (more than one pixel away) are treated as zero.
+        Processing of regions of interest is distributed between threads (see ::SimdSetThreadNumber).
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the 32-bit float array with input feature maps. The size of the array is batch * channels * height * width.
+        \param [in] channels - a number of channels in the input feature map.
+        \param [in] height - a height of the input feature map.
+        \param [in] width - a width of the input feature map.
+        \param [in] format - a format of input and output tensors. It can be ::SimdTensorFormatNchw or ::SimdTensorFormatNhwc.
+        \param [in] rois - a pointer to the 32-bit float array with regions of interest (batch index, x1, y1, x2, y2). The size of the array is number * 5.
+        \param [in] number - a number of regions of interest.
+        \param [in] pooledH - a height of output feature map.
+        \param [in] pooledW - a width of output feature map.
+        \param [in] spatialScale - a pointer to scale factor of ROI coordinates (for example 1/16).
+        \param [in] samplingRatio - a number of sampling points in every bin along each axis. If it is 0 then adaptive number ceil(roiSize / pooledSize) is used.
+        \param [in] aligned - a flag of pixel shift by -0.5 of ROI coordinates (ROIAlign v2 of Detectron2). If it is ::SimdFalse then legacy behaviour (ROI size is at least 1) is used.
+        \param [out] dst - a pointer to the 32-bit float array with output feature maps. The size of the array is number * channels * pooledH * pooledW.
+    */
+    SIMD_API void SimdSynetRoiAlign32f(const float * src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float * rois, size_t number,
+        size_t pooledH, size_t pooledW, const float * spatialScale, size_t samplingRatio, SimdBool aligned, float * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetRoiPooling32f(const float * src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float * rois, size_t number, size_t pooledH, size_t pooledW, const float * spatialScale, float * dst);
+
+        \short Performs forward propagation of RoiPooling layer (Caffe Fast R-CNN compatible).
+
+        Every region of interest is scaled by spatialScale, rounded and divided into pooledH x pooledW bins. 
+        A value of output bin is a maximum of input feature map inside the bin (or 0 if the bin is empty).
+        Processing of regions of interest is distributed between threads (see ::SimdSetThreadNumber).
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the 32-bit float array with input feature maps. The size of the array is batch * channels * height * width.
+        \param [in] channels - a number of channels in the input feature map.
+        \param [in] height - a height of the input feature map.
+        \param [in] width - a width of the input feature map.
+        \param [in] format - a format of input and output tensors. It can be ::SimdTensorFormatNchw or ::SimdTensorFormatNhwc.
+        \param [in] rois - a pointer to the 32-bit float array with regions of interest (batch index, x1, y1, x2, y2). The size of the array is number * 5.
+        \param [in] number - a number of regions of interest.
+        \param [in] pooledH - a height of output feature map.
+        \param [in] pooledW - a width of output feature map.
+        \param [in] spatialScale - a pointer to scale factor of ROI coordinates (for example 1/16).
+        \param [out] dst - a pointer to the 32-bit float array with output feature maps. The size of the array is number * channels * pooledH * pooledW.
+    */
+    SIMD_API void SimdSynetRoiPooling32f(const float * src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float * rois, size_t number,
+        size_t pooledH, size_t pooledW, const float * spatialScale, float * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetReduceLayerForward(const float * src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdSynetReduceType type, SimdBool reduceChannels, SimdBool reduceSpatial, float * dst);
+
+        \short This function is used for forward propagation of ReduceLayer (ReduceL2, ReduceMax, ReduceMean, ReduceMin, ReduceSum).
+
+        The reduction is performed over channels, spatial dimensions or both of them for each batch item.
+        Shape of output tensor is: [batch, reduceChannels ? 1 : channels, reduceSpatial ? 1 : spatial] for NCHW format 
+        and [batch, reduceSpatial ? 1 : spatial, reduceChannels ? 1 : channels] for NHWC format.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the 32-bit float array with input tensor. The size of the array is batch * channels * spatial.
+        \param [in] batch - a batch size.
+        \param [in] channels - a number of channels in the input tensor.
+        \param [in] spatial - a spatial size of the input tensor.
+        \param [in] format - a format of (input/output) tensor. Only ::SimdTensorFormatNchw and ::SimdTensorFormatNhwc are supported.
+        \param [in] type - a reduction type (see ::SimdSynetReduceType).
+        \param [in] reduceChannels - a flag of reduction over channels.
+        \param [in] reduceSpatial - a flag of reduction over spatial dimensions.
+        \param [out] dst - a pointer to the 32-bit float array with output tensor.
+    */
+    SIMD_API void SimdSynetReduceLayerForward(const float * src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, 
+        SimdSynetReduceType type, SimdBool reduceChannels, SimdBool reduceSpatial, float * dst);
+
     /*! @ingroup synet_activation
 
         \fn void SimdSynetRelu32f(const float* src, size_t size, const float* slope, float* dst);
@@ -7164,6 +8035,27 @@ extern "C"
     */
     SIMD_API void SimdSynetReorderImage(size_t batch, size_t channels, size_t spatial, const float* src, SimdTensorFormatType srcFormat, float* dst, SimdTensorFormatType dstFormat);
 
+    /*! @ingroup synet_conversion
+
+        \fn void SimdSynetReorderImage8u(size_t batch, size_t channels, size_t spatial, const uint8_t * src, SimdTensorFormatType srcFormat, uint8_t * dst, SimdTensorFormatType dstFormat);
+
+        \short Converts 8-bit unsigned integer (input/output) image between different formats of 4D-tensor.
+
+        It is used to prepare input and read output of INT8 convolution (see ::SimdSynetConvolution8iInit) in ::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c 
+        or ::SimdTensorFormatNchw16c format. Padding channels of the output image in these formats are filled by zero.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>. Conversion between ::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c, ::SimdTensorFormatNchw16c is not supported.
+
+        \param [in] batch - a batch (number of images in the batch).
+        \param [in] channels - a number of image channels.
+        \param [in] spatial - a spatial size (height*width) of image.
+        \param [in] src - a pointer to input image data.
+        \param [in] srcFormat - a format of input image. It can be ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc, ::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c, ::SimdTensorFormatNchw16c.
+        \param [out] dst - a pointer to output image data.
+        \param [in] dstFormat - a format of output image. It can be ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc, ::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c, ::SimdTensorFormatNchw16c.
+    */
+    SIMD_API void SimdSynetReorderImage8u(size_t batch, size_t channels, size_t spatial, const uint8_t* src, SimdTensorFormatType srcFormat, uint8_t* dst, SimdTensorFormatType dstFormat);
+
     /*! @ingroup synet_conversion
 
         \fn void SimdSynetReorderFilter(size_t output, size_t input, size_t kernel, const float * src, SimdTensorFormatType srcFormat, float * dst, SimdTensorFormatType dstFormat);
@@ -7232,6 +8124,51 @@ extern "C"
     */
     SIMD_API void SimdSynetScaleLayerForward(const float * src, const float * scale, const float * bias, size_t channels, size_t height, size_t width, float * dst, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetScaledDotProductAttention32f(size_t batch, size_t queries, size_t keys, size_t depth, size_t valueDepth, const float * query, const float * key, const float * value, const float * scale, float * dst);
+
+        \short This function is used for forward propagation of scaled dot-product attention (transformer models).
+
+        Algorithm's details:
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            for(q = 0; q < queries; ++q)
+            {
+                for(k = 0; k < keys; ++k)
+                {
+                    score[k] = 0;
+                    for(d = 0; d < depth; ++d)
+                        score[k] += query[b][q][d]*key[b][k][d];
+                    score[k] *= scale;
+                }
+                score = Softmax(score);
+                for(d = 0; d < valueDepth; ++d)
+                {
+                    dst[b][q][d] = 0;
+                    for(k = 0; k < keys; ++k)
+                        dst[b][q][d] += score[k]*value[b][k][d];
+                }
+            }
+        \endverbatim
+
+        \note Keys are processed by blocks with using of online softmax, so the full matrix of scores is never stored.
+            If keys is equal to 0 then softmax is undefined and the function fills dst by zeros.
+
+        \param [in] batch - a batch size (a number of independent attention heads).
+        \param [in] queries - a number of queries.
+        \param [in] keys - a number of keys (and values).
+        \param [in] depth - a size of query and key vectors.
+        \param [in] valueDepth - a size of value vector.
+        \param [in] query - a pointer to the 32-bit float array with queries. The size of the array is batch*queries*depth.
+        \param [in] key - a pointer to the 32-bit float array with keys. The size of the array is batch*keys*depth.
+        \param [in] value - a pointer to the 32-bit float array with values. The size of the array is batch*keys*valueDepth.
+        \param [in] scale - a pointer to scale of dot products. Can be NULL (it is equal to 1/sqrt(depth) in this case).
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array is batch*queries*valueDepth.
+    */
+    SIMD_API void SimdSynetScaledDotProductAttention32f(size_t batch, size_t queries, size_t keys, size_t depth, size_t valueDepth, 
+        const float * query, const float * key, const float * value, const float * scale, float * dst);
+
     /*! @ingroup synet_scale
 
         \fn void * SimdSynetScale8iInit(size_t batch, size_t channels, size_t spatial, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
@@ -7357,6 +8294,27 @@ extern "C"
     */
     SIMD_API void SimdSynetSigmoid32f(const float* src, size_t size, const float* slope, float* dst);
 
+    /*! @ingroup synet
+
+        \fn void SimdSynetSoftmaxArgMaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst, uint32_t * index);
+
+        \short This function is used for forward propagation of SoftmaxLayer with fused ArgMax output (for segmentation networks).
+
+        It computes the same output as ::SimdSynetSoftmaxLayerForward and in the same pass finds index of maximal value along softmax dimension.
+        If several values are maximal then the smallest index is returned.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to outer*count*inner.
+        \param [in] outer - an outer size of input and output arrays.
+        \param [in] count - a size of softmax dimmension.
+        \param [in] inner - an inner size of input and output arrays.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to outer*count*inner. 
+            Can be NULL (then only indices are computed). It can be equal to src (in-place processing): indices are found from input values.
+        \param [out] index - a pointer to the output 32-bit unsigned integer array with indices of maximal values. The size of the array must be equal to outer*inner.
+    */
+    SIMD_API void SimdSynetSoftmaxArgMaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst, uint32_t * index);
+
     /*! @ingroup synet
 
         \fn void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst);
@@ -7988,6 +8946,62 @@ extern "C"
     */
     SIMD_API void SimdWinogradKernel3x3Block4x4SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
 
+    /*! @ingroup synet_winograd
+
+        \fn void SimdWinogradKernel3x3Block6x6SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
+
+        \short This function is used for filter conversion in Winograd F(6x6,3x3) convolution algorithm.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array with filter weights.
+        \param [in] size - (number of input channels)*(number of output channels).
+        \param [out] dst - a pointer to the output 32-bit float array with filter weights.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdWinogradKernel3x3Block6x6SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
+
+    /*! @ingroup synet_winograd
+
+        \fn void SimdWinogradKernel3x3Block6x6SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, size_t padY, size_t padX, size_t padH, size_t padW, float * dst, size_t dstStride, SimdBool trans);
+
+        \short This function is used for input image conversion in Winograd F(6x6,3x3) convolution algorithm.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input image.
+        \param [in] srcChannels - a number of input channels.
+        \param [in] srcHeight - a height of input image.
+        \param [in] srcWidth - a width of input image.
+        \param [in] padY - an additional zero padding of input image at the beginning of Y-axis.
+        \param [in] padX - an additional zero padding of input image at the beginning of X-axis.
+        \param [in] padH - an additional zero padding of input image at the end of Y-axis.
+        \param [in] padW - an additional zero padding of input image at the end of X-axis.
+        \param [out] dst - a pointer to the output array with converted image.
+        \param [in] dstStride - a stride of output image.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdWinogradKernel3x3Block6x6SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
+        size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
+
+    /*! @ingroup synet_winograd
+
+        \fn void SimdWinogradKernel3x3Block6x6SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
+
+        \short This function is used for output image conversion in Winograd F(6x6,3x3) convolution algorithm.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input image.
+        \param [in] srcStride - a stride of input image.
+        \param [out] dst - a pointer to the output image.
+        \param [in] dstChannels - a number of output channels.
+        \param [in] dstHeight - a height of output image.
+        \param [in] dstWidth - a width of output image.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdWinogradKernel3x3Block6x6SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
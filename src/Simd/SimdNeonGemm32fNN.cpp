@@ -2019,7 +2019,7 @@ namespace Simd
 
         typedef Simd::GemmNNcb<float, F, size_t> Gemm32fNNcb;
 
-        SIMD_INLINE Gemm32fNNcb CreateGemm32fNNcb(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility)
+        SIMD_INLINE Gemm32fNNcb CreateGemm32fNNcb(size_t M, size_t N, size_t K, GemmKernelType & type, bool compatibility)
         {
             Gemm32fNNcb::Main kernelMM, kernelMT;
             Gemm32fNNcb::Tail kernelTM, kernelTT;
@@ -2141,6 +2141,18 @@ namespace Simd
             Gemm32fNNcb gemm = CreateGemm32fNNcb(M, N, K, type, compatibility);
             gemm.Run(A, K, pB, C, N);
         }
+
+        void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, size_t lda, const float * pB, float * C, size_t ldc, const GemmPost<float> & post, GemmKernelType type, bool compatibility)
+        {
+            Gemm32fNNcb gemm = CreateGemm32fNNcb(M, N, K, type, compatibility);
+            gemm.Run(M, A, lda, pB, C, ldc, post);
+        }
+
+        GemmKernelType Gemm32fNNcbKernelType(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility)
+        {
+            CreateGemm32fNNcb(M, N, K, type, compatibility);
+            return type;
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
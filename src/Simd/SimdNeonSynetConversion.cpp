@@ -161,7 +161,9 @@ namespace Simd
         void SynetConvert32fTo8u(const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility)
         {
             int upper = Base::Narrowed(compatibility) ? Base::U8_NARROWED_MAX : Base::U8_PRECISE_MAX;
-            if (Base::FmaAvoid(compatibility))
+            if (format != SimdTensorFormatNchw && format != SimdTensorFormatNhwc)
+                Base::SynetConvert32fTo8u(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
+            else if (Base::FmaAvoid(compatibility))
                 SynetConvert32fTo8u<true>(src, batch, channels, height, width, format, scale, shift, upper, dst);
             else
                 SynetConvert32fTo8u<false>(src, batch, channels, height, width, format, scale, shift, upper, dst);
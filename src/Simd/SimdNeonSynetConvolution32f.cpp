@@ -654,25 +654,24 @@ namespace Simd
 
         bool SynetConvolution32fNhwcDirect::Preferable(const ConvParam32f& p)
         {
-            if (p.trans != SimdTrue || p.group != 1 || !p.IsDilation(1))
+            if (p.trans != SimdTrue)
+                return false;
+            if (p.group != 1 && (p.IsDepthwise() || p.dstC / p.group < F))
                 return false;
             if (!p.Is1x1() && p.dstW < 6 + p.padX + p.padY)
                 return false;
             if (p.Is1x1() && (p.srcC >= 2 * p.dstC || (p.activation == SimdConvolutionActivationIdentity && p.srcC > 128) || p.srcC > 256))
                 return false;
-            if (p.kernelY > p.srcH || p.kernelX > p.srcW)
+            if ((p.kernelY - 1) * p.dilationY + 1 > p.srcH || (p.kernelX - 1) * p.dilationX + 1 > p.srcW)
                 return false;
             return true;
         }
 
         //---------------------------------------------------------------------
 
-        void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
+        static SynetConvolution32f * SynetConvolution32fDenseInit(const ConvParam32f & param)
         {
-            ConvParam32f param(batch, conv, gemm);
-            if (!param.Valid())
-                return NULL;
-            else if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
+            if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
                 return new SynetConvolution32fDepthwiseDotProduct(param);
             else if (SynetConvolution32fWinograd::Preferable(param))
                 return new SynetConvolution32fWinograd(param);
@@ -687,6 +686,26 @@ namespace Simd
             else
                 return new SynetConvolution32fGemmNN(param);
         }
+
+        void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
+        {
+            ConvParam32f param(batch, conv, gemm);
+            if (!param.Valid())
+                return NULL;
+            else if (Base::SynetConvolution32fSparse::Preferable(param))
+                return new Base::SynetConvolution32fSparse(param, SynetConvolution32fDenseInit(param));
+            else
+                return SynetConvolution32fDenseInit(param);
+        }
+
+        void * SynetConvolution32fInitV2(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType)
+        {
+            ConvParam32f param(batch, conv, gemm);
+            if (param.Valid() && Base::SynetConvolution32fProd16::Preferable(param, weightType))
+                return new Base::SynetConvolution32fProd16(param, weightType);
+            else
+                return SynetConvolution32fInit(batch, conv, gemm);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -40,7 +40,7 @@ namespace Simd
         {
             float32x4_t d00, d01, s0, w0, w1;
             size_t srcH = p.srcH, srcW = p.srcW, dilY = p.dilationY, dilX = p.dilationX;
-            size_t dY = p.srcW * p.srcC, dX = p.srcC, dS = p.srcC * p.strideX, dW = p.srcC * F;
+            size_t dY = p.srcW * p.srcC, dX = p.srcC, dS = p.srcC * p.strideX, dW = a.srcC * F;
             size_t sy = dy * p.strideY - p.padY, sx = dx * p.strideX - p.padX;
             size_t kY = p.kernelY * p.dilationY, kX = p.kernelX * p.dilationX;
             const float* weight1 = weight0 + a.stepW;
@@ -109,7 +109,7 @@ namespace Simd
         {
             float32x4_t d00, d01, d10, d11, d20, d21, d30, d31, d40, d41, d50, d51, d60, d61, d70, d71, d80, d81, d90, d91, da0, da1, db0, db1, s0, w0, w1;
             size_t srcH = p.srcH, srcW = p.srcW, dilY = p.dilationY, dilX = p.dilationX;
-            size_t dY = p.srcW * p.srcC, dX = p.srcC, dS = p.srcC * p.strideX, dW = p.srcC * F, dWz = p.kernelX * p.srcC * F, dD = p.dstC;
+            size_t dY = p.srcW * p.srcC, dX = p.srcC, dS = p.srcC * p.strideX, dW = a.srcC * F, dWz = p.kernelX * a.srcC * F, dD = p.dstC;
             size_t sy = dy * p.strideY - p.padY, sx = dx * p.strideX - p.padX;
             size_t kY = p.kernelY * p.dilationY, kX = p.kernelX * p.dilationX;
             const float* weight1 = weight0 + a.stepW;
@@ -337,7 +337,7 @@ namespace Simd
         {
             float32x4_t d00, d01, d10, d11, d20, d21, d30, d31, d40, d41, d50, d51, s0, w0, w1;
             size_t srcH = p.srcH, srcW = p.srcW, dilY = p.dilationY, dilX = p.dilationX;
-            size_t dY = p.srcW * p.srcC, dX = p.srcC, dS = p.srcC * p.strideX, dW = p.srcC * F, dWz = p.kernelX * p.srcC * F, dD = p.dstC;
+            size_t dY = p.srcW * p.srcC, dX = p.srcC, dS = p.srcC * p.strideX, dW = a.srcC * F, dWz = p.kernelX * a.srcC * F, dD = p.dstC;
             size_t sy = dy * p.strideY - p.padY, sx = dx * p.strideX - p.padX;
             size_t kY = p.kernelY * p.dilationY, kX = p.kernelX * p.dilationX;
             const float* weight1 = weight0 + a.stepW;
@@ -540,7 +540,7 @@ namespace Simd
                     for (; dx < tailW; dx++, d += p.dstC)
                         convolutionNhwcDirect_2x1(src, p, a, dy, dx, srcC, dC, weight, _bias, _params, d, first);
                 }
-                weight += p.kernelY * p.kernelX * p.srcC * a.microD;
+                weight += p.kernelY * p.kernelX * a.srcC * a.microD;
             }
         }
 
@@ -907,7 +907,7 @@ namespace Simd
                     convolutionNhwcDirect1x1_2xN(ps, p, a, srcC, dC, weight, _bias, _params, pd, first);
                 for (; i < n1; i += m, ps += m * p.srcC, pd += m * p.dstC)
                     convolutionNhwcDirect1x1_2xM(ps, p, a, srcC, dC, weight, _bias, _params, pd, first);
-                weight += p.srcC * a.microD;
+                weight += a.srcC * a.microD;
             }
         }
 
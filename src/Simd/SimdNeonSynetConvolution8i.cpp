@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetConvolution8iCommon.h"
+#include "Simd/SimdSynetInnerProduct8i.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdBase.h"
@@ -673,11 +674,25 @@ namespace Simd
             ConvParam8i param(batch, conv, compatibility);
             if (!param.Valid())
                 return NULL;
+            else if (Base::SynetConvolution8iNchwcDepthwise::Preferable(param))
+                return new Base::SynetConvolution8iNchwcDepthwise(param);
+            else if (Base::SynetConvolution8iNchwcDirect::Preferable(param))
+                return new Base::SynetConvolution8iNchwcDirect(param);
             else if (SynetConvolution8iNhwcDirect::Preferable(param))
                 return new SynetConvolution8iNhwcDirect(param);
             else
                 return new Base::SynetConvolution8iGemmNN(param);
         }
+
+        //---------------------------------------------------------------------
+
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility)
+        {
+            InnerProductParam8i param(batch, input, output, transpose, srcT, dstT, activation, compatibility);
+            if (!param.Valid())
+                return NULL;
+            return new Simd::SynetInnerProduct8i(param, SynetConvolution8iInit);
+        }
     }
 #endif
 }
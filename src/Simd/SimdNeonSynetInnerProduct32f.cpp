@@ -216,16 +216,26 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
-        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation)
+        static SynetInnerProduct32f * SynetInnerProduct32fDenseInit(const InnerProductParam32f & param)
         {
-            InnerProductParam32f param(batch, input, output, transpose, activation);
-            if (!param.Valid())
-                return NULL;
+            if (param.weightType != SimdTensorData32f)
+                return new Base::SynetInnerProduct32fProd16(param);
             if (SynetInnerProduct32fProd::Preferable(param) && 0)
                 return new SynetInnerProduct32fProd(param);
             else
                 return new SynetInnerProduct32fGemm(param);
         }
+
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType)
+        {
+            InnerProductParam32f param(batch, input, output, transpose, activation, weightType);
+            if (!param.Valid())
+                return NULL;
+            else if (Base::SynetInnerProduct32fSparse::Preferable(param))
+                return new Base::SynetInnerProduct32fSparse(param, SynetInnerProduct32fDenseInit(param));
+            else
+                return SynetInnerProduct32fDenseInit(param);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
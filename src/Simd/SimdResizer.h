@@ -85,6 +85,22 @@ namespace Simd
 
     namespace Base
     {
+        SIMD_INLINE void BilinearIndexAlpha(float position, size_t size, ptrdiff_t & index, float & alpha)
+        {
+            index = (ptrdiff_t)::floor(position);
+            alpha = position - index;
+            if (index < 0)
+            {
+                index = 0;
+                alpha = 0;
+            }
+            if (index > (ptrdiff_t)size - 2)
+            {
+                index = size - 2;
+                alpha = 1;
+            }
+        }
+
         class ResizerByteBilinear : public Resizer
         {
         protected:
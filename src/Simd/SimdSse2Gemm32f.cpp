@@ -762,8 +762,79 @@ namespace Simd
             }
         }
 
+        //---------------------------------------------------------------------
+
+        template<size_t M, size_t V> SIMD_INLINE void GemmSmallKernel(size_t K, float alpha, const float * A, size_t lda, const float * B, size_t ldb, float beta, float * C, size_t ldc)
+        {
+            __m128 c[M][V], b[V];
+            for (size_t i = 0; i < M; ++i)
+                for (size_t v = 0; v < V; ++v)
+                    c[i][v] = _mm_setzero_ps();
+            for (size_t k = 0; k < K; ++k, B += ldb)
+            {
+                for (size_t v = 0; v < V; ++v)
+                    b[v] = _mm_loadu_ps(B + v * F);
+                for (size_t i = 0; i < M; ++i)
+                {
+                    __m128 a = _mm_set1_ps(A[i * lda + k]);
+                    for (size_t v = 0; v < V; ++v)
+                        c[i][v] = _mm_add_ps(_mm_mul_ps(a, b[v]), c[i][v]);
+                }
+            }
+            __m128 _alpha = _mm_set1_ps(alpha), _beta = _mm_set1_ps(beta);
+            for (size_t i = 0; i < M; ++i, C += ldc)
+            {
+                for (size_t v = 0; v < V; ++v)
+                {
+                    __m128 dst = _mm_mul_ps(_alpha, c[i][v]);
+                    if (beta != 0.0f)
+                        dst = _mm_add_ps(_mm_mul_ps(_beta, _mm_loadu_ps(C + v * F)), dst);
+                    _mm_storeu_ps(C + v * F, dst);
+                }
+            }
+        }
+
+        template<size_t M> void GemmSmallRows(size_t N, size_t K, float alpha, const float * A, size_t lda, const float * B, size_t ldb, float beta, float * C, size_t ldc)
+        {
+            size_t NDF = AlignLo(N, DF), NF = AlignLo(N, F), j = 0;
+            for (; j < NDF; j += DF)
+                GemmSmallKernel<M, 2>(K, alpha, A, lda, B + j, ldb, beta, C + j, ldc);
+            for (; j < NF; j += F)
+                GemmSmallKernel<M, 1>(K, alpha, A, lda, B + j, ldb, beta, C + j, ldc);
+            for (; j < N; ++j)
+            {
+                for (size_t i = 0; i < M; ++i)
+                {
+                    float sum = 0;
+                    for (size_t k = 0; k < K; ++k)
+                        sum += A[i * lda + k] * B[k * ldb + j];
+                    float & dst = C[i * ldc + j];
+                    dst = alpha * sum + (beta != 0.0f ? beta * dst : 0.0f);
+                }
+            }
+        }
+
+        void GemmSmallNN(size_t M, size_t N, size_t K, float alpha, const float * A, size_t lda, const float * B, size_t ldb, float beta, float * C, size_t ldc)
+        {
+            size_t M4 = AlignLoAny(M, 4), i = 0;
+            for (; i < M4; i += 4)
+                GemmSmallRows<4>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc);
+            switch (M - i)
+            {
+            case 1: GemmSmallRows<1>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc); break;
+            case 2: GemmSmallRows<2>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc); break;
+            case 3: GemmSmallRows<3>(N, K, alpha, A + i * lda, lda, B, ldb, beta, C + i * ldc, ldc); break;
+            }
+        }
+
         void Gemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
         {
+            if (GemmSmall(M, N, K))
+            {
+                GemmSmallNN(M, N, K, *alpha, A, lda, B, ldb, *beta, C, ldc);
+                return;
+            }
+
             typedef Simd::GemmNN<float, F, size_t> GemmNN;
             GemmNN::Main kernelMM, kernelMT;
             GemmNN::Tail kernelTM, kernelTT;
@@ -809,7 +880,7 @@ namespace Simd
 
         typedef Simd::GemmNNcb<float, F, size_t> Gemm32fNNcb;
 
-        SIMD_INLINE Gemm32fNNcb CreateGemm32fNNcb(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility)
+        SIMD_INLINE Gemm32fNNcb CreateGemm32fNNcb(size_t M, size_t N, size_t K, GemmKernelType & type, bool compatibility)
         {
             Gemm32fNNcb::Main kernelMM, kernelMT;
             Gemm32fNNcb::Tail kernelTM, kernelTT;
@@ -876,6 +947,18 @@ namespace Simd
             Gemm32fNNcb gemm = CreateGemm32fNNcb(M, N, K, type, compatibility);
             gemm.Run(A, K, pB, C, N);
         }
+
+        void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, size_t lda, const float * pB, float * C, size_t ldc, const GemmPost<float> & post, GemmKernelType type, bool compatibility)
+        {
+            Gemm32fNNcb gemm = CreateGemm32fNNcb(M, N, K, type, compatibility);
+            gemm.Run(M, A, lda, pB, C, ldc, post);
+        }
+
+        GemmKernelType Gemm32fNNcbKernelType(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility)
+        {
+            CreateGemm32fNNcb(M, N, K, type, compatibility);
+            return type;
+        }
     }
 #endif// SIMD_SSE2_ENABLE
 }
@@ -30,6 +30,7 @@
 #include "Simd/SimdBase.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdGather.h"
+#include "Simd/SimdCpu.h"
 
 namespace Simd
 {
@@ -661,70 +662,269 @@ namespace Simd
             }
         }
 
-        void SynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst)
+        SIMD_INLINE float SynetSoftmaxMax(const float* src, size_t size)
         {
-            if (count == 2 && inner == 1)
-                SynetSoftmaxLayerForward21(src, outer, dst);
-            else if(count == 3 && inner == 1)
-                SynetSoftmaxLayerForward31(src, outer, dst);
+            size_t sizeF = AlignLo(size, F), sizeQF = AlignLo(size, QF), i = 0;
+            __m128 max0 = _mm_set1_ps(-FLT_MAX), max1 = max0, max2 = max0, max3 = max0;
+            for (; i < sizeQF; i += QF)
+            {
+                max0 = _mm_max_ps(max0, _mm_loadu_ps(src + i + 0 * F));
+                max1 = _mm_max_ps(max1, _mm_loadu_ps(src + i + 1 * F));
+                max2 = _mm_max_ps(max2, _mm_loadu_ps(src + i + 2 * F));
+                max3 = _mm_max_ps(max3, _mm_loadu_ps(src + i + 3 * F));
+            }
+            for (; i < sizeF; i += F)
+                max0 = _mm_max_ps(max0, _mm_loadu_ps(src + i));
+            max0 = _mm_max_ps(_mm_max_ps(max0, max1), _mm_max_ps(max2, max3));
+            max0 = _mm_max_ps(max0, _mm_movehl_ps(max0, max0));
+            max0 = _mm_max_ss(max0, _mm_shuffle_ps(max0, max0, 1));
+            float max = _mm_cvtss_f32(max0);
+            for (; i < size; ++i)
+                max = Simd::Max(max, src[i]);
+            return max;
+        }
+
+        template<bool store> SIMD_INLINE float SynetSoftmaxExpSum(const Exp& exp, const float* src, size_t size, float max, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), sizeDF = AlignLo(size, DF), i = 0;
+            __m128 _max = _mm_set1_ps(max), sum0 = _mm_setzero_ps(), sum1 = _mm_setzero_ps();
+            for (; i < sizeDF; i += DF)
+            {
+                __m128 exp0 = exp.Exponent(_mm_sub_ps(_mm_loadu_ps(src + i + 0), _max));
+                __m128 exp1 = exp.Exponent(_mm_sub_ps(_mm_loadu_ps(src + i + F), _max));
+                if (store)
+                {
+                    _mm_storeu_ps(dst + i + 0, exp0);
+                    _mm_storeu_ps(dst + i + F, exp1);
+                }
+                sum0 = _mm_add_ps(sum0, exp0);
+                sum1 = _mm_add_ps(sum1, exp1);
+            }
+            for (; i < sizeF; i += F)
+            {
+                __m128 exp0 = exp.Exponent(_mm_sub_ps(_mm_loadu_ps(src + i), _max));
+                if (store)
+                    _mm_storeu_ps(dst + i, exp0);
+                sum0 = _mm_add_ps(sum0, exp0);
+            }
+            float sum = ExtractSum(_mm_add_ps(sum0, sum1));
+            for (; i < size; ++i)
+            {
+                float exp0 = ::exp(src[i] - max);
+                if (store)
+                    dst[i] = exp0;
+                sum += exp0;
+            }
+            return sum;
+        }
+
+        SIMD_INLINE uint32_t SynetSoftmaxArgMax(const float* src, size_t size)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m128 max = _mm_set1_ps(src[0]);
+            __m128i idx = _mm_setzero_si128(), cur = _mm_setr_epi32(0, 1, 2, 3), step = _mm_set1_epi32(F);
+            for (; i < sizeF; i += F, cur = _mm_add_epi32(cur, step))
+            {
+                __m128 _src = _mm_loadu_ps(src + i);
+                __m128i greater = _mm_castps_si128(_mm_cmpgt_ps(_src, max));
+                max = _mm_max_ps(_src, max);
+                idx = _mm_or_si128(_mm_and_si128(greater, cur), _mm_andnot_si128(greater, idx));
+            }
+            float maxs[F];
+            uint32_t idxs[F];
+            _mm_storeu_ps(maxs, max);
+            _mm_storeu_si128((__m128i*)idxs, idx);
+            float value = src[0];
+            uint32_t index = 0;
+            for (size_t j = 0; j < F; ++j)
+            {
+                if (maxs[j] > value || (maxs[j] == value && idxs[j] < index))
+                {
+                    value = maxs[j];
+                    index = idxs[j];
+                }
+            }
+            for (; i < size; ++i)
+            {
+                if (src[i] > value)
+                {
+                    value = src[i];
+                    index = uint32_t(i);
+                }
+            }
+            return index;
+        }
+
+        template<bool log> void SynetSoftmax1(const Exp& exp, const float* src, size_t count, float* dst, uint32_t* index)
+        {
+            size_t countF = AlignLo(count, F), c = 0;
+            float max = SynetSoftmaxMax(src, count);
+            if (index)
+                index[0] = SynetSoftmaxArgMax(src, count);
+            if (dst == NULL)
+                return;
+            if (log)
+            {
+                float sum = SynetSoftmaxExpSum<false>(exp, src, count, max, NULL);
+                float shift = max + ::log(sum);
+                __m128 _shift = _mm_set1_ps(shift);
+                for (c = 0; c < countF; c += F)
+                    _mm_storeu_ps(dst + c, _mm_sub_ps(_mm_loadu_ps(src + c), _shift));
+                for (; c < count; ++c)
+                    dst[c] = src[c] - shift;
+            }
             else
             {
-                Sse2::Exp exp;
-                size_t aligned = Simd::AlignLo(inner, F);
-                Array32f tmp(inner * 2);
-                const float * s;
-                float * max = tmp.data, *sum = tmp.data + inner, *d;
-                for (size_t o = 0; o < outer; ++o)
+                float sum = SynetSoftmaxExpSum<true>(exp, src, count, max, dst);
+                float scale = 1.0f / sum;
+                __m128 _scale = _mm_set1_ps(scale);
+                for (c = 0; c < countF; c += F)
+                    _mm_storeu_ps(dst + c, _mm_mul_ps(_mm_loadu_ps(dst + c), _scale));
+                for (; c < count; ++c)
+                    dst[c] *= scale;
+            }
+        }
+
+        template<bool log> void SynetSoftmaxN(const Exp& exp, const float* src, size_t count, size_t inner, size_t size, float* max, float* sum, float* idx, float* dst, uint32_t* index)
+        {
+            size_t sizeF = AlignLo(size, F), i;
+            const float* s = src + inner;
+            memcpy(max, src, size * sizeof(float));
+            if (index)
+            {
+                memset(idx, 0, size * sizeof(float));
+                for (size_t c = 1; c < count; ++c, s += inner)
                 {
-                    memcpy(max, src, inner * sizeof(float));
-                    s = src + inner;
-                    for (size_t c = 1; c < count; ++c)
+                    __m128 _c = _mm_set1_ps(float(c));
+                    for (i = 0; i < sizeF; i += F)
                     {
-                        size_t i = 0;
-                        for (; i < aligned; i += F)
-                            _mm_storeu_ps(max + i, _mm_max_ps(_mm_loadu_ps(s + i), _mm_loadu_ps(max + i)));
-                        for (; i < inner; ++i)
-                            max[i] = Simd::Max(max[i], s[i]);
-                        s += inner;
+                        __m128 _src = _mm_loadu_ps(s + i), _max = _mm_loadu_ps(max + i);
+                        __m128 greater = _mm_cmpgt_ps(_src, _max);
+                        _mm_storeu_ps(max + i, _mm_max_ps(_src, _max));
+                        _mm_storeu_ps(idx + i, _mm_or_ps(_mm_and_ps(greater, _c), _mm_andnot_ps(greater, _mm_loadu_ps(idx + i))));
                     }
-
-                    s = src;
-                    d = dst;
-                    memset(sum, 0, inner * sizeof(float));
-                    for (size_t c = 0; c < count; ++c)
+                    for (; i < size; ++i)
                     {
-                        size_t i = 0;
-                        for (; i < aligned; i += F)
+                        if (s[i] > max[i])
                         {
-                            __m128 _d = exp.Exponent(_mm_sub_ps(_mm_loadu_ps(s + i), _mm_loadu_ps(max + i)));
-                            _mm_storeu_ps(d + i, _d);
-                            _mm_storeu_ps(sum + i, _mm_add_ps(_d, _mm_loadu_ps(sum + i)));
+                            max[i] = s[i];
+                            idx[i] = float(c);
                         }
-                        for (; i < inner; ++i)
-                        {
-                            d[i] = ::exp(s[i] - max[i]);
-                            sum[i] += d[i];
-                        }
-                        s += inner;
-                        d += inner;
                     }
+                }
+                for (i = 0; i < sizeF; i += F)
+                    _mm_storeu_si128((__m128i*)(index + i), _mm_cvttps_epi32(_mm_loadu_ps(idx + i)));
+                for (; i < size; ++i)
+                    index[i] = uint32_t(idx[i]);
+            }
+            else
+            {
+                for (size_t c = 1; c < count; ++c, s += inner)
+                {
+                    for (i = 0; i < sizeF; i += F)
+                        _mm_storeu_ps(max + i, _mm_max_ps(_mm_loadu_ps(s + i), _mm_loadu_ps(max + i)));
+                    for (; i < size; ++i)
+                        max[i] = Simd::Max(max[i], s[i]);
+                }
+            }
+            if (dst == NULL)
+                return;
+            memset(sum, 0, size * sizeof(float));
+            s = src;
+            float* d = dst;
+            for (size_t c = 0; c < count; ++c, s += inner, d += inner)
+            {
+                for (i = 0; i < sizeF; i += F)
+                {
+                    __m128 _exp = exp.Exponent(_mm_sub_ps(_mm_loadu_ps(s + i), _mm_loadu_ps(max + i)));
+                    if (!log)
+                        _mm_storeu_ps(d + i, _exp);
+                    _mm_storeu_ps(sum + i, _mm_add_ps(_exp, _mm_loadu_ps(sum + i)));
+                }
+                for (; i < size; ++i)
+                {
+                    float _exp = ::exp(s[i] - max[i]);
+                    if (!log)
+                        d[i] = _exp;
+                    sum[i] += _exp;
+                }
+            }
+            if (log)
+            {
+                for (i = 0; i < size; ++i)
+                    sum[i] = max[i] + ::log(sum[i]);
+                s = src;
+                d = dst;
+                for (size_t c = 0; c < count; ++c, s += inner, d += inner)
+                {
+                    for (i = 0; i < sizeF; i += F)
+                        _mm_storeu_ps(d + i, _mm_sub_ps(_mm_loadu_ps(s + i), _mm_loadu_ps(sum + i)));
+                    for (; i < size; ++i)
+                        d[i] = s[i] - sum[i];
+                }
+            }
+            else
+            {
+                for (i = 0; i < sizeF; i += F)
+                    _mm_storeu_ps(sum + i, _mm_div_ps(_mm_set1_ps(1.0f), _mm_loadu_ps(sum + i)));
+                for (; i < size; ++i)
+                    sum[i] = 1.0f / sum[i];
+                d = dst;
+                for (size_t c = 0; c < count; ++c, d += inner)
+                {
+                    for (i = 0; i < sizeF; i += F)
+                        _mm_storeu_ps(d + i, _mm_mul_ps(_mm_loadu_ps(d + i), _mm_loadu_ps(sum + i)));
+                    for (; i < size; ++i)
+                        d[i] *= sum[i];
+                }
+            }
+        }
 
-                    d = dst;
-                    for (size_t c = 0; c < count; ++c)
+        template<bool log> void SynetSoftmax(const float* src, size_t outer, size_t count, size_t inner, float* dst, uint32_t* index)
+        {
+            Exp exp;
+            if (inner == 1)
+            {
+                for (size_t o = 0; o < outer; ++o)
+                    SynetSoftmax1<log>(exp, src + o * count, count, dst ? dst + o * count : NULL, index ? index + o : NULL);
+            }
+            else
+            {
+                size_t block = Simd::RestrictRange(AlignLo(Base::AlgCacheL2() / 2 / count / sizeof(float), F), F, AlignHi(inner, F));
+                Array32f buf(block * 3);
+                for (size_t o = 0; o < outer; ++o)
+                {
+                    size_t offset = o * count * inner;
+                    for (size_t i = 0; i < inner; i += block)
                     {
-                        size_t i = 0;
-                        for (; i < aligned; i += F)
-                            _mm_storeu_ps(d + i, _mm_div_ps(_mm_loadu_ps(d + i), _mm_loadu_ps(sum + i)));
-                        for (; i < inner; ++i)
-                            d[i] /= sum[i];
-                        d += inner;
+                        size_t size = Simd::Min(block, inner - i);
+                        SynetSoftmaxN<log>(exp, src + offset + i, count, inner, size, buf.data, buf.data + block, buf.data + 2 * block,
+                            dst ? dst + offset + i : NULL, index ? index + o * inner + i : NULL);
                     }
-                    src += count * inner;
-                    dst += count * inner;
                 }
             }
         }
 
+        void SynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst)
+        {
+            if (count == 2 && inner == 1)
+                SynetSoftmaxLayerForward21(src, outer, dst);
+            else if(count == 3 && inner == 1)
+                SynetSoftmaxLayerForward31(src, outer, dst);
+            else
+                SynetSoftmax<false>(src, outer, count, inner, dst, NULL);
+        }
+
+        void SynetLogSoftmaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst)
+        {
+            SynetSoftmax<true>(src, outer, count, inner, dst, NULL);
+        }
+
+        void SynetSoftmaxArgMaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst, uint32_t* index)
+        {
+            SynetSoftmax<false>(src, outer, count, inner, dst, index);
+        }
+
         //---------------------------------------------------------------------
 
         template<SimdSynetUnaryOperation32fType type> __m128 SynetUnaryOperation32f(__m128 value);
@@ -168,7 +168,7 @@ namespace Simd
                 }
             }
             else
-                assert(0);
+                Base::SynetConvert32fTo8u(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
         }
 
         //---------------------------------------------------------------------
@@ -670,6 +670,38 @@ namespace Simd
             else
                 Base::SynetReorderFilter(output, input, kernel, src, srcFormat, dst, dstFormat);
         }
+
+        //---------------------------------------------------------------------
+
+        static void SynetPermuteTranspose(const float* src, size_t srcStride, size_t rows, size_t cols, float* dst, size_t dstStride)
+        {
+            for (size_t r0 = 0; r0 < rows; r0 += Base::SYNET_PERMUTE_TILE)
+            {
+                size_t r1 = Simd::Min(r0 + Base::SYNET_PERMUTE_TILE, rows), r1F = r0 + AlignLo(r1 - r0, F);
+                for (size_t c0 = 0; c0 < cols; c0 += Base::SYNET_PERMUTE_TILE)
+                {
+                    size_t c1 = Simd::Min(c0 + Base::SYNET_PERMUTE_TILE, cols), c1F = c0 + AlignLo(c1 - c0, F);
+                    size_t r = r0;
+                    for (; r < r1F; r += F)
+                    {
+                        size_t c = c0;
+                        for (; c < c1F; c += F)
+                            Transpose4x4<false>(src + c * srcStride + r, srcStride, dst + r * dstStride + c, dstStride);
+                        for (; c < c1; ++c)
+                            for (size_t i = 0; i < F; ++i)
+                                dst[(r + i) * dstStride + c] = src[c * srcStride + r + i];
+                    }
+                    for (; r < r1; ++r)
+                        for (size_t c = c0; c < c1; ++c)
+                            dst[r * dstStride + c] = src[c * srcStride + r];
+                }
+            }
+        }
+
+        void SynetPermute32f(const float* src, const size_t* shape, const size_t* order, size_t count, float* dst)
+        {
+            Base::SynetPermute32f(src, shape, order, count, dst, SynetPermuteTranspose);
+        }
     }
 #endif// SIMD_SSE2_ENABLE
 }
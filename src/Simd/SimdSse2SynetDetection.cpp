@@ -0,0 +1,181 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdSynetDetection.h"
+#include "Simd/SimdSse2.h"
+
+namespace Simd
+{
+#if defined(SIMD_SSE2_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Sse2
+    {
+        static size_t DetectionSelect(const float* scores, size_t count, float threshold, int32_t* index, float* score)
+        {
+            size_t countF = AlignLo(count, F), size = 0, i = 0;
+            __m128 _threshold = _mm_set1_ps(threshold);
+            for (; i < countF; i += F)
+            {
+                int mask = _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(scores + i), _threshold));
+                for (size_t j = i; mask; mask >>= 1, ++j)
+                {
+                    if (mask & 1)
+                    {
+                        index[size] = (int32_t)j;
+                        score[size] = scores[j];
+                        size++;
+                    }
+                }
+            }
+            for (; i < count; ++i)
+            {
+                if (scores[i] > threshold)
+                {
+                    index[size] = (int32_t)i;
+                    score[size] = scores[i];
+                    size++;
+                }
+            }
+            return size;
+        }
+
+        static bool DetectionOverlaps(const float* kept, size_t size, size_t stride, const float* box, float threshold)
+        {
+            const float* x1 = kept + 0 * stride, * y1 = kept + 1 * stride, * x2 = kept + 2 * stride, * y2 = kept + 3 * stride, * area = kept + 4 * stride;
+            __m128 boxX1 = _mm_set1_ps(box[0]), boxY1 = _mm_set1_ps(box[1]), boxX2 = _mm_set1_ps(box[2]), boxY2 = _mm_set1_ps(box[3]);
+            __m128 boxArea = _mm_set1_ps(Base::DetectionArea(box)), _threshold = _mm_set1_ps(threshold), _0 = _mm_setzero_ps();
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+            {
+                __m128 w = _mm_max_ps(_mm_sub_ps(_mm_min_ps(boxX2, _mm_loadu_ps(x2 + i)), _mm_max_ps(boxX1, _mm_loadu_ps(x1 + i))), _0);
+                __m128 h = _mm_max_ps(_mm_sub_ps(_mm_min_ps(boxY2, _mm_loadu_ps(y2 + i)), _mm_max_ps(boxY1, _mm_loadu_ps(y1 + i))), _0);
+                __m128 intersection = _mm_mul_ps(w, h);
+                __m128 union_ = _mm_sub_ps(_mm_add_ps(boxArea, _mm_loadu_ps(area + i)), intersection);
+                if (_mm_movemask_ps(_mm_cmpgt_ps(intersection, _mm_mul_ps(_threshold, union_))))
+                    return true;
+            }
+            return Base::DetectionOverlaps(kept, i, size, stride, box, threshold);
+        }
+
+        size_t SynetDetectionOutput32f(const float* boxes, const float* scores, size_t count, size_t classes, size_t background,
+            const float* confidence, const float* overlap, size_t topK, size_t keepTopK, float* dst)
+        {
+            return Base::SynetDetectionOutput32f(boxes, scores, count, classes, background, *confidence, *overlap, topK, keepTopK, DetectionSelect, DetectionOverlaps, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void DecodeSsd(const float* loc, const float* prior, const float* variance, const __m128& half, float* dst)
+        {
+            __m128 _prior = _mm_loadu_ps(prior);
+            __m128 lo = _mm_shuffle_ps(_prior, _prior, 0x44);
+            __m128 hi = _mm_shuffle_ps(_prior, _prior, 0xEE);
+            __m128 size = _mm_sub_ps(hi, lo);
+            __m128 center = _mm_mul_ps(_mm_add_ps(lo, hi), _mm_set1_ps(0.5f));
+            __m128 _loc = _mm_mul_ps(_mm_loadu_ps(variance), _mm_loadu_ps(loc));
+            center = _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(_loc, _loc, 0x44), size), center);
+            size = _mm_mul_ps(_mm_mul_ps(Exponent(_mm_shuffle_ps(_loc, _loc, 0xEE)), size), half);
+            _mm_storeu_ps(dst, _mm_add_ps(center, size));
+        }
+
+        void SynetDecodeSsd32f(const float* loc, const float* prior, const float* variance, size_t count, float* dst)
+        {
+            __m128 half = _mm_setr_ps(-0.5f, -0.5f, 0.5f, 0.5f);
+            for (size_t i = 0; i < count; ++i, loc += 4, prior += 4, variance += 4, dst += 4)
+                DecodeSsd(loc, prior, variance, half, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m128 Sigmoid(__m128 value)
+        {
+            __m128 _1 = _mm_set1_ps(1.0f);
+            return _mm_div_ps(_1, _mm_add_ps(_1, Exponent(_mm_sub_ps(_mm_setzero_ps(), value))));
+        }
+
+        SIMD_INLINE void StoreBoxes(float* dst, __m128 x1, __m128 y1, __m128 x2, __m128 y2)
+        {
+            __m128 lo1 = _mm_unpacklo_ps(x1, y1), lo2 = _mm_unpacklo_ps(x2, y2);
+            __m128 hi1 = _mm_unpackhi_ps(x1, y1), hi2 = _mm_unpackhi_ps(x2, y2);
+            _mm_storeu_ps(dst + 0 * 4, _mm_movelh_ps(lo1, lo2));
+            _mm_storeu_ps(dst + 1 * 4, _mm_movehl_ps(lo2, lo1));
+            _mm_storeu_ps(dst + 2 * 4, _mm_movelh_ps(hi1, hi2));
+            _mm_storeu_ps(dst + 3 * 4, _mm_movehl_ps(hi2, hi1));
+        }
+
+        void SynetDecodeYolo32f(const float* src, size_t anchors, size_t classes, size_t height, size_t width, const float* sizes, float* boxes, float* scores)
+        {
+            size_t spatial = height * width, count = anchors * spatial, widthF = AlignLo(width, F), spatialF = AlignLo(spatial, F);
+            __m128 _width = _mm_set1_ps(float(width)), _height = _mm_set1_ps(float(height)), _offset = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+            Array32f buf(spatial);
+            for (size_t a = 0; a < anchors; ++a)
+            {
+                const float* x = src + 0 * spatial, * y = src + 1 * spatial, * w = src + 2 * spatial, * h = src + 3 * spatial, * obj = src + 4 * spatial;
+                float anchorW = sizes[2 * a + 0] * 0.5f, anchorH = sizes[2 * a + 1] * 0.5f;
+                __m128 _anchorW = _mm_set1_ps(anchorW), _anchorH = _mm_set1_ps(anchorH);
+                for (size_t row = 0, s = 0; row < height; ++row)
+                {
+                    __m128 _row = _mm_set1_ps(float(row));
+                    size_t col = 0;
+                    for (; col < widthF; col += F, s += F, boxes += 4 * F)
+                    {
+                        __m128 centerX = _mm_div_ps(_mm_add_ps(_mm_add_ps(_mm_set1_ps(float(col)), _offset), Sigmoid(_mm_loadu_ps(x + s))), _width);
+                        __m128 centerY = _mm_div_ps(_mm_add_ps(_row, Sigmoid(_mm_loadu_ps(y + s))), _height);
+                        __m128 halfW = _mm_mul_ps(Exponent(_mm_loadu_ps(w + s)), _anchorW);
+                        __m128 halfH = _mm_mul_ps(Exponent(_mm_loadu_ps(h + s)), _anchorH);
+                        StoreBoxes(boxes, _mm_sub_ps(centerX, halfW), _mm_sub_ps(centerY, halfH), _mm_add_ps(centerX, halfW), _mm_add_ps(centerY, halfH));
+                    }
+                    for (; col < width; ++col, ++s, boxes += 4)
+                    {
+                        float centerX = (float(col) + Base::SynetSigmoid32f(x[s], 1.0f)) / float(width);
+                        float centerY = (float(row) + Base::SynetSigmoid32f(y[s], 1.0f)) / float(height);
+                        float halfW = ::exp(w[s]) * anchorW;
+                        float halfH = ::exp(h[s]) * anchorH;
+                        boxes[0] = centerX - halfW;
+                        boxes[1] = centerY - halfH;
+                        boxes[2] = centerX + halfW;
+                        boxes[3] = centerY + halfH;
+                    }
+                }
+                size_t s = 0;
+                for (; s < spatialF; s += F)
+                    _mm_storeu_ps(buf.data + s, Sigmoid(_mm_loadu_ps(obj + s)));
+                for (; s < spatial; ++s)
+                    buf[s] = Base::SynetSigmoid32f(obj[s], 1.0f);
+                for (size_t c = 0; c < classes; ++c)
+                {
+                    const float* cls = src + (5 + c) * spatial;
+                    float* dst = scores + c * count + a * spatial;
+                    for (s = 0; s < spatialF; s += F)
+                        _mm_storeu_ps(dst + s, _mm_mul_ps(_mm_loadu_ps(buf.data + s), Sigmoid(_mm_loadu_ps(cls + s))));
+                    for (; s < spatial; ++s)
+                        dst[s] = buf[s] * Base::SynetSigmoid32f(cls[s], 1.0f);
+                }
+                src += (5 + classes) * spatial;
+            }
+        }
+    }
+#endif
+}
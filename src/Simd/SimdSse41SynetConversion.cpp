@@ -25,6 +25,7 @@
 #include "Simd/SimdStore.h"
 #include "Simd/SimdConversion.h"
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -126,7 +127,7 @@ namespace Simd
                     SynetConvert8uTo32fNhwc(src, spatial, channels, scale, shift, dst);
             }
             else
-                assert(0);
+                Base::SynetConvert8uTo32f(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
         }
 
         //---------------------------------------------------------------------
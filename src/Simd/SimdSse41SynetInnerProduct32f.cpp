@@ -217,16 +217,35 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
-        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation)
+        SynetInnerProduct32fSparse::SynetInnerProduct32fSparse(const InnerProductParam32f & p, SynetInnerProduct32f * dense)
+            : Base::SynetInnerProduct32fSparse(p, dense)
         {
-            InnerProductParam32f param(batch, input, output, transpose, activation);
-            if (!param.Valid())
-                return NULL;
+            _gemm = Sse2::SparseGemm32fNS;
+            _biasAndActivation = Sse2::ConvolutionBiasAndActivation;
+        }
+
+        //---------------------------------------------------------------------
+
+        static SynetInnerProduct32f * SynetInnerProduct32fDenseInit(const InnerProductParam32f & param)
+        {
+            if (param.weightType != SimdTensorData32f)
+                return new Base::SynetInnerProduct32fProd16(param);
             if (SynetInnerProduct32fProd::Preferable(param))
                 return new SynetInnerProduct32fProd(param);
             else
                 return new SynetInnerProduct32fGemm(param);
         }
+
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType)
+        {
+            InnerProductParam32f param(batch, input, output, transpose, activation, weightType);
+            if (!param.Valid())
+                return NULL;
+            else if (SynetInnerProduct32fSparse::Preferable(param))
+                return new SynetInnerProduct32fSparse(param, SynetInnerProduct32fDenseInit(param));
+            else
+                return SynetInnerProduct32fDenseInit(param);
+        }
     }
 #endif// SIMD_SSE41_ENABLE
 }
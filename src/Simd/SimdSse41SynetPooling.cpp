@@ -34,6 +34,128 @@ namespace Simd
 #if defined(SIMD_SSE41_ENABLE) && defined(SIMD_SYNET_ENABLE)     
     namespace Sse41
     {
+        SIMD_INLINE __m128i PoolingAverageRound(__m128i sum, const __m128& half, const __m128& area)
+        {
+            return _mm_cvttps_epi32(_mm_div_ps(_mm_add_ps(_mm_cvtepi32_ps(sum), half), area));
+        }
+
+        SIMD_INLINE void PoolingAverageStore(const __m128i& sum0, const __m128i& sum1, const __m128i& sum2, const __m128i& sum3,
+            const __m128& half, const __m128& area, uint8_t* dst)
+        {
+            __m128i d0 = _mm_packs_epi32(PoolingAverageRound(sum0, half, area), PoolingAverageRound(sum1, half, area));
+            __m128i d1 = _mm_packs_epi32(PoolingAverageRound(sum2, half, area), PoolingAverageRound(sum3, half, area));
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(d0, d1));
+        }
+
+        SIMD_INLINE void PoolingAverageNhwc1(const uint8_t* src, size_t srcS, size_t srcC, size_t kH, size_t kW, const __m128& half, const __m128& area, uint8_t* dst)
+        {
+            __m128i sum0 = _mm_setzero_si128();
+            __m128i sum1 = _mm_setzero_si128();
+            for (size_t h = 0; h < kH; ++h)
+            {
+                for (size_t w = 0; w < kW; ++w)
+                {
+                    __m128i s0 = _mm_loadu_si128((__m128i*)(src + w * srcC));
+                    sum0 = _mm_add_epi16(sum0, _mm_unpacklo_epi8(s0, K_ZERO));
+                    sum1 = _mm_add_epi16(sum1, _mm_unpackhi_epi8(s0, K_ZERO));
+                }
+                src += srcS;
+            }
+            PoolingAverageStore(_mm_unpacklo_epi16(sum0, K_ZERO), _mm_unpackhi_epi16(sum0, K_ZERO), 
+                _mm_unpacklo_epi16(sum1, K_ZERO), _mm_unpackhi_epi16(sum1, K_ZERO), half, area, dst);
+        }
+
+        SIMD_INLINE void PoolingAverageGlobalNhwc1(const uint8_t* src, size_t size, size_t srcC, const __m128& half, const __m128& area, uint8_t* dst)
+        {
+            __m128i sum0 = _mm_setzero_si128();
+            __m128i sum1 = _mm_setzero_si128();
+            __m128i sum2 = _mm_setzero_si128();
+            __m128i sum3 = _mm_setzero_si128();
+            for (size_t i = 0; i < size;)
+            {
+                size_t n = Simd::Min(i + Base::POOLING_AVERAGE_16U_MAX, size);
+                __m128i lo = _mm_setzero_si128();
+                __m128i hi = _mm_setzero_si128();
+                for (; i < n; ++i, src += srcC)
+                {
+                    __m128i s0 = _mm_loadu_si128((__m128i*)src);
+                    lo = _mm_add_epi16(lo, _mm_unpacklo_epi8(s0, K_ZERO));
+                    hi = _mm_add_epi16(hi, _mm_unpackhi_epi8(s0, K_ZERO));
+                }
+                sum0 = _mm_add_epi32(sum0, _mm_unpacklo_epi16(lo, K_ZERO));
+                sum1 = _mm_add_epi32(sum1, _mm_unpackhi_epi16(lo, K_ZERO));
+                sum2 = _mm_add_epi32(sum2, _mm_unpacklo_epi16(hi, K_ZERO));
+                sum3 = _mm_add_epi32(sum3, _mm_unpackhi_epi16(hi, K_ZERO));
+            }
+            PoolingAverageStore(sum0, sum1, sum2, sum3, half, area, dst);
+        }
+
+        SIMD_INLINE uint8_t PoolingAverageGlobalNchw(const uint8_t* src, size_t size)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            __m128i sum = _mm_setzero_si128();
+            for (; i < sizeA; i += A)
+                sum = _mm_add_epi64(sum, _mm_sad_epu8(_mm_loadu_si128((__m128i*)(src + i)), K_ZERO));
+            size_t total = (size_t)ExtractInt64Sum(sum);
+            for (; i < size; ++i)
+                total += src[i];
+            return uint8_t((total + size / 2) / size);
+        }
+
+        void SynetPoolingForwardAverage8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+            size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format)
+        {
+            if (Base::IsGlobalPooling(srcH, srcW, kernelY, kernelX, padY, padX))
+            {
+                size_t size = srcH * srcW;
+                if (format == SimdTensorFormatNhwc && srcC >= A && size <= Base::POOLING_AVERAGE_32F_MAX)
+                {
+                    __m128 half = _mm_set1_ps(float(size / 2)), area = _mm_set1_ps(float(size));
+                    size_t srcCA = AlignLo(srcC, A);
+                    for (size_t c = 0; c < srcCA; c += A)
+                        PoolingAverageGlobalNhwc1(src + c, size, srcC, half, area, dst + c);
+                    if (srcCA < srcC)
+                        PoolingAverageGlobalNhwc1(src + srcC - A, size, srcC, half, area, dst + srcC - A);
+                    return;
+                }
+                if (format == SimdTensorFormatNchw)
+                {
+                    for (size_t c = 0; c < srcC; ++c)
+                        dst[c] = PoolingAverageGlobalNchw(src + c * size, size);
+                    return;
+                }
+            }
+            if (format == SimdTensorFormatNhwc && srcC >= A && kernelY * kernelX <= Base::POOLING_AVERAGE_16U_MAX)
+            {
+                size_t srcS = srcW * srcC;
+                size_t srcCA = AlignLo(srcC, A);
+                for (size_t ph = 0; ph < dstH; ++ph)
+                {
+                    size_t hStart = ph * strideY - padY;
+                    size_t hEnd = Simd::Min(hStart + kernelY, srcH);
+                    hStart = Simd::Max<ptrdiff_t>(0, hStart);
+                    for (size_t pw = 0; pw < dstW; ++pw)
+                    {
+                        size_t wStart = pw * strideX - padX;
+                        size_t wEnd = Simd::Min(wStart + kernelX, srcW);
+                        wStart = Simd::Max<ptrdiff_t>(0, wStart);
+                        size_t kH = hEnd - hStart, kW = wEnd - wStart, size = excludePad ? kH * kW : kernelY * kernelX;
+                        __m128 half = _mm_set1_ps(float(size / 2)), area = _mm_set1_ps(float(size));
+                        const uint8_t* ps = src + hStart * srcS + wStart * srcC;
+                        for (size_t c = 0; c < srcCA; c += A)
+                            PoolingAverageNhwc1(ps + c, srcS, srcC, kH, kW, half, area, dst + c);
+                        if (srcCA < srcC)
+                            PoolingAverageNhwc1(ps + srcC - A, srcS, srcC, kH, kW, half, area, dst + srcC - A);
+                        dst += srcC;
+                    }
+                }
+            }
+            else
+                Base::SynetPoolingForwardAverage8u(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, excludePad, format);
+        }
+
+        //---------------------------------------------------------------------
+
         SIMD_INLINE void PoolingMaxNhwc1(const uint8_t * src, size_t srcS, size_t srcC, size_t kH, size_t kW, const __m128i & min, uint8_t* dst)
         {
             __m128i max0 = min;
@@ -25,6 +25,7 @@
 #define __SimdSynet_h__
 
 #include "Simd/SimdMath.h"
+#include "Simd/SimdPow.h"
 
 namespace Simd
 {
@@ -52,6 +53,25 @@ namespace Simd
             return (format == SimdTensorFormatNhwc && channels != 1) || (format == SimdTensorFormatNchw && spatial == 1);
         }
 
+        //---------------------------------------------------------------------
+
+        const size_t POOLING_AVERAGE_16U_MAX = 256; // max number of 8-bit values which sum is fitted into 16-bit
+        const size_t POOLING_AVERAGE_32F_MAX = 65535; // max pooling area for which rounding of average with FP32 division is exact
+
+        SIMD_INLINE bool IsGlobalPooling(size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t padY, size_t padX)
+        {
+            return kernelY == srcH && kernelX == srcW && padY == 0 && padX == 0;
+        }
+
+        //---------------------------------------------------------------------
+
+        const size_t ATTENTION_KEY_BLOCK = 256; // number of keys processed by one step of online softmax
+
+        SIMD_INLINE float AttentionScale(size_t depth, const float* scale)
+        {
+            return scale ? scale[0] : 1.0f / ::sqrt(float(depth));
+        }
+
 #if defined(SIMD_INT8_DEBUG_ENABLE)
         SIMD_INLINE bool FmaAvoid(SimdSynetCompatibilityType compatibility)
         {
@@ -246,6 +266,50 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        template<SimdSynetBinaryOperation32fType type> float SynetBinaryOperation32f(float a, float b);
+
+        template<> SIMD_INLINE float SynetBinaryOperation32f<SimdSynetBinaryOperation32fAdd>(float a, float b)
+        {
+            return a + b;
+        }
+
+        template<> SIMD_INLINE float SynetBinaryOperation32f<SimdSynetBinaryOperation32fDiv>(float a, float b)
+        {
+            return a / b;
+        }
+
+        template<> SIMD_INLINE float SynetBinaryOperation32f<SimdSynetBinaryOperation32fMax>(float a, float b)
+        {
+            return Simd::Max(a, b);
+        }
+
+        template<> SIMD_INLINE float SynetBinaryOperation32f<SimdSynetBinaryOperation32fMin>(float a, float b)
+        {
+            return Simd::Min(a, b);
+        }
+
+        template<> SIMD_INLINE float SynetBinaryOperation32f<SimdSynetBinaryOperation32fMul>(float a, float b)
+        {
+            return a * b;
+        }
+
+        template<> SIMD_INLINE float SynetBinaryOperation32f<SimdSynetBinaryOperation32fPow>(float a, float b)
+        {
+            return Pow(a, b);
+        }
+
+        template<> SIMD_INLINE float SynetBinaryOperation32f<SimdSynetBinaryOperation32fSub>(float a, float b)
+        {
+            return a - b;
+        }
+
+        typedef void(*SynetBinaryOperation32fPtr)(const float* a, const float* b, size_t size, float* dst);
+
+        void SynetBinaryOperation32fLayerForward(const float* a, const size_t* aShape, size_t aCount, const float* b, const size_t* bShape, size_t bCount, 
+            float* dst, SynetBinaryOperation32fPtr vv, SynetBinaryOperation32fPtr vs, SynetBinaryOperation32fPtr sv);
+
+        //---------------------------------------------------------------------
+
         template<SimdSynetUnaryOperation32fType type> float SynetUnaryOperation32f(float value);
 
         template<> SIMD_INLINE float SynetUnaryOperation32f<SimdSynetUnaryOperation32fAbs>(float value)
@@ -294,6 +358,83 @@ namespace Simd
         {
             return int32_t(value) | (int32_t(value) << 8) | (int32_t(value) << 16) | (int32_t(value) << 24);
         }
+
+        //---------------------------------------------------------------------
+
+        template<SimdSynetReduceType type> float SynetReduceInit();
+
+        template<> SIMD_INLINE float SynetReduceInit<SimdSynetReduceL2>()
+        {
+            return 0.0f;
+        }
+
+        template<> SIMD_INLINE float SynetReduceInit<SimdSynetReduceMax>()
+        {
+            return -FLT_MAX;
+        }
+
+        template<> SIMD_INLINE float SynetReduceInit<SimdSynetReduceMean>()
+        {
+            return 0.0f;
+        }
+
+        template<> SIMD_INLINE float SynetReduceInit<SimdSynetReduceMin>()
+        {
+            return FLT_MAX;
+        }
+
+        template<> SIMD_INLINE float SynetReduceInit<SimdSynetReduceSum>()
+        {
+            return 0.0f;
+        }
+
+        template<SimdSynetReduceType type> SIMD_INLINE float SynetReduce(float sum, float value)
+        {
+            return sum + value;
+        }
+
+        template<> SIMD_INLINE float SynetReduce<SimdSynetReduceL2>(float sum, float value)
+        {
+            return sum + value * value;
+        }
+
+        template<> SIMD_INLINE float SynetReduce<SimdSynetReduceMax>(float sum, float value)
+        {
+            return Simd::Max(sum, value);
+        }
+
+        template<> SIMD_INLINE float SynetReduce<SimdSynetReduceMin>(float sum, float value)
+        {
+            return Simd::Min(sum, value);
+        }
+
+        template<SimdSynetReduceType type> SIMD_INLINE float SynetReduceFinal(float sum, float count)
+        {
+            return sum;
+        }
+
+        template<> SIMD_INLINE float SynetReduceFinal<SimdSynetReduceL2>(float sum, float count)
+        {
+            return ::sqrt(sum);
+        }
+
+        template<> SIMD_INLINE float SynetReduceFinal<SimdSynetReduceMean>(float sum, float count)
+        {
+            return sum / count;
+        }
+
+        typedef void(*SynetReducePtr)(const float* src, size_t rows, size_t cols, float* dst);
+
+        void SynetReduceLayerForward(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, 
+            SimdBool reduceChannels, SimdBool reduceSpatial, float* dst, SynetReducePtr reduceRows, SynetReducePtr reduceCols);
+
+        //---------------------------------------------------------------------
+
+        const size_t SYNET_PERMUTE_TILE = 64;
+
+        typedef void(*SynetPermuteTransposePtr)(const float* src, size_t srcStride, size_t rows, size_t cols, float* dst, size_t dstStride);
+
+        void SynetPermute32f(const float* src, const size_t* shape, const size_t* order, size_t count, float* dst, SynetPermuteTransposePtr transpose);
     }
 
 #ifdef SIMD_SSE2_ENABLE
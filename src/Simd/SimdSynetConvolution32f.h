@@ -28,6 +28,7 @@
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetSparse32f.h"
 
 #ifdef _N
 #undef _N
@@ -35,6 +36,8 @@
 
 namespace Simd
 {
+    class SynetInnerProduct32f;
+
     const bool NHWC_GEMM_COMPATIBLE = false;
     const bool NHWC_GEMM_RUNTIME = true;
 
@@ -180,7 +183,7 @@ namespace Simd
 
         virtual size_t InternalBufferSize() const
         {
-            return _buffer.size + _nhwcWeight.size;
+            return _buffer.size + _nhwcWeight.size + _strided.size;
         }
 
         virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
@@ -194,6 +197,8 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        void ForwardStrided(const float * src, float * buf, float * dst, size_t dstStride);
+
         float * Buffer(float * buffer)
         {
             if (buffer)
@@ -221,7 +226,7 @@ namespace Simd
         typedef void(*BiasAndActivation)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
 
         ConvParam32f _param;
-        Array32f _buffer;
+        Array32f _buffer, _strided;
         float _0, _1;
         const float * _weight, * _bias, * _params;
         RuntimeGemm _gemm;
@@ -385,7 +390,7 @@ namespace Simd
             {
                 size_t F, microD, macroH, macroC, macroD;
                 ConvolutionPtr convolutions[2];
-                size_t stepW;
+                size_t stepW, srcC, dstC;
             };
 
             typedef void(*OldConvolutionPtr)(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst);
@@ -449,7 +454,49 @@ namespace Simd
             void ReorderWeight(const float* src, float* dst);
         };
 
+        class SynetConvolution32fSparse : public SynetConvolution32f
+        {
+        public:
+            SynetConvolution32fSparse(const ConvParam32f & p, SynetConvolution32f * dense);
+            virtual ~SynetConvolution32fSparse();
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const;
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
+            virtual void Forward(const float * src, float * buf, float * dst);
+
+            static bool Preferable(const ConvParam32f & p);
+
+        protected:
+            SynetConvolution32f * _dense;
+            SparseWeight32f _sparse;
+            SparseGemm32fNSPtr _gemmNS;
+            SparseGemm32fSNPtr _gemmSN;
+        };
+
+        class SynetConvolution32fProd16 : public SynetConvolution32f
+        {
+        public:
+            SynetConvolution32fProd16(const ConvParam32f & p, SimdTensorDataType weightType);
+            virtual ~SynetConvolution32fProd16();
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
+            virtual void Forward(const float * src, float * buf, float * dst);
+
+            static bool Preferable(const ConvParam32f & p, SimdTensorDataType weightType);
+
+        protected:
+            SynetConvolution32fProd16(const ConvParam32f & p, SynetInnerProduct32f * prod);
+
+            SynetInnerProduct32f * _prod;
+        };
+
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
+
+        void * SynetConvolution32fInitV2(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType);
     }
 
 #ifdef SIMD_SSE2_ENABLE    
@@ -516,7 +563,16 @@ namespace Simd
             static bool Set3r(const ConvParam32f& p, AlgParam& a);
         };
 
+        class SynetConvolution32fSparse : public Base::SynetConvolution32fSparse
+        {
+        public:
+            SynetConvolution32fSparse(const ConvParam32f & p, SynetConvolution32f * dense);
+            virtual String Ext() const { return "Sse2"; }
+        };
+
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
+
+        void * SynetConvolution32fInitV2(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType);
     }
 #endif//SIMD_SSE2_ENABLE
 
@@ -532,6 +588,8 @@ namespace Simd
         };
 
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
+
+        void * SynetConvolution32fInitV2(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType);
     }
 #endif//SIMD_SSE41_ENABLE
 
@@ -604,12 +662,16 @@ namespace Simd
         };
 
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
+
+        void * SynetConvolution32fInitV2(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType);
     }
 #endif//SIMD_AVX_ENABLE
 
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
+        void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, ::SimdBool trans, float * dst);
+
         void NhwcRun(size_t M, size_t N, size_t K, const float * A, const float * B, float * C);
         void NhwcReorderB(size_t M, size_t N, size_t K, const float * B, float * pB);
         size_t NhwcBufferSize(size_t M, size_t N, size_t K);
@@ -669,7 +731,26 @@ namespace Simd
             static bool Set3r(const ConvParam32f& p, AlgParam& a);
         };
 
+        class SynetConvolution32fSparse : public Sse2::SynetConvolution32fSparse
+        {
+        public:
+            SynetConvolution32fSparse(const ConvParam32f & p, SynetConvolution32f * dense);
+            virtual String Ext() const { return "Avx2"; }
+        };
+
+        class SynetConvolution32fProd16 : public Base::SynetConvolution32fProd16
+        {
+        public:
+            SynetConvolution32fProd16(const ConvParam32f & p, SimdTensorDataType weightType);
+            virtual String Ext() const { return "Avx2"; }
+
+        protected:
+            SynetConvolution32fProd16(const ConvParam32f & p, SynetInnerProduct32f * prod);
+        };
+
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
+
+        void * SynetConvolution32fInitV2(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType);
     }
 #endif//SIMD_AVX2_ENABLE
 
@@ -737,7 +818,26 @@ namespace Simd
             static bool Set3r(const ConvParam32f& p, AlgParam& a);
         };
 
+        class SynetConvolution32fSparse : public Avx2::SynetConvolution32fSparse
+        {
+        public:
+            SynetConvolution32fSparse(const ConvParam32f & p, SynetConvolution32f * dense);
+            virtual String Ext() const { return "Avx512f"; }
+        };
+
+        class SynetConvolution32fProd16 : public Avx2::SynetConvolution32fProd16
+        {
+        public:
+            SynetConvolution32fProd16(const ConvParam32f & p, SimdTensorDataType weightType);
+            virtual String Ext() const { return "Avx512f"; }
+
+        protected:
+            SynetConvolution32fProd16(const ConvParam32f & p, SynetInnerProduct32f * prod);
+        };
+
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
+
+        void * SynetConvolution32fInitV2(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType);
     }
 #endif//SIMD_AVX512F_ENABLE
 
@@ -818,6 +918,8 @@ namespace Simd
         };
 
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
+
+        void * SynetConvolution32fInitV2(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType);
     }
 #endif//SIMD_NEON_ENABLE
 }
@@ -57,7 +57,12 @@ namespace Simd
                 dstH == (srcH + padY + padH - (dilationY * (kernelY - 1) + 1)) / strideY + 1 && dstH > 0 &&
                 dstW == (srcW + padX + padW - (dilationX * (kernelX - 1) + 1)) / strideX + 1 && dstW > 0 &&
                 (srcT == SimdTensorData32f || srcT == SimdTensorData8u) && (dstT == SimdTensorData32f || dstT == SimdTensorData8u) &&
-                srcF == dstF && (srcF == SimdTensorFormatNchw || srcF == SimdTensorFormatNhwc);
+                srcF == dstF && (srcF == SimdTensorFormatNchw || srcF == SimdTensorFormatNhwc || (IsNchwXc() && (group == 1 || IsDepthwise())));
+        }
+
+        SIMD_INLINE bool IsNchwXc() const
+        {
+            return srcF == SimdTensorFormatNchw4c || srcF == SimdTensorFormatNchw8c || srcF == SimdTensorFormatNchw16c;
         }
 
         SIMD_INLINE bool IsKernel(size_t value) const
@@ -278,6 +283,50 @@ namespace Simd
             ConvolutionPtr _convolution;
         };
 
+        class SynetConvolution8iNchwcDirect : public SynetConvolution8i
+        {
+        public:
+            SynetConvolution8iNchwcDirect(const ConvParam8i& p);
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const;
+            virtual size_t ExternalBufferSize() const;
+            virtual void SetParams(const float* weight, const float* bias, const float* params, const float* const* stats);
+
+            static bool Preferable(const ConvParam8i& p);
+
+            struct AlgParam
+            {
+                size_t F;
+                int32_t zero, size, upper;
+            };
+
+            typedef void(*ConvolutionPtr)(const uint8_t* src, const ConvParam8i& p, const AlgParam& a, const int8_t* weight,
+                const float* norm, const float* bias, const float* params, const float* scale, const float* shift, uint8_t* dst);
+
+        protected:
+            virtual void ReorderWeight();
+            void PadInput(const uint8_t* src, uint8_t* dst);
+
+            virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst);
+
+            AlgParam _alg;
+            size_t _sizeP;
+            ConvParam8i _paramP;
+            ConvolutionPtr _convolution;
+        };
+
+        class SynetConvolution8iNchwcDepthwise : public SynetConvolution8iNchwcDirect
+        {
+        public:
+            SynetConvolution8iNchwcDepthwise(const ConvParam8i& p);
+            virtual String Desc() const;
+
+            static bool Preferable(const ConvParam8i& p);
+
+        protected:
+            virtual void ReorderWeight();
+        };
+
         void * SynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
     }
 
@@ -368,6 +417,26 @@ namespace Simd
         };
 #endif
 
+        class SynetConvolution8iNchwcDirect : public Base::SynetConvolution8iNchwcDirect
+        {
+        public:
+            SynetConvolution8iNchwcDirect(const ConvParam8i& p);
+
+            virtual String Ext() const { return "Avx512bw"; }
+
+            static bool Preferable(const ConvParam8i& p);
+        };
+
+        class SynetConvolution8iNchwcDepthwise : public Base::SynetConvolution8iNchwcDepthwise
+        {
+        public:
+            SynetConvolution8iNchwcDepthwise(const ConvParam8i& p);
+
+            virtual String Ext() const { return "Avx512bw"; }
+
+            static bool Preferable(const ConvParam8i& p);
+        };
+
         void* SynetConvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
     }
 #endif
@@ -397,6 +466,14 @@ namespace Simd
         };
 #endif
 
+        class SynetConvolution8iNchwcDirect : public Avx512bw::SynetConvolution8iNchwcDirect
+        {
+        public:
+            SynetConvolution8iNchwcDirect(const ConvParam8i& p);
+
+            virtual String Ext() const { return "Avx512vnni"; }
+        };
+
         void* SynetConvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
     }
 #endif
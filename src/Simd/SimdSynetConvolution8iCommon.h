@@ -805,6 +805,18 @@ namespace Simd
         {
             Term8iDepthwise<term>::template Save<type, nofma>(dst, sum, norm, bias, params, scale, shift, upper, offset, tail);
         }
+
+        //---------------------------------------------------------------------
+
+        template<Term8iType term, SimdConvolutionActivationType type, int index, bool nofma> SIMD_INLINE void SaveNchw16c(uint8_t* dst, __m512i sum,
+            const __m512* norm, const __m512* bias, const __m512* params, const __m512* scale, const __m512* shift, __m128i upper, __mmask16 tail)
+        {
+            __m512 f32 = Activate<type>(Fmadd<nofma>(_mm512_cvtepi32_ps(sum), norm[index], bias[index]), params, index);
+            if (term == Term8iLast8u)
+                _mm_storeu_si128((__m128i*)dst, _mm_min_epu8(Cvt32fTo8u(Fmadd<nofma>(f32, scale[index], shift[index])), upper));
+            else
+                _mm512_storeu_ps((float*)dst, _mm512_maskz_mov_ps(tail, f32));
+        }
     }
 #endif//SIMD_AVX512BW_ENABLE
 
@@ -0,0 +1,77 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetDetection_h__
+#define __SimdSynetDetection_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdSynet.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE void DecodeSsd(const float* loc, const float* prior, const float* variance, float* dst)
+        {
+            float priorW = prior[2] - prior[0];
+            float priorH = prior[3] - prior[1];
+            float centerX = variance[0] * loc[0] * priorW + (prior[0] + prior[2]) * 0.5f;
+            float centerY = variance[1] * loc[1] * priorH + (prior[1] + prior[3]) * 0.5f;
+            float halfW = ::exp(variance[2] * loc[2]) * priorW * 0.5f;
+            float halfH = ::exp(variance[3] * loc[3]) * priorH * 0.5f;
+            dst[0] = centerX - halfW;
+            dst[1] = centerY - halfH;
+            dst[2] = centerX + halfW;
+            dst[3] = centerY + halfH;
+        }
+
+        SIMD_INLINE float DetectionArea(const float* box)
+        {
+            return Simd::Max(box[2] - box[0], 0.0f) * Simd::Max(box[3] - box[1], 0.0f);
+        }
+
+        SIMD_INLINE bool DetectionOverlaps(const float* kept, size_t begin, size_t end, size_t stride, const float* box, float threshold)
+        {
+            const float* x1 = kept + 0 * stride, * y1 = kept + 1 * stride, * x2 = kept + 2 * stride, * y2 = kept + 3 * stride, * area = kept + 4 * stride;
+            float boxArea = DetectionArea(box);
+            for (size_t i = begin; i < end; ++i)
+            {
+                float w = Simd::Max(Simd::Min(box[2], x2[i]) - Simd::Max(box[0], x1[i]), 0.0f);
+                float h = Simd::Max(Simd::Min(box[3], y2[i]) - Simd::Max(box[1], y1[i]), 0.0f);
+                float intersection = w * h;
+                if (intersection > threshold * (boxArea + area[i] - intersection))
+                    return true;
+            }
+            return false;
+        }
+
+        typedef size_t(*DetectionSelectPtr)(const float* scores, size_t count, float threshold, int32_t* index, float* score);
+
+        typedef bool(*DetectionOverlapsPtr)(const float* kept, size_t size, size_t stride, const float* box, float threshold);
+
+        size_t SynetDetectionOutput32f(const float* boxes, const float* scores, size_t count, size_t classes, size_t background, float confidence, 
+            float overlap, size_t topK, size_t keepTopK, DetectionSelectPtr select, DetectionOverlapsPtr overlaps, float* dst);
+    }
+}
+
+#endif//__SimdSynetDetection_h__
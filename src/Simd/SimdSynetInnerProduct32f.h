@@ -27,6 +27,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetSparse32f.h"
 
 namespace Simd
 {
@@ -37,20 +38,23 @@ namespace Simd
         size_t output;
         SimdBool transpose;
         SimdConvolutionActivationType activation;
+        SimdTensorDataType weightType;
 
-        InnerProductParam32f(size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a)
+        InnerProductParam32f(size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a, SimdTensorDataType w)
         {
             batch = b;
             input = i;
             output = o;
             transpose = t;
             activation = a;
+            weightType = w;
         }
 
         bool Valid()
         {
             return 
-                activation == SimdConvolutionActivationIdentity;
+                activation == SimdConvolutionActivationIdentity &&
+                (weightType == SimdTensorData32f || weightType == SimdTensorData16f || weightType == SimdTensorData16b);
         }
 
 #ifdef SIMD_PERFORMANCE_STATISTIC
@@ -58,6 +62,8 @@ namespace Simd
         {
             std::stringstream ss;
             ss << batch << "x" << input << "x" << output << "-" << transpose;
+            if (weightType != SimdTensorData32f)
+                ss << "-" << (weightType == SimdTensorData16f ? "16f" : "16b");
             return ss.str();
         }
 
@@ -167,7 +173,51 @@ namespace Simd
             void ReorderWeight(const float* src, float* dst);
         };
 
-        void * SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+        class SynetInnerProduct32fProd16 : public SynetInnerProduct32f
+        {
+        public:
+            SynetInnerProduct32fProd16(const InnerProductParam32f& p);
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const { return Ext() + "::Prod" + (_param.weightType == SimdTensorData16f ? "16f" : "16b"); }
+            virtual size_t InternalBufferSize() const { return _rWeight.RawSize() / sizeof(float) + _rBias.size; }
+            virtual void SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params);
+            virtual void Forward(const float* src, float* dst);
+
+        protected:
+            typedef void(*ProdPtr)(const float* src, const uint16_t* weight, const float* bias, size_t input, size_t output, float* dst);
+
+            ProdPtr _prod;
+            Array16u _rWeight;
+            Array32f _rBias;
+            size_t _F, _N, _K;
+
+            void SetSize(size_t F);
+            void ReorderWeight(const float* src, uint16_t* dst);
+        };
+
+        class SynetInnerProduct32fSparse : public SynetInnerProduct32f
+        {
+        public:
+            SynetInnerProduct32fSparse(const InnerProductParam32f & p, SynetInnerProduct32f * dense);
+            virtual ~SynetInnerProduct32fSparse();
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
+            virtual void Forward(const float * src, float * dst);
+
+            static bool Preferable(const InnerProductParam32f & p);
+
+        protected:
+            typedef void(*BiasAndActivationPtr)(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, SimdBool trans, float* dst);
+
+            SynetInnerProduct32f * _dense;
+            SparseWeight32f _sparse;
+            SparseGemm32fNSPtr _gemm;
+            BiasAndActivationPtr _biasAndActivation;
+        };
+
+        void * SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -189,7 +239,15 @@ namespace Simd
             virtual String Ext() const { return "Sse41"; }
         };
 
-        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+        class SynetInnerProduct32fSparse : public Base::SynetInnerProduct32fSparse
+        {
+        public:
+            SynetInnerProduct32fSparse(const InnerProductParam32f & p, SynetInnerProduct32f * dense);
+
+            virtual String Ext() const { return "Sse41"; }
+        };
+
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType);
     }
 #endif//SIMD_SSE41_ENABLE
 
@@ -212,7 +270,7 @@ namespace Simd
             virtual String Ext() const { return "Avx"; }
         };
 
-        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType);
     }
 #endif//SIMD_AVX_ENABLE
 
@@ -235,7 +293,23 @@ namespace Simd
             virtual String Ext() const { return "Avx2"; }
         };
 
-        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+        class SynetInnerProduct32fProd16 : public Base::SynetInnerProduct32fProd16
+        {
+        public:
+            SynetInnerProduct32fProd16(const InnerProductParam32f& p);
+
+            virtual String Ext() const { return "Avx2"; }
+        };
+
+        class SynetInnerProduct32fSparse : public Sse41::SynetInnerProduct32fSparse
+        {
+        public:
+            SynetInnerProduct32fSparse(const InnerProductParam32f & p, SynetInnerProduct32f * dense);
+
+            virtual String Ext() const { return "Avx2"; }
+        };
+
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType);
     }
 #endif//SIMD_AVX2_ENABLE
 
@@ -258,7 +332,23 @@ namespace Simd
             virtual String Ext() const { return "Avx512f"; }
         };
 
-        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+        class SynetInnerProduct32fProd16 : public Avx2::SynetInnerProduct32fProd16
+        {
+        public:
+            SynetInnerProduct32fProd16(const InnerProductParam32f& p);
+
+            virtual String Ext() const { return "Avx512f"; }
+        };
+
+        class SynetInnerProduct32fSparse : public Avx2::SynetInnerProduct32fSparse
+        {
+        public:
+            SynetInnerProduct32fSparse(const InnerProductParam32f & p, SynetInnerProduct32f * dense);
+
+            virtual String Ext() const { return "Avx512f"; }
+        };
+
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType);
     }
 #endif//SIMD_AVX512F_ENABLE
 
@@ -282,7 +372,7 @@ namespace Simd
             virtual String Ext() const { return "Neon"; }
         };
 
-        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType);
     }
 #endif//SIMD_NEON_ENABLE
 }
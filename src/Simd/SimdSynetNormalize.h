@@ -0,0 +1,61 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetNormalize_h__
+#define __SimdSynetNormalize_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE void NormalizeStatistics(float sum, float sqsum, size_t count, float eps, float & mean, float & norm)
+        {
+            mean = sum / float(count);
+            norm = 1.0f / ::sqrt(Simd::Max(sqsum / float(count) - mean * mean, 0.0f) + eps);
+        }
+
+        SIMD_INLINE void NormalizeAffine(size_t channels, const float *& scale, const float *& shift, Array32f & buf)
+        {
+            if (scale && shift)
+                return;
+            buf.Resize(channels * 2);
+            if (scale == NULL)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                    buf[c] = 1.0f;
+                scale = buf.data;
+            }
+            if (shift == NULL)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                    buf[channels + c] = 0.0f;
+                shift = buf.data + channels;
+            }
+        }
+    }
+}
+
+#endif//__SimdSynetNormalize_h__
@@ -0,0 +1,84 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetRoi_h__
+#define __SimdSynetRoi_h__
+
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        typedef void(*RoiAlignPtr)(const float* src, size_t channels, size_t height, size_t width, const int32_t* iy, const float* ay, size_t gridH,
+            const int32_t* ix, const float* ax, size_t gridW, size_t pooledH, size_t pooledW, float* dst);
+
+        typedef void(*RoiPoolingPtr)(const float* src, size_t channels, size_t height, size_t width, 
+            const int32_t* iy, const int32_t* ix, size_t pooledH, size_t pooledW, float* dst);
+
+        SIMD_INLINE float RoiAlignNhwc1(const float* src, size_t channels, size_t stride, const int32_t* py, const float* wy, size_t sizeY, 
+            const int32_t* px, const float* wx, size_t sizeX)
+        {
+            float sum = 0;
+            for (size_t y = 0; y < sizeY; ++y)
+            {
+                if (wy[y] == 0.0f)
+                    continue;
+                const float* row = src + py[y] * stride;
+                for (size_t x = 0; x < sizeX; ++x)
+                {
+                    float w = wy[y] * wx[x];
+                    if (w != 0.0f)
+                        sum += w * row[px[x] * channels];
+                }
+            }
+            return sum;
+        }
+
+        SIMD_INLINE float RoiPoolingNhwc1(const float* src, size_t channels, size_t stride, size_t y0, size_t y1, size_t x0, size_t x1)
+        {
+            float max = src[y0 * stride + x0 * channels];
+            for (size_t y = y0; y < y1; ++y)
+            {
+                const float* row = src + y * stride;
+                for (size_t x = x0; x < x1; ++x)
+                    max = Simd::Max(max, row[x * channels]);
+            }
+            return max;
+        }
+
+        void RoiAlignNchw(const float* src, size_t channels, size_t height, size_t width, const int32_t* iy, const float* ay, size_t gridH,
+            const int32_t* ix, const float* ax, size_t gridW, size_t pooledH, size_t pooledW, float* dst);
+
+        void RoiPoolingNchw(const float* src, size_t channels, size_t height, size_t width,
+            const int32_t* iy, const int32_t* ix, size_t pooledH, size_t pooledW, float* dst);
+
+        void SynetRoiAlign32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+            size_t pooledH, size_t pooledW, float spatialScale, size_t samplingRatio, bool aligned, float* dst, RoiAlignPtr nchw, RoiAlignPtr nhwc);
+
+        void SynetRoiPooling32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+            size_t pooledH, size_t pooledW, float spatialScale, float* dst, RoiPoolingPtr nchw, RoiPoolingPtr nhwc);
+    }
+}
+
+#endif//__SimdSynetRoi_h__
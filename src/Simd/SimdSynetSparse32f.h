@@ -0,0 +1,103 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetSparse32f_h__
+#define __SimdSynetSparse32f_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    const float SPARSE_DENSITY_BLOCK = 0.30f;
+    const float SPARSE_DENSITY_SINGLE = 0.10f;
+
+    /*
+    * Block-compressed sparse weight: for every block of B output channels it stores indices of input channels 
+    * which have at least one nonzero weight in the block and B (zero padded) weights for each of them.
+    */
+    struct SparseWeight32f
+    {
+        size_t N, K, B;
+        Array32i offset, index;
+        Array32f value;
+
+        SparseWeight32f()
+            : N(0), K(0), B(0)
+        {
+        }
+
+        SIMD_INLINE bool Enable() const
+        {
+            return B != 0;
+        }
+
+        SIMD_INLINE size_t Size() const
+        {
+            return offset.size + index.size + value.size;
+        }
+
+        /* Weight (n, k) is placed at weight[n * ldN + k * ldK]. Returns false if the weight is too dense. */
+        bool Init(const float * weight, size_t N, size_t K, size_t ldN, size_t ldK, float blockDensity, float singleDensity);
+
+        void Clear();
+    };
+
+    namespace Base
+    {
+        typedef void(*SparseGemm32fNSPtr)(size_t M, const float * A, size_t lda, const SparseWeight32f & B, float * C, size_t ldc);
+        typedef void(*SparseGemm32fSNPtr)(const SparseWeight32f & A, size_t M, const float * B, size_t ldb, float * C, size_t ldc);
+
+        void SparseGemm32fNS(size_t M, const float * A, size_t lda, const SparseWeight32f & B, float * C, size_t ldc);
+
+        void SparseGemm32fSN(const SparseWeight32f & A, size_t M, const float * B, size_t ldb, float * C, size_t ldc);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        void SparseGemm32fNS(size_t M, const float * A, size_t lda, const SparseWeight32f & B, float * C, size_t ldc);
+
+        void SparseGemm32fSN(const SparseWeight32f & A, size_t M, const float * B, size_t ldb, float * C, size_t ldc);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void SparseGemm32fNS(size_t M, const float * A, size_t lda, const SparseWeight32f & B, float * C, size_t ldc);
+
+        void SparseGemm32fSN(const SparseWeight32f & A, size_t M, const float * B, size_t ldb, float * C, size_t ldc);
+    }
+#endif//SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512F_ENABLE    
+    namespace Avx512f
+    {
+        void SparseGemm32fNS(size_t M, const float * A, size_t lda, const SparseWeight32f & B, float * C, size_t ldc);
+
+        void SparseGemm32fSN(const SparseWeight32f & A, size_t M, const float * B, size_t ldb, float * C, size_t ldc);
+    }
+#endif//SIMD_AVX512F_ENABLE
+}
+
+#endif//__SimdSynetSparse32f_h__
@@ -552,6 +552,50 @@ namespace Simd
             dst[stride * 34] = r24 * t[15] - r12 * t[16] + r6 * t[17];
             dst[stride * 35] = t[17];
         }
+
+        //-----------------------------------------------------------------------
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetFilter8(const float * src, size_t srcStride, float * dst, size_t stride)
+        {
+            const float r2_9 = float(2.0f / 9.0f);
+            const float r1_90 = float(1.0f / 90.0f);
+            const float r1_45 = float(1.0f / 45.0f);
+            const float r2_45 = float(2.0f / 45.0f);
+            const float r32_45 = float(32.0f / 45.0f);
+            const float r16_45 = float(16.0f / 45.0f);
+            const float r8_45 = float(8.0f / 45.0f);
+            float t[3] = { src[0 * srcStride], src[1 * srcStride], src[2 * srcStride] };
+            dst[stride * 0] = t[0];
+            dst[stride * 1] = -r2_9 * (t[0] + t[1] + t[2]);
+            dst[stride * 2] = -r2_9 * (t[0] - t[1] + t[2]);
+            dst[stride * 3] = r1_90 * t[0] + r1_45 * t[1] + r2_45 * t[2];
+            dst[stride * 4] = r1_90 * t[0] - r1_45 * t[1] + r2_45 * t[2];
+            dst[stride * 5] = r32_45 * t[0] + r16_45 * t[1] + r8_45 * t[2];
+            dst[stride * 6] = r32_45 * t[0] - r16_45 * t[1] + r8_45 * t[2];
+            dst[stride * 7] = t[2];
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetFilter1(const float src[9], float * dst, size_t stride)
+        {
+            float t[24];
+            for (size_t i = 0; i < 3; ++i)
+                WinogradKernel3x3Block6x6SetFilter8(src + i, 3, t + i, 3);
+            for (size_t i = 0; i < 8; ++i)
+                WinogradKernel3x3Block6x6SetFilter8(t + i * 3, 1, dst + i * 8 * stride, stride);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetFilter1n(const float * src, float * dst, size_t stride)
+        {
+            WinogradKernel3x3Block6x6SetFilter1(src, dst, stride);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetFilter1t(const float * src, float * dst, size_t stride)
+        {
+            float s[9];
+            for (size_t i = 0; i < 9; ++i)
+                s[i] = src[i * stride];
+            WinogradKernel3x3Block6x6SetFilter1(s, dst, stride);
+        }
     }
 
 #if defined(SIMD_SSE2_ENABLE) && defined(SIMD_SYNET_ENABLE)    
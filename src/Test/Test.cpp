@@ -169,7 +169,11 @@ namespace Test
     TEST_ADD_GROUP_AD0(DetectionLbpDetect32fi);
     TEST_ADD_GROUP_AD0(DetectionLbpDetect16ip);
     TEST_ADD_GROUP_AD0(DetectionLbpDetect16ii);
+    TEST_ADD_GROUP_A00(DetectionLoadBinary);
+    TEST_ADD_GROUP_A00(DetectionPartition);
     TEST_ADD_GROUP_00S(Detection);
+    TEST_ADD_GROUP_00S(DetectionVideo);
+    TEST_ADD_GROUP_00S(DetectionBatch);
 
     TEST_ADD_GROUP_AD0(AlphaBlending);
     TEST_ADD_GROUP_A00(AlphaBlendingUniform);
@@ -215,6 +219,11 @@ namespace Test
 
     TEST_ADD_GROUP_A00(Gemm32fNN);
     TEST_ADD_GROUP_A00(Gemm32fNT);
+    TEST_ADD_GROUP_A00(Gemm32fStridedBatched);
+#if defined(SIMD_SYNET_ENABLE)
+    TEST_ADD_GROUP_A00(Gemm32fPacked);
+    TEST_ADD_GROUP_A00(Gemm8iPacked);
+#endif
 
     TEST_ADD_GROUP_A00(ImageSaveToMemory);
     TEST_ADD_GROUP_A0S(ImageLoadFromMemory);
@@ -255,6 +264,7 @@ namespace Test
     TEST_ADD_GROUP_AD0(HogLiteFilterSeparable);
     TEST_ADD_GROUP_AD0(HogLiteFindMax7x7);
     TEST_ADD_GROUP_AD0(HogLiteCreateMask);
+    TEST_ADD_GROUP_00S(HogDetector);
 
     TEST_ADD_GROUP_00S(ImageMatcher);
 
@@ -353,9 +363,20 @@ namespace Test
 #if defined(SIMD_SYNET_ENABLE)
     TEST_ADD_GROUP_A00(SynetAddBias);
     TEST_ADD_GROUP_A00(SynetAdd8i);
+    TEST_ADD_GROUP_A00(SynetBinaryOperation32fLayerForward);
+    TEST_ADD_GROUP_A00(SynetDecodeSsd32f);
+    TEST_ADD_GROUP_A00(SynetDecodeYolo32f);
+    TEST_ADD_GROUP_A00(SynetDetectionOutput32f);
     TEST_ADD_GROUP_AD0(SynetEltwiseLayerForward);
+    TEST_ADD_GROUP_A00(SynetGroupNormalize32f);
+    TEST_ADD_GROUP_A00(SynetL2Normalize32f);
+    TEST_ADD_GROUP_A00(SynetLayerNormalize32f);
+    TEST_ADD_GROUP_A00(SynetLogSoftmaxLayerForward);
     TEST_ADD_GROUP_A00(SynetLrnLayerCrossChannels);
+    TEST_ADD_GROUP_A00(SynetReduceLayerForward);
     TEST_ADD_GROUP_A00(SynetShuffleLayerForward);
+    TEST_ADD_GROUP_A00(SynetScaledDotProductAttention32f);
+    TEST_ADD_GROUP_A00(SynetSoftmaxArgMaxLayerForward);
     TEST_ADD_GROUP_A00(SynetSoftmaxLayerForward);
     TEST_ADD_GROUP_A00(SynetUnaryOperation32fLayerForward);
 
@@ -375,10 +396,16 @@ namespace Test
     TEST_ADD_GROUP_A00(SynetSetInput);
     TEST_ADD_GROUP_A00(SynetReorderImage);
     TEST_ADD_GROUP_A00(SynetReorderFilter);
+    TEST_ADD_GROUP_A00(SynetPermute32f);
 
     TEST_ADD_GROUP_A00(SynetConvolution8iForward);
+    TEST_ADD_GROUP_A00(SynetConvolution8iNchwcForward);
 
     TEST_ADD_GROUP_A00(SynetConvolution32fForward);
+    TEST_ADD_GROUP_A00(SynetConvolution32fSparseForward);
+    TEST_ADD_GROUP_A00(SynetConvolution32fGemmNNForward);
+    TEST_ADD_GROUP_A00(SynetConvolution32fForwardStrided);
+    TEST_ADD_GROUP_A00(SynetConvolution32fWeight16Forward);
 
     TEST_ADD_GROUP_A00(SynetDeconvolution32fForward);
 
@@ -391,16 +418,23 @@ namespace Test
     TEST_ADD_GROUP_A00(SynetFusedLayerForward9);
 
     TEST_ADD_GROUP_A00(SynetInnerProduct32fForward);
+    TEST_ADD_GROUP_A00(SynetInnerProduct32fSparseForward);
+    TEST_ADD_GROUP_A00(SynetInnerProduct32fWeight16Forward);
     TEST_ADD_GROUP_A00(SynetInnerProductLayerForward);
     TEST_ADD_GROUP_A00(SynetInnerProduct8i);
+    TEST_ADD_GROUP_A00(SynetInnerProduct8iForward);
 
     TEST_ADD_GROUP_A00(SynetMergedConvolution8iForward);
 
     TEST_ADD_GROUP_A00(SynetMergedConvolution32fForward);
 
     TEST_ADD_GROUP_A00(SynetPoolingForwardAverage);
+    TEST_ADD_GROUP_A00(SynetPoolingForwardAverage8u);
     TEST_ADD_GROUP_A00(SynetPoolingForwardMax32f);
     TEST_ADD_GROUP_A00(SynetPoolingForwardMax8u);
+    TEST_ADD_GROUP_A00(SynetPoolingForwardStrided);
+    TEST_ADD_GROUP_A00(SynetRoiAlign32f);
+    TEST_ADD_GROUP_A00(SynetRoiPooling32f);
 
     TEST_ADD_GROUP_A00(SynetScaleLayerForward);
     TEST_ADD_GROUP_A00(SynetScale8iForward);
@@ -435,6 +469,9 @@ namespace Test
     TEST_ADD_GROUP_A00(WinogradKernel3x3Block4x4SetFilter);
     TEST_ADD_GROUP_A00(WinogradKernel3x3Block4x4SetInput);
     TEST_ADD_GROUP_A00(WinogradKernel3x3Block4x4SetOutput);
+    TEST_ADD_GROUP_A00(WinogradKernel3x3Block6x6SetFilter);
+    TEST_ADD_GROUP_A00(WinogradKernel3x3Block6x6SetInput);
+    TEST_ADD_GROUP_A00(WinogradKernel3x3Block6x6SetOutput);
 
     TEST_ADD_GROUP_00S(WinogradKernel1x3Block1x4);
     TEST_ADD_GROUP_00S(WinogradKernel1x5Block1x4);
@@ -443,6 +480,7 @@ namespace Test
     TEST_ADD_GROUP_00S(WinogradKernel3x3Block2x2);
     TEST_ADD_GROUP_00S(WinogradKernel3x3Block3x3);
     TEST_ADD_GROUP_00S(WinogradKernel3x3Block4x4);
+    TEST_ADD_GROUP_00S(WinogradKernel3x3Block6x6);
 #endif
 
     TEST_ADD_GROUP_AD0(Yuv444pToBgr);
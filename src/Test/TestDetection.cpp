@@ -551,6 +551,137 @@ namespace Test
     {
         return DetectionDetectDataTest(create, 1, 1, 1, FUNC_D(SimdDetectionLbpDetect16ii));
     }
+
+    //-----------------------------------------------------------------------------
+
+    static bool DetectionDetect(const void * data, const View & src, View & dst)
+    {
+        size_t w, h;
+        SimdDetectionInfoFlags flags;
+        SimdDetectionInfo(data, &w, &h, &flags);
+
+        View sum(src.width + 1, src.height + 1, View::Int32);
+        View sqsum(src.width + 1, src.height + 1, View::Int32);
+        View tilted(src.width + 1, src.height + 1, View::Int32);
+        if (flags & SimdDetectionInfoHasTilted)
+            Simd::Integral(src, sum, sqsum, tilted);
+        else
+            Simd::Integral(src, sum, sqsum);
+
+        void * hid = SimdDetectionInit(data, sum.data, sum.stride, sum.width, sum.height,
+            sqsum.data, sqsum.stride, tilted.data, tilted.stride, 0, 0);
+        if (hid == NULL)
+            return false;
+        SimdDetectionPrepare(hid);
+
+        View mask(src.Size(), View::Gray8);
+        Simd::Fill(mask, 255);
+        Simd::Fill(dst, 0);
+        Rect rect(0, 0, src.width - w, src.height - h);
+        if ((flags & SimdDetectionInfoFeatureMask) == SimdDetectionInfoFeatureLbp)
+            SimdDetectionLbpDetect32fp(hid, mask.data, mask.stride, rect.left, rect.top, rect.right, rect.bottom, dst.data, dst.stride);
+        else
+            SimdDetectionHaarDetect32fp(hid, mask.data, mask.stride, rect.left, rect.top, rect.right, rect.bottom, dst.data, dst.stride);
+
+        SimdRelease(hid);
+        return true;
+    }
+
+    static bool DetectionLoadCorruptedBinaryAutoTest(const std::vector<uint8_t> & buffer, size_t offset, int32_t value, const String & desc)
+    {
+        std::vector<uint8_t> corrupted(buffer);
+        memcpy(corrupted.data() + offset, &value, sizeof(value));
+        void * bin = SimdDetectionLoadBinary(corrupted.data(), corrupted.size());
+        if (bin != NULL)
+        {
+            TEST_LOG_SS(Error, "Binary cascade with " << desc << " was loaded!");
+            SimdRelease(bin);
+            return false;
+        }
+        return true;
+    }
+
+    bool DetectionLoadBinaryAutoTest(const String & path)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdDetectionSaveBinary & SimdDetectionLoadBinary for '" << path << "'.");
+
+        void * xml = SimdDetectionLoadA(path.c_str());
+        if (xml == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't load cascade '" << path << "' !");
+            return false;
+        }
+
+        std::vector<uint8_t> buffer1(SimdDetectionSaveBinary(xml, NULL, 0));
+        SimdDetectionSaveBinary(xml, buffer1.data(), buffer1.size());
+
+        void * bin = SimdDetectionLoadBinary(buffer1.data(), buffer1.size());
+        if (bin == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't load binary cascade for '" << path << "' !");
+            SimdRelease(xml);
+            return false;
+        }
+
+        std::vector<uint8_t> buffer2(SimdDetectionSaveBinary(bin, NULL, 0));
+        SimdDetectionSaveBinary(bin, buffer2.data(), buffer2.size());
+        if (buffer1 != buffer2)
+        {
+            TEST_LOG_SS(Error, "Binary cascades are different!");
+            result = false;
+        }
+
+        size_t w1, h1, w2, h2;
+        SimdDetectionInfoFlags flags1, flags2;
+        SimdDetectionInfo(xml, &w1, &h1, &flags1);
+        SimdDetectionInfo(bin, &w2, &h2, &flags2);
+        if (w1 != w2 || h1 != h2 || flags1 != flags2)
+        {
+            TEST_LOG_SS(Error, "Cascade info is different!");
+            result = false;
+        }
+
+        if (SimdDetectionLoadBinary(buffer1.data(), buffer1.size() - 1) != NULL)
+        {
+            TEST_LOG_SS(Error, "Truncated binary cascade was loaded!");
+            result = false;
+        }
+
+        const int32_t * header = (const int32_t*)buffer1.data();
+        size_t stages = header[10], classifiers = header[11], nodes = header[12], leaves = header[13], subsets = header[14], haars = header[15];
+        size_t stage = 17 * sizeof(int32_t), node = stage + stages * 3 * sizeof(int32_t) + classifiers * sizeof(int32_t);
+        size_t feature = node + nodes * 4 * sizeof(int32_t) + (leaves + subsets) * sizeof(int32_t);
+        result = result && DetectionLoadCorruptedBinaryAutoTest(buffer1, 5 * sizeof(int32_t), 1, "too small window");
+        result = result && DetectionLoadCorruptedBinaryAutoTest(buffer1, 13 * sizeof(int32_t), int32_t(leaves - 2), "wrong leaf count");
+        result = result && DetectionLoadCorruptedBinaryAutoTest(buffer1, stage + (stages - 1) * 3 * sizeof(int32_t) + sizeof(int32_t), int32_t(classifiers), "stage out of classifiers");
+        result = result && DetectionLoadCorruptedBinaryAutoTest(buffer1, stage, -1, "negative stage start");
+        result = result && DetectionLoadCorruptedBinaryAutoTest(buffer1, node, int32_t(haars ? haars : header[16]), "feature index out of range");
+        result = result && DetectionLoadCorruptedBinaryAutoTest(buffer1, node + (nodes - 1) * 4 * sizeof(int32_t), -1, "negative feature index");
+        result = result && DetectionLoadCorruptedBinaryAutoTest(buffer1, feature + (haars ? sizeof(int32_t) : 0), int32_t(header[5]), "feature rectangle out of window");
+
+        View src = GetSample(Size(W, H), false);
+        View dst1(src.Size(), View::Gray8), dst2(src.Size(), View::Gray8);
+        if (result && DetectionDetect(xml, src, dst1) && DetectionDetect(bin, src, dst2))
+            result = result && Compare(dst1, dst2, 0, true, 32);
+
+        SimdRelease(bin);
+        SimdRelease(xml);
+
+        return result;
+    }
+
+    bool DetectionLoadBinaryAutoTest()
+    {
+        bool result = true;
+
+        result = result && DetectionLoadBinaryAutoTest(ROOT_PATH + "/data/cascade/haar_face_0.xml");
+        result = result && DetectionLoadBinaryAutoTest(ROOT_PATH + "/data/cascade/haar_face_1.xml");
+        result = result && DetectionLoadBinaryAutoTest(ROOT_PATH + "/data/cascade/lbp_face.xml");
+
+        return result;
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -659,5 +790,192 @@ namespace Test
 
         return result;
     }
+
+    bool DetectionVideoSpecialTest()
+    {
+        Detection detection;
+        detection.Load(ROOT_PATH + "/data/cascade/haar_face_0.xml", 0);
+        detection.Load(ROOT_PATH + "/data/cascade/lbp_face.xml", 1);
+
+        View src = GetSample(Size(W, H), true);
+        detection.Init(src.Size(), 1.1, Size(), Size(INT_MAX, INT_MAX), View(), 1);
+
+        Objects full, video;
+        double time = GetTime();
+        detection.Detect(src, full);
+        TEST_LOG_SS(Info, "Detect : " << (GetTime() - time) * 1000 << " ms, " << full.size() << " objects.");
+
+        bool result = true;
+        const size_t period = 4;
+        for (size_t frame = 0; frame < period + 1; ++frame)
+        {
+            time = GetTime();
+            detection.DetectVideo(src, video, period);
+            TEST_LOG_SS(Info, "DetectVideo frame " << frame << " : " << (GetTime() - time) * 1000 << " ms, " << video.size() << " objects.");
+            if (video.size() != full.size())
+                result = false;
+            for (size_t i = 0; i < video.size() && result; ++i)
+                if (video[i].rect != full[i].rect || video[i].weight != full[i].weight)
+                    result = false;
+            if (!result)
+            {
+                TEST_LOG_SS(Error, (frame % period ? "Tracking" : "Full") << " detection at frame " << frame << " of DetectVideo is different from Detect!");
+                break;
+            }
+        }
+        return result;
+    }
+
+    static bool DetectionBatchSpecialTest(Detection & batch, const Size * sizes, size_t N)
+    {
+        Detection::Views images(N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            images[i].Recreate(sizes[i], View::Gray8);
+            Simd::ResizeBilinear(GetSample(Size(W, H), true), images[i]);
+        }
+
+        Detection::ObjectsVector objects;
+        double time = GetTime();
+        batch.DetectBatch(images, objects);
+        TEST_LOG_SS(Info, "DetectBatch for " << N << " images : " << (GetTime() - time) * 1000 << " ms.");
+
+        bool result = objects.size() == N;
+        for (size_t i = 0; i < N && result; ++i)
+        {
+            Detection single;
+            single.Load(ROOT_PATH + "/data/cascade/haar_face_0.xml", 0);
+            single.Load(ROOT_PATH + "/data/cascade/lbp_face.xml", 1);
+            single.Init(images[i].Size(), 1.1, Size(), Size(INT_MAX, INT_MAX), View(), 1);
+            Objects control;
+            single.Detect(images[i], control);
+
+            if (control.size() != objects[i].size())
+                result = false;
+            for (size_t j = 0; j < control.size() && result; ++j)
+                if (control[j].rect != objects[i][j].rect || control[j].weight != objects[i][j].weight || control[j].tag != objects[i][j].tag)
+                    result = false;
+            if (!result)
+                TEST_LOG_SS(Error, "DetectBatch result for image " << i << " [" << images[i].width << "x" << images[i].height << "] is different from Detect!");
+        }
+        return result;
+    }
+
+    bool DetectionBatchSpecialTest()
+    {
+        Detection batch;
+        batch.Load(ROOT_PATH + "/data/cascade/haar_face_0.xml", 0);
+        batch.Load(ROOT_PATH + "/data/cascade/lbp_face.xml", 1);
+        batch.InitBatch(1.1, Size(), Size(INT_MAX, INT_MAX), -1, 3);
+
+        bool result = true;
+
+        const Size sizes0[] = { Size(W, H), Size(W / 2, H / 2), Size(W, H), Size(W / 3, H / 2), Size(W / 2, H / 2), Size(W / 2, H / 3) };
+        result = result && DetectionBatchSpecialTest(batch, sizes0, 6);
+
+        const Size sizes1[] = { Size(W - 5, H - 3), Size(W / 2 - 7, H / 2 + 1), Size(W / 3 + 1, H / 2 - 1) };
+        result = result && DetectionBatchSpecialTest(batch, sizes1, 3);
+
+        const Size sizes2[] = { Size(W * 3 / 4, H * 3 / 4), Size(W / 4, H / 4) };
+        result = result && DetectionBatchSpecialTest(batch, sizes2, 2);
+
+        const Size sizes3[] = { Size(W - 1, H - 1) };
+        result = result && DetectionBatchSpecialTest(batch, sizes3, 1);
+
+        result = result && DetectionBatchSpecialTest(batch, sizes0, 6);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------------
+
+    static bool DetectionPartitionSimilar(const Detection::Rect & r1, const Detection::Rect & r2, double sizeDifferenceMax)
+    {
+        double delta = sizeDifferenceMax * (std::min(r1.Width(), r2.Width()) + std::min(r1.Height(), r2.Height())) * 0.5;
+        return std::abs(r1.left - r2.left) <= delta && std::abs(r1.top - r2.top) <= delta &&
+            std::abs(r1.right - r2.right) <= delta && std::abs(r1.bottom - r2.bottom) <= delta;
+    }
+
+    static int DetectionPartitionRoot(std::vector<int> & parents, int i)
+    {
+        while (parents[i] != i)
+            i = parents[i] = parents[parents[i]];
+        return i;
+    }
+
+    static int DetectionPartitionControl(const Objects & objects, std::vector<int> & labels, double sizeDifferenceMax)
+    {
+        int size = (int)objects.size();
+        std::vector<int> parents(size);
+        for (int i = 0; i < size; ++i)
+            parents[i] = i;
+        for (int i = 0; i < size; ++i)
+            for (int j = i + 1; j < size; ++j)
+                if (DetectionPartitionSimilar(objects[i].rect, objects[j].rect, sizeDifferenceMax))
+                    parents[DetectionPartitionRoot(parents, i)] = DetectionPartitionRoot(parents, j);
+        std::vector<int> classes(size, -1);
+        int count = 0;
+        labels.resize(size);
+        for (int i = 0; i < size; ++i)
+        {
+            int root = DetectionPartitionRoot(parents, i);
+            if (classes[root] < 0)
+                classes[root] = count++;
+            labels[i] = classes[root];
+        }
+        return count;
+    }
+
+    static bool DetectionPartitionAutoTest(const Objects & objects, double sizeDifferenceMax, const String & desc)
+    {
+        TEST_LOG_SS(Info, "Test Detection::Partition for " << objects.size() << " " << desc << " objects and sizeDifferenceMax = " << sizeDifferenceMax << ".");
+
+        std::vector<int> labels, control;
+        int classes = Detection::Partition(objects, labels, sizeDifferenceMax);
+        int controlClasses = DetectionPartitionControl(objects, control, sizeDifferenceMax);
+        if (classes != controlClasses || labels != control)
+        {
+            TEST_LOG_SS(Error, "Detection::Partition gives " << classes << " classes instead of " << controlClasses << " !");
+            return false;
+        }
+        return true;
+    }
+
+    static Objects DetectionPartitionObjects(size_t count, size_t clusters, int spread, int sizeMin, int sizeRange)
+    {
+        Objects objects;
+        std::vector<Detection::Rect> centers(clusters);
+        for (size_t i = 0; i < clusters; ++i)
+        {
+            int size = sizeMin + Random(sizeRange), x = Random(W * 2) - W / 2, y = Random(H * 2) - H / 2;
+            centers[i] = Detection::Rect(x, y, x + size, y + size);
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Detection::Rect & c = centers[Random((int)clusters)];
+            int dx = Random(spread * 2 + 1) - spread, dy = Random(spread * 2 + 1) - spread, ds = Random(spread + 1);
+            objects.push_back(Detection::Object(Detection::Rect(c.left + dx, c.top + dy, c.right + dx + ds, c.bottom + dy + ds), 1, 0));
+        }
+        return objects;
+    }
+
+    bool DetectionPartitionAutoTest()
+    {
+        bool result = true;
+
+        const double sizeDifferenceMaxs[] = { 0.0, 0.1, 0.2, 0.5 };
+        for (size_t s = 0; s < 4 && result; ++s)
+        {
+            double sdm = sizeDifferenceMaxs[s];
+            result = result && DetectionPartitionAutoTest(Objects(), sdm, "empty");
+            result = result && DetectionPartitionAutoTest(DetectionPartitionObjects(1, 1, 0, 20, 100), sdm, "single");
+            result = result && DetectionPartitionAutoTest(DetectionPartitionObjects(2000, 2000, 0, 10, 400), sdm, "scattered");
+            result = result && DetectionPartitionAutoTest(DetectionPartitionObjects(2000, 10, 3, 20, 100), sdm, "clustered");
+            result = result && DetectionPartitionAutoTest(DetectionPartitionObjects(1000, 3, 0, 20, 100), sdm, "duplicated");
+            result = result && DetectionPartitionAutoTest(DetectionPartitionObjects(3000, 1, 10, 20, 1), sdm, "dense");
+        }
+
+        return result;
+    }
 }
 
@@ -26,6 +26,9 @@
 #include "Test/TestData.h"
 #include "Test/TestTensor.h"
 
+#include "Simd/SimdGemm32fPacked.h"
+#include "Simd/SimdGemm8iPacked.h"
+
 namespace Test
 {
     namespace
@@ -187,6 +190,18 @@ namespace Test
         result = result && Gemm32fAutoTest(0, 0, 1, 192, 192, f1, f2);
         //result = result && Gemm32fAutoTest(0, 0, 10, 192, 192, f1, f2);
 
+        result = result && Gemm32fAutoTest(0, 0, 1, 1, 1, f1, f2);
+        result = result && Gemm32fAutoTest(0, 0, 1, 64, 64, f1, f2);
+        result = result && Gemm32fAutoTest(0, 0, 4, 16, 16, f1, f2);
+        result = result && Gemm32fAutoTest(0, 0, 7, 9, 13, f1, f2);
+        result = result && Gemm32fAutoTest(0, 0, 16, 16, 16, f1, f2);
+        result = result && Gemm32fAutoTest(0, 0, 17, 33, 31, f1, f2);
+        result = result && Gemm32fAutoTest(0, 0, 32, 32, 32, f1, f2);
+        result = result && Gemm32fAutoTest(0, 0, 64, 64, 64, f1, f2);
+        result = result && Gemm32fAutoTest(0, 0, 3, 64, 5, f1, f2);
+        result = result && Gemm32fAutoTest(0, 0, 64, 3, 64, f1, f2);
+        result = result && Gemm32fAutoTest(0, 0, 1, 27, 64, f1, f2);
+
         return result;
     }
 
@@ -291,4 +306,336 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------
+
+    bool Gemm32fStridedBatchedAutoTest(int transB, size_t batch, size_t M, size_t N, size_t K)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdGemm32f" << (transB ? "NT" : "NN") << "StridedBatched [" << batch << ", " << M << ", " << N << ", " << K << "].");
+
+        size_t lda = K + 3, ldb = (transB ? K : N) + 5, ldc = N + 7;
+        size_t strideA = M * lda, strideB = (transB ? N : K) * ldb, strideC = M * ldc;
+        Tensor32f A({ batch * strideA }), B({ batch * strideB }), srcC({ batch * strideC }), dstC1({ batch * strideC }), dstC2({ batch * strideC });
+
+        const float alpha = 1.5f, beta = 0.5f;
+        FillRandom(A.Data(), A.Size(), -1.0, 1.0f);
+        FillRandom(B.Data(), B.Size(), -1.0, 1.0f);
+        FillRandom(srcC.Data(), srcC.Size(), -1.0, 1.0f);
+        memcpy(dstC1.Data(), srcC.Data(), srcC.Size() * sizeof(float));
+        memcpy(dstC2.Data(), srcC.Data(), srcC.Size() * sizeof(float));
+
+        for (size_t b = 0; b < batch; ++b)
+        {
+            if(transB)
+                Simd::Base::Gemm32fNT(M, N, K, &alpha, A.Data() + b * strideA, lda, B.Data() + b * strideB, ldb, &beta, dstC1.Data() + b * strideC, ldc);
+            else
+                Simd::Base::Gemm32fNN(M, N, K, &alpha, A.Data() + b * strideA, lda, B.Data() + b * strideB, ldb, &beta, dstC1.Data() + b * strideC, ldc);
+        }
+
+        if (transB)
+            SimdGemm32fNTStridedBatched(batch, M, N, K, &alpha, A.Data(), lda, strideA, B.Data(), ldb, strideB, &beta, dstC2.Data(), ldc, strideC);
+        else
+            SimdGemm32fNNStridedBatched(batch, M, N, K, &alpha, A.Data(), lda, strideA, B.Data(), ldb, strideB, &beta, dstC2.Data(), ldc, strideC);
+
+        result = result && Compare(dstC1, dstC2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool Gemm32fStridedBatchedAutoTest()
+    {
+        bool result = true;
+
+        result = result && Gemm32fStridedBatchedAutoTest(0, 12, 197, 64, 197);
+        result = result && Gemm32fStridedBatchedAutoTest(1, 12, 197, 197, 64);
+        result = result && Gemm32fStridedBatchedAutoTest(1, 5, 17, 33, 19);
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        struct FuncGP
+        {
+            typedef void*(*FuncPtr)(size_t M, size_t N, size_t K, SimdConvolutionActivationType activation);
+
+            FuncPtr func;
+            String description;
+
+            FuncGP(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(size_t M, size_t N, size_t K, SimdConvolutionActivationType activation)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << M << "-" << N << "-" << K << "-" << int(activation) << "]";
+                description = ss.str();
+            }
+
+            void Call(void * context, size_t M, const Tensor32f & A, float beta, const Tensor32f & srcC, Tensor32f & dstC) const
+            {
+                memcpy(dstC.Data(), srcC.Data(), sizeof(float) * srcC.Size());
+                TEST_PERFORMANCE_TEST(description);
+                SimdGemm32fPackedRun(context, M, A.Data(), A.Axis(1), &beta, dstC.Data(), dstC.Axis(1));
+            }
+        };
+    }
+
+#define FUNC_GP(function) FuncGP(function, #function)
+
+    bool Gemm32fPackedAutoTest(size_t M, size_t N, size_t K, SimdConvolutionActivationType activation, float beta, FuncGP f1, FuncGP f2)
+    {
+        bool result = true;
+
+        f1.Update(M, N, K, activation);
+        f2.Update(M, N, K, activation);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << beta << "].");
+
+        Tensor32f A({ M, K + 3 });
+        Tensor32f B({ K, N });
+        Tensor32f bias({ N });
+        Tensor32f params({ N });
+        Tensor32f srcC({ M, N + 5 });
+        Tensor32f dstC1({ M, N + 5 });
+        Tensor32f dstC2({ M, N + 5 });
+
+        FillRandom(A.Data(), A.Size(), -1.0, 1.0f);
+        FillRandom(B.Data(), B.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(srcC.Data(), srcC.Size(), -1.0, 1.0f);
+        if (activation == SimdConvolutionActivationPrelu)
+            FillRandom(params.Data(), params.Size(), -1.0, 1.0f);
+        else
+        {
+            params.Data()[0] = 0.1f;
+            params.Data()[1] = 0.9f;
+        }
+
+        void * context1 = f1.func(M, N, K, activation);
+        void * context2 = f2.func(M, N, K, activation);
+
+        SimdGemm32fPackedSetParams(context1, B.Data(), bias.Data(), params.Data());
+        SimdGemm32fPackedSetParams(context2, B.Data(), bias.Data(), params.Data());
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, M, A, beta, srcC, dstC1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, M, A, beta, srcC, dstC2));
+
+        result = result && Compare(dstC1, dstC2, EPS, true, 32, DifferenceBoth);
+
+        for (size_t m = M / 3 + 1; result && m < M; m += M / 3 + 1)
+        {
+            f1.Call(context1, m, A, beta, srcC, dstC1);
+            f2.Call(context2, m, A, beta, srcC, dstC2);
+            result = result && Compare(dstC1, dstC2, EPS, true, 32, DifferenceBoth);
+        }
+
+        SimdRelease(context1);
+        SimdRelease(context2);
+
+        return result;
+    }
+
+    bool Gemm32fPackedAutoTest(const FuncGP & f1, const FuncGP & f2)
+    {
+        bool result = true;
+
+        const SimdConvolutionActivationType a0 = SimdConvolutionActivationIdentity, a1 = SimdConvolutionActivationRelu, a2 = SimdConvolutionActivationPrelu, a3 = SimdConvolutionActivationRestrictRange;
+
+        result = result && Gemm32fPackedAutoTest(64, 512, 256, a0, 0.0f, f1, f2);
+        result = result && Gemm32fPackedAutoTest(17, 100, 300, a1, 1.0f, f1, f2);
+        result = result && Gemm32fPackedAutoTest(128, 49, 127, a2, 0.5f, f1, f2);
+        result = result && Gemm32fPackedAutoTest(9, 1000, 64, a3, 0.0f, f1, f2);
+        result = result && Gemm32fPackedAutoTest(31, 7, 33, a1, 0.0f, f1, f2);
+
+        return result;
+    }
+
+    bool Gemm32fPackedAutoTest()
+    {
+        bool result = true;
+
+        result = result && Gemm32fPackedAutoTest(FUNC_GP(Simd::Base::Gemm32fPackedInit), FUNC_GP(SimdGemm32fPackedInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && Gemm32fPackedAutoTest(FUNC_GP(Simd::Sse2::Gemm32fPackedInit), FUNC_GP(SimdGemm32fPackedInit));
+#endif 
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && Gemm32fPackedAutoTest(FUNC_GP(Simd::Avx::Gemm32fPackedInit), FUNC_GP(SimdGemm32fPackedInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Gemm32fPackedAutoTest(FUNC_GP(Simd::Avx2::Gemm32fPackedInit), FUNC_GP(SimdGemm32fPackedInit));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && Gemm32fPackedAutoTest(FUNC_GP(Simd::Avx512f::Gemm32fPackedInit), FUNC_GP(SimdGemm32fPackedInit));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Gemm32fPackedAutoTest(FUNC_GP(Simd::Neon::Gemm32fPackedInit), FUNC_GP(SimdGemm32fPackedInit));
+#endif 
+
+        return result;
+    }
+#endif
+
+    //-----------------------------------------------------------------------
+
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        struct FuncGI
+        {
+            typedef void*(*FuncPtr)(size_t M, size_t N, size_t K, SimdTensorDataType dstT, SimdSynetCompatibilityType compatibility);
+
+            FuncPtr func;
+            String description;
+
+            FuncGI(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(size_t M, size_t N, size_t K, SimdTensorDataType dstT, SimdSynetCompatibilityType compatibility, bool zero)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << M << "-" << N << "-" << K << "-" << int(dstT) << "-" << int(compatibility) << "-" << zero << "]";
+                description = ss.str();
+            }
+
+            void Call(void * context, size_t M, const Tensor8u & A, Tensor8u & C, size_t ldc) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                SimdGemm8iPackedRun(context, M, A.Data(), A.Axis(1), C.Data(), ldc);
+            }
+        };
+    }
+
+#define FUNC_GI(function) FuncGI(function, #function)
+
+    bool Gemm8iPackedAutoTest(size_t M, size_t N, size_t K, SimdTensorDataType dstT, SimdSynetCompatibilityType compatibility, bool zero, FuncGI f1, FuncGI f2)
+    {
+        bool result = true;
+
+        f1.Update(M, N, K, dstT, compatibility, zero);
+        f2.Update(M, N, K, dstT, compatibility, zero);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << ".");
+
+        const size_t size = dstT == SimdTensorData8u ? 1 : 4, ldc = N + 5;
+        Tensor8u A({ M, K + 3 });
+        Tensor8i B({ K, N });
+        Tensor8i bZero({ N });
+        Tensor32f scale({ N });
+        Tensor32f shift({ N });
+        Tensor8u C1({ M, ldc * size });
+        Tensor8u C2({ M, ldc * size });
+
+        FillRandom(A);
+        FillRandom(B);
+        FillRandom(bZero, -8, 8);
+        FillRandom(scale.Data(), scale.Size(), 0.5f / K / 64.0f, 1.5f / K / 64.0f);
+        FillRandom(shift.Data(), shift.Size(), 64.0f, 192.0f);
+        uint8_t aZero = zero ? 128 : 0;
+
+        void * context1 = f1.func(M, N, K, dstT, compatibility);
+        void * context2 = f2.func(M, N, K, dstT, compatibility);
+
+        SimdGemm8iPackedSetParams(context1, B.Data(), aZero, zero ? bZero.Data() : NULL, scale.Data(), shift.Data());
+        SimdGemm8iPackedSetParams(context2, B.Data(), aZero, zero ? bZero.Data() : NULL, scale.Data(), shift.Data());
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        for (size_t m = M; result && m > 0; m = m > M / 3 + 1 ? m - M / 3 - 1 : 0)
+        {
+            Fill(C1, uint8_t(1));
+            Fill(C2, uint8_t(2));
+
+            if (m == M)
+            {
+                TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, m, A, C1, ldc));
+
+                TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, m, A, C2, ldc));
+            }
+            else
+            {
+                f1.Call(context1, m, A, C1, ldc);
+                f2.Call(context2, m, A, C2, ldc);
+            }
+
+            for (size_t i = m; i < M; ++i)
+                memcpy(C2.Data({ i, 0 }), C1.Data({ i, 0 }), ldc * size);
+            for (size_t i = 0; i < m; ++i)
+                memcpy(C2.Data({ i, N * size }), C1.Data({ i, N * size }), (ldc - N) * size);
+
+            if (dstT == SimdTensorData32f)
+            {
+                Tensor32f c1({ M, ldc }), c2({ M, ldc });
+                memcpy(c1.Data(), C1.Data(), C1.Size());
+                memcpy(c2.Data(), C2.Data(), C2.Size());
+                result = result && Compare(c1, c2, EPS, true, 32, DifferenceBoth);
+            }
+            else
+                result = result && Compare(C1, C2, dstT == SimdTensorData8u ? 1 : 0, true, 32);
+        }
+
+        SimdRelease(context1);
+        SimdRelease(context2);
+
+        return result;
+    }
+
+    bool Gemm8iPackedAutoTest(const FuncGI & f1, const FuncGI & f2)
+    {
+        bool result = true;
+
+        const SimdTensorDataType i = SimdTensorData32i, f = SimdTensorData32f, u = SimdTensorData8u;
+        const SimdSynetCompatibilityType p = SimdSynetCompatibility8iPrecise, o = SimdSynetCompatibility8iOverflow;
+
+        result = result && Gemm8iPackedAutoTest(64, 512, 256, i, p, false, f1, f2);
+        result = result && Gemm8iPackedAutoTest(17, 100, 301, f, p, true, f1, f2);
+        result = result && Gemm8iPackedAutoTest(128, 49, 127, u, p, true, f1, f2);
+        result = result && Gemm8iPackedAutoTest(9, 1000, 64, u, o, false, f1, f2);
+        result = result && Gemm8iPackedAutoTest(31, 7, 33, i, o, true, f1, f2);
+
+        return result;
+    }
+
+    bool Gemm8iPackedAutoTest()
+    {
+        bool result = true;
+
+        result = result && Gemm8iPackedAutoTest(FUNC_GI(Simd::Base::Gemm8iPackedInit), FUNC_GI(SimdGemm8iPackedInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Gemm8iPackedAutoTest(FUNC_GI(Simd::Avx2::Gemm8iPackedInit), FUNC_GI(SimdGemm8iPackedInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Gemm8iPackedAutoTest(FUNC_GI(Simd::Avx512bw::Gemm8iPackedInit), FUNC_GI(SimdGemm8iPackedInit));
+#endif 
+
+#ifdef SIMD_AVX512VNNI_ENABLE
+        if (Simd::Avx512vnni::Enable)
+            result = result && Gemm8iPackedAutoTest(FUNC_GI(Simd::Avx512vnni::Gemm8iPackedInit), FUNC_GI(SimdGemm8iPackedInit));
+#endif 
+
+        return result;
+    }
+#endif
 }
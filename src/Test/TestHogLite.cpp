@@ -26,6 +26,8 @@
 #include "Test/TestData.h"
 #include "Test/TestString.h"
 
+#include "Simd/SimdHogDetector.hpp"
+
 namespace Test
 {
     void FillCircle(View & view)
@@ -1132,4 +1134,99 @@ namespace Test
     {
         return HogLiteCreateMaskDataTest(create, DW, DH, 7, 2, 0.5f, FUNC_HLCM(SimdHogLiteCreateMask));
     }
+
+    //-----------------------------------------------------------------------------
+
+    typedef Simd::HogDetector<Simd::Allocator> HogDetector;
+
+    bool HogDetectorSpecialTest(const View & image, const std::vector<float> & filter, size_t width, size_t height, 
+        float threshold, const HogDetector::Rect & control, const HogDetector::Size & window, ptrdiff_t threadNumber)
+    {
+        HogDetector detector;
+        detector.SetFilter(filter.data(), width, height, -0.1f);
+        detector.Init(image.Size(), 1.2, window, window, threadNumber);
+
+        HogDetector::Objects objects;
+        double time = GetTime();
+        detector.Detect(image, objects, threshold);
+        TEST_LOG_SS(Info, "HogDetector::Detect for " << threadNumber << " threads : " << (GetTime() - time) * 1000 << " ms, " << objects.size() << " objects.");
+
+        // Objects are sorted by score: resized features of noise can give weaker responses above threshold.
+        if (objects.empty() || objects[0].rect != control)
+        {
+            TEST_LOG_SS(Error, "HogDetector can't find planted object at (" << control.left << ", " << control.top << ", " << control.right << ", " << control.bottom << ")!");
+            return false;
+        }
+        return true;
+    }
+
+    bool HogDetectorSpecialTest(const View & image, size_t level, ptrdiff_t threadNumber)
+    {
+        const size_t cell = 8, featureSize = 16, width = 6, height = 8;
+        const double scaleFactor = 1.2;
+
+        size_t featureW = image.width / cell - 2, featureH = image.height / cell - 2, stride = featureW * featureSize;
+        std::vector<float> features(stride * featureH);
+        Simd::HogLiteExtractFeatures(image, cell, features.data(), stride);
+
+        double scale = 1.0;
+        for (size_t i = 0; i < level; ++i)
+            scale *= scaleFactor;
+        size_t levelW = Simd::Round(featureW / scale), levelH = Simd::Round(featureH / scale), levelStride = levelW * featureSize;
+        std::vector<float> levelFeatures(features);
+        if (level)
+        {
+            levelFeatures.resize(levelStride * levelH);
+            SimdHogLiteResizeFeatures(features.data(), stride, featureW, featureH, featureSize, levelFeatures.data(), levelStride, levelW, levelH);
+        }
+        double scaleX = double(featureW) / double(levelW), scaleY = double(featureH) / double(levelH);
+
+        size_t col = (levelW - width) * 2 / 3, row = (levelH - height) / 3;
+        std::vector<float> filter(width * height * featureSize);
+        float mean = 0, response = 0;
+        for (size_t y = 0; y < height; ++y)
+            for (size_t x = 0; x < width * featureSize; ++x)
+                mean += filter[y * width * featureSize + x] = levelFeatures[(row + y) * levelStride + col * featureSize + x];
+        mean /= filter.size();
+        for (size_t y = 0; y < height; ++y)
+        {
+            for (size_t x = 0; x < width * featureSize; ++x)
+            {
+                filter[y * width * featureSize + x] -= mean;
+                response += filter[y * width * featureSize + x] * levelFeatures[(row + y) * levelStride + col * featureSize + x];
+            }
+        }
+
+        HogDetector::Rect control(Simd::Round((col + 1) * (scaleX * cell)), Simd::Round((row + 1) * (scaleY * cell)),
+            Simd::Round((col + 1 + width) * (scaleX * cell)), Simd::Round((row + 1 + height) * (scaleY * cell)));
+
+        TEST_LOG_SS(Info, "HogDetector: planted object at level " << level << " (scale " << scaleX << " x " << scaleY << ").");
+
+        // The filter is cut from features of this level, so other levels are excluded by size of detection window.
+        HogDetector::Size window = HogDetector::Size(width * cell, height * cell) * scale;
+
+        return HogDetectorSpecialTest(image, filter, width, height, response * 0.8f, control, window, threadNumber);
+    }
+
+    bool HogDetectorSpecialTest()
+    {
+        bool result = true;
+
+        View image(std::max(W, 256), std::max(H, 192), View::Gray8);
+        FillRandom(image);
+
+        result = result && HogDetectorSpecialTest(image, 0, 1);
+
+        result = result && HogDetectorSpecialTest(image, 0, -1);
+
+        View small(256, 192, View::Gray8);
+        FillRandom(small);
+
+        // 30x22 features are resized to 25x18 and to 21x15: scales of these levels along X and Y are different.
+        result = result && HogDetectorSpecialTest(small, 1, 1);
+
+        result = result && HogDetectorSpecialTest(small, 2, -1);
+
+        return result;
+    }
 }
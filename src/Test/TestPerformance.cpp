@@ -419,11 +419,11 @@ namespace Test
         for (FunctionStatisticMap::const_iterator it = functions.begin(); it != functions.end(); ++it)
             AddToCommon(it->second, enable, common);
 
-        size_t size = 0;
+        size_t size = 0, rels = 0;
         for (size_t i = 0; i < enable.Size(); ++i)
             if (enable[i])
-                size++;
-        TablePtr table(new Table(size*(align ? 4 : 3) - 3, 1 + functions.size()));
+                size++, rels += (i > 1 && enable[1]) ? 2 : 0;
+        TablePtr table(new Table(1 + size * (align ? 2 : 1) + rels, 1 + functions.size()));
         AddHeader(*table, names, enable, align);
         size_t row = 0;
         table->SetRowProp(row, true, true);
@@ -375,6 +375,385 @@ namespace Test
 
     //-------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncNorm
+        {
+            typedef void(*FuncPtr)(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+                const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncNorm(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t batch, size_t channels, size_t spatial, size_t group, SimdTensorFormatType format, SimdConvolutionActivationType activation, bool affine)
+            {
+                desc = desc + "[" + ToString(batch) + "x" + ToString(channels) + "x" + ToString(spatial) + (group ? "-" + ToString(group) : String()) + 
+                    "-" + ToString(format) + "-" + ToString((int)activation) + (affine ? "" : "-0") + "]";
+            }
+
+            void Call(const Tensor32f& src, size_t group, const float* scale, const float* shift, float eps, SimdTensorFormatType format, 
+                SimdConvolutionActivationType activation, const float* params, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), src.Axis(0), src.Axis(1), src.Axis(2), group, scale, shift, &eps, format, activation, params, dst.Data());
+            }
+        };
+
+        typedef void(*SynetLayerNormalize32fPtr)(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst);
+
+        template<SynetLayerNormalize32fPtr func> void SynetLayerNormalize32f(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, 
+            const float* scale, const float* shift, const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* dst)
+        {
+            func(src, batch, channels, spatial, scale, shift, eps, format, activation, params, dst);
+        }
+    }
+
+#define FUNC_GN(function) FuncNorm(function, #function)
+#define FUNC_LN(function) FuncNorm(SynetLayerNormalize32f<function>, #function)
+
+    bool SynetNormalize32fAutoTest(size_t batch, size_t channels, size_t spatial, size_t group, SimdTensorFormatType format, SimdConvolutionActivationType activation, bool affine, FuncNorm f1, FuncNorm f2)
+    {
+        bool result = true;
+
+        f1.Update(batch, channels, spatial, group, format, activation, affine);
+        f2.Update(batch, channels, spatial, group, format, activation, affine);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src({ batch, channels, spatial }), scale({ channels }), shift({ channels }), params({ Simd::Max<size_t>(channels, 2) });
+        FillRandom(src.Data(), src.Size(), -1.0, 3.0f);
+        FillRandom(scale.Data(), scale.Size(), 0.5, 1.5f);
+        FillRandom(shift.Data(), shift.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0, 1.0f);
+        if (activation == SimdConvolutionActivationRestrictRange)
+            params.Data()[0] = -1.0f, params.Data()[1] = 1.0f;
+        else if (activation == SimdConvolutionActivationHswish)
+            params.Data()[0] = 3.0f, params.Data()[1] = 1.0f / 6.0f;
+        else if (activation == SimdConvolutionActivationHardSigmoid)
+            params.Data()[0] = 1.0f / 6.0f, params.Data()[1] = 0.5f;
+        const float * pScale = affine ? scale.Data() : NULL, * pShift = affine ? shift.Data() : NULL;
+        float eps = 0.00001f;
+
+        Tensor32f dst1({ batch, channels, spatial });
+        Tensor32f dst2({ batch, channels, spatial });
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, group, pScale, pShift, eps, format, activation, params.Data(), dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, group, pScale, pShift, eps, format, activation, params.Data(), dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetGroupNormalize32fAutoTest(const FuncNorm& f1, const FuncNorm& f2)
+    {
+        bool result = true;
+
+        const SimdTensorFormatType nchw = SimdTensorFormatNchw, nhwc = SimdTensorFormatNhwc;
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu,
+            aPr = SimdConvolutionActivationPrelu, aHs = SimdConvolutionActivationHswish, aRr = SimdConvolutionActivationRestrictRange;
+
+        result = result && SynetNormalize32fAutoTest(2, 64, 56 * 56, 32, nchw, aRe, true, f1, f2);
+        result = result && SynetNormalize32fAutoTest(2, 64, 56 * 56, 32, nhwc, aRe, true, f1, f2);
+        result = result && SynetNormalize32fAutoTest(1, 30, 333, 3, nchw, aPr, true, f1, f2);
+        result = result && SynetNormalize32fAutoTest(1, 30, 333, 3, nhwc, aPr, true, f1, f2);
+        result = result && SynetNormalize32fAutoTest(2, 35, 99, 35, nchw, aHs, true, f1, f2);
+        result = result && SynetNormalize32fAutoTest(2, 35, 99, 35, nhwc, aRr, true, f1, f2);
+        result = result && SynetNormalize32fAutoTest(1, 17, 47, 1, nhwc, aId, false, f1, f2);
+
+        return result;
+    }
+
+    bool SynetGroupNormalize32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetGroupNormalize32fAutoTest(FUNC_GN(Simd::Base::SynetGroupNormalize32f), FUNC_GN(SimdSynetGroupNormalize32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetGroupNormalize32fAutoTest(FUNC_GN(Simd::Sse2::SynetGroupNormalize32f), FUNC_GN(SimdSynetGroupNormalize32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetGroupNormalize32fAutoTest(FUNC_GN(Simd::Avx2::SynetGroupNormalize32f), FUNC_GN(SimdSynetGroupNormalize32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetGroupNormalize32fAutoTest(FUNC_GN(Simd::Avx512f::SynetGroupNormalize32f), FUNC_GN(SimdSynetGroupNormalize32f));
+#endif 
+
+        return result;
+    }
+
+    bool SynetLayerNormalize32fAutoTest(const FuncNorm& f1, const FuncNorm& f2)
+    {
+        bool result = true;
+
+        const SimdTensorFormatType nchw = SimdTensorFormatNchw, nhwc = SimdTensorFormatNhwc;
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu,
+            aPr = SimdConvolutionActivationPrelu, aHs = SimdConvolutionActivationHswish, aEl = SimdConvolutionActivationElu;
+
+        result = result && SynetNormalize32fAutoTest(1, 768, 197, 0, nhwc, aId, true, f1, f2);
+        result = result && SynetNormalize32fAutoTest(1, 768, 197, 0, nchw, aId, true, f1, f2);
+        result = result && SynetNormalize32fAutoTest(2, 35, 111, 0, nhwc, aPr, true, f1, f2);
+        result = result && SynetNormalize32fAutoTest(2, 35, 111, 0, nchw, aPr, true, f1, f2);
+        result = result && SynetNormalize32fAutoTest(3, 64, 1001, 0, nchw, aHs, false, f1, f2);
+        result = result && SynetNormalize32fAutoTest(3, 63, 17, 0, nhwc, aEl, false, f1, f2);
+        result = result && SynetNormalize32fAutoTest(1, 256, 49, 0, nhwc, aRe, true, f1, f2);
+
+        return result;
+    }
+
+    bool SynetLayerNormalize32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetLayerNormalize32fAutoTest(FUNC_LN(Simd::Base::SynetLayerNormalize32f), FUNC_LN(SimdSynetLayerNormalize32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetLayerNormalize32fAutoTest(FUNC_LN(Simd::Sse2::SynetLayerNormalize32f), FUNC_LN(SimdSynetLayerNormalize32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetLayerNormalize32fAutoTest(FUNC_LN(Simd::Avx2::SynetLayerNormalize32f), FUNC_LN(SimdSynetLayerNormalize32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetLayerNormalize32fAutoTest(FUNC_LN(Simd::Avx512f::SynetLayerNormalize32f), FUNC_LN(SimdSynetLayerNormalize32f));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncL2N
+        {
+            typedef void(*FuncPtr)(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+                SimdBool acrossSpatial, const float* eps, float* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncL2N(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdBool acrossSpatial)
+            {
+                desc = desc + "[" + ToString(batch) + "x" + ToString(channels) + "x" + ToString(spatial) + "-" + ToString(format) + "-" + ToString(acrossSpatial) + "]";
+            }
+
+            void Call(const Tensor32f& src, SimdTensorFormatType format, SimdBool acrossSpatial, float eps, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), src.Axis(0), src.Axis(1), src.Axis(2), format, acrossSpatial, &eps, dst.Data());
+            }
+        };
+    }
+
+#define FUNC_L2N(function) FuncL2N(function, #function)
+
+    bool SynetL2Normalize32fAutoTest(size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdBool acrossSpatial, FuncL2N f1, FuncL2N f2)
+    {
+        bool result = true;
+
+        f1.Update(batch, channels, spatial, format, acrossSpatial);
+        f2.Update(batch, channels, spatial, format, acrossSpatial);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src({ batch, channels, spatial });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+        float eps = 0.000001f;
+
+        Tensor32f dst1({ batch, channels, spatial });
+        Tensor32f dst2({ batch, channels, spatial });
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, format, acrossSpatial, eps, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, format, acrossSpatial, eps, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetL2Normalize32fAutoTest(const FuncL2N& f1, const FuncL2N& f2)
+    {
+        bool result = true;
+
+        const SimdTensorFormatType nchw = SimdTensorFormatNchw, nhwc = SimdTensorFormatNhwc;
+
+        result = result && SynetL2Normalize32fAutoTest(10, 512, 1, nchw, SimdFalse, f1, f2);
+        result = result && SynetL2Normalize32fAutoTest(1, 127, 999, nchw, SimdFalse, f1, f2);
+        result = result && SynetL2Normalize32fAutoTest(1, 127, 999, nhwc, SimdFalse, f1, f2);
+        result = result && SynetL2Normalize32fAutoTest(2, 64, 1001, nchw, SimdTrue, f1, f2);
+        result = result && SynetL2Normalize32fAutoTest(2, 64, 1001, nhwc, SimdTrue, f1, f2);
+
+        return result;
+    }
+
+    bool SynetL2Normalize32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetL2Normalize32fAutoTest(FUNC_L2N(Simd::Base::SynetL2Normalize32f), FUNC_L2N(SimdSynetL2Normalize32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetL2Normalize32fAutoTest(FUNC_L2N(Simd::Sse2::SynetL2Normalize32f), FUNC_L2N(SimdSynetL2Normalize32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetL2Normalize32fAutoTest(FUNC_L2N(Simd::Avx2::SynetL2Normalize32f), FUNC_L2N(SimdSynetL2Normalize32f));
+#endif
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetL2Normalize32fAutoTest(FUNC_L2N(Simd::Avx512f::SynetL2Normalize32f), FUNC_L2N(SimdSynetL2Normalize32f));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    SIMD_INLINE String ToString(SimdSynetReduceType type)
+    {
+        switch (type)
+        {
+        case SimdSynetReduceL2:
+            return "L2";
+        case SimdSynetReduceMax:
+            return "Max";
+        case SimdSynetReduceMean:
+            return "Mean";
+        case SimdSynetReduceMin:
+            return "Min";
+        case SimdSynetReduceSum:
+            return "Sum";
+        }
+        assert(0);
+        return "???";
+    }
+
+    namespace
+    {
+        struct FuncRed
+        {
+            typedef void(*FuncPtr)(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+                SimdSynetReduceType type, SimdBool reduceChannels, SimdBool reduceSpatial, float* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncRed(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdSynetReduceType type, SimdBool reduceChannels, SimdBool reduceSpatial)
+            {
+                desc = desc + "[" + ToString(batch) + "x" + ToString(channels) + "x" + ToString(spatial) + "-" + ToString(format) + "-" + ToString(type) + 
+                    "-" + (reduceChannels ? "C" : "") + (reduceSpatial ? "S" : "") + "]";
+            }
+
+            void Call(const Tensor32f& src, SimdTensorFormatType format, SimdSynetReduceType type, SimdBool reduceChannels, SimdBool reduceSpatial, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), src.Axis(0), src.Axis(1), src.Axis(2), format, type, reduceChannels, reduceSpatial, dst.Data());
+            }
+        };
+    }
+
+#define FUNC_RED(function) FuncRed(function, #function)
+
+    bool SynetReduceLayerForwardAutoTest(size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdSynetReduceType type, 
+        SimdBool reduceChannels, SimdBool reduceSpatial, FuncRed f1, FuncRed f2)
+    {
+        bool result = true;
+
+        f1.Update(batch, channels, spatial, format, type, reduceChannels, reduceSpatial);
+        f2.Update(batch, channels, spatial, format, type, reduceChannels, reduceSpatial);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src({ batch, channels, spatial });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        size_t size = batch * (reduceChannels ? 1 : channels) * (reduceSpatial ? 1 : spatial);
+        Tensor32f dst1({ size });
+        Tensor32f dst2({ size });
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, format, type, reduceChannels, reduceSpatial, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, format, type, reduceChannels, reduceSpatial, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetReduceLayerForwardAutoTest(const FuncRed& f1, const FuncRed& f2)
+    {
+        bool result = true;
+
+        for (int type = (int)SimdSynetReduceL2; type <= (int)SimdSynetReduceSum; type++)
+        {
+            for (int format = (int)SimdTensorFormatNchw; format <= (int)SimdTensorFormatNhwc; format++)
+            {
+                SimdSynetReduceType t = (SimdSynetReduceType)type;
+                SimdTensorFormatType f = (SimdTensorFormatType)format;
+                result = result && SynetReduceLayerForwardAutoTest(2, 255, 197, f, t, SimdTrue, SimdFalse, f1, f2);
+                result = result && SynetReduceLayerForwardAutoTest(2, 255, 197, f, t, SimdFalse, SimdTrue, f1, f2);
+                result = result && SynetReduceLayerForwardAutoTest(2, 255, 197, f, t, SimdTrue, SimdTrue, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool SynetReduceLayerForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetReduceLayerForwardAutoTest(FUNC_RED(Simd::Base::SynetReduceLayerForward), FUNC_RED(SimdSynetReduceLayerForward));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetReduceLayerForwardAutoTest(FUNC_RED(Simd::Sse2::SynetReduceLayerForward), FUNC_RED(SimdSynetReduceLayerForward));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetReduceLayerForwardAutoTest(FUNC_RED(Simd::Avx2::SynetReduceLayerForward), FUNC_RED(SimdSynetReduceLayerForward));
+#endif
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetReduceLayerForwardAutoTest(FUNC_RED(Simd::Avx512f::SynetReduceLayerForward), FUNC_RED(SimdSynetReduceLayerForward));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
     namespace
     {
         struct FuncLLCC
@@ -649,6 +1028,9 @@ namespace Test
         result = result && SynetSoftmaxLayerForwardAutoTest(50, 10, 100, f1, f2);
         result = result && SynetSoftmaxLayerForwardAutoTest(4856, 3, 1, f1, f2);
         result = result && SynetSoftmaxLayerForwardAutoTest(6666, 3, 1, f1, f2);
+        result = result && SynetSoftmaxLayerForwardAutoTest(128 * 128, 21, 1, f1, f2);
+        result = result && SynetSoftmaxLayerForwardAutoTest(64 * 64, 150, 1, f1, f2);
+        result = result && SynetSoftmaxLayerForwardAutoTest(1, 21, 128 * 128 + 3, f1, f2);
 
         return result;
     }
@@ -684,6 +1066,404 @@ namespace Test
 
     //-------------------------------------------------------------------------
 
+    bool SynetLogSoftmaxLayerForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetSoftmaxLayerForwardAutoTest(FUNC_SM(Simd::Base::SynetLogSoftmaxLayerForward), FUNC_SM(SimdSynetLogSoftmaxLayerForward));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetSoftmaxLayerForwardAutoTest(FUNC_SM(Simd::Sse2::SynetLogSoftmaxLayerForward), FUNC_SM(SimdSynetLogSoftmaxLayerForward));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetSoftmaxLayerForwardAutoTest(FUNC_SM(Simd::Avx2::SynetLogSoftmaxLayerForward), FUNC_SM(SimdSynetLogSoftmaxLayerForward));
+#endif
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetSoftmaxLayerForwardAutoTest(FUNC_SM(Simd::Avx512f::SynetLogSoftmaxLayerForward), FUNC_SM(SimdSynetLogSoftmaxLayerForward));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncSMA
+        {
+            typedef void(*FuncPtr)(const float* src, size_t outer, size_t count, size_t inner, float* dst, uint32_t* index);
+
+            FuncPtr func;
+            String desc;
+
+            FuncSMA(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t outer, size_t count, size_t inner, bool output, bool special)
+            {
+                desc = desc + "[" + ToString(outer) + "-" + ToString(count) + "-" + ToString(inner) + (output ? "" : "-0") + (special ? "-s" : "") + "]";
+            }
+
+            void Call(const Tensor32f& src, Tensor32f& dst, bool output, Tensor32u& index) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), src.Axis(0), src.Axis(1), src.Axis(2), output ? dst.Data() : NULL, index.Data());
+            }
+        };
+    }
+
+#define FUNC_SMA(function) FuncSMA(function, #function)
+
+    bool SynetSoftmaxArgMaxLayerForwardAutoTest(size_t outer, size_t count, size_t inner, bool output, bool special, FuncSMA f1, FuncSMA f2)
+    {
+        bool result = true;
+
+        f1.Update(outer, count, inner, output, special);
+        f2.Update(outer, count, inner, output, special);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src({ outer, count, inner });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+        if (special)
+        {
+            const float inf = std::numeric_limits<float>::infinity(), nan = std::numeric_limits<float>::quiet_NaN();
+            for (size_t o = 0; o < outer; ++o)
+            {
+                for (size_t c = 0; c < count; ++c)
+                {
+                    float* s = src.Data() + (o * count + c) * inner;
+                    for (size_t i = 0; i < inner; ++i)
+                    {
+                        switch (o % 4)
+                        {
+                        case 0: s[i] = -inf; break;
+                        case 1: if (c == (i + o) % count) s[i] = nan; break;
+                        case 2: if (c == 0) s[i] = nan; break;
+                        case 3: if (c % 3 == 1) s[i] = nan; break;
+                        }
+                    }
+                }
+            }
+        }
+
+        Tensor32f dst1({ outer, count, inner });
+        Tensor32f dst2({ outer, count, inner });
+        Tensor32u index1({ outer, inner });
+        Tensor32u index2({ outer, inner });
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, output, index1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, output, index2));
+
+        if (output)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+
+        result = result && Compare(index1, index2, 0, true, 64);
+
+        if (output && result)
+        {
+            Tensor32f inplace;
+            Tensor32u index({ outer, inner });
+            inplace.Clone(src);
+            f1.func(inplace.Data(), outer, count, inner, inplace.Data(), index.Data());
+            result = result && Compare(dst1, inplace, EPS, true, 64, DifferenceAbsolute);
+            result = result && Compare(index1, index, 0, true, 64);
+            inplace.Clone(src);
+            f2.func(inplace.Data(), outer, count, inner, inplace.Data(), index.Data());
+            result = result && Compare(dst2, inplace, EPS, true, 64, DifferenceAbsolute);
+            result = result && Compare(index2, index, 0, true, 64);
+        }
+
+        return result;
+    }
+
+    bool SynetSoftmaxArgMaxLayerForwardAutoTest(const FuncSMA& f1, const FuncSMA& f2)
+    {
+        bool result = true;
+
+        result = result && SynetSoftmaxArgMaxLayerForwardAutoTest(128 * 128, 21, 1, true, false, f1, f2);
+        result = result && SynetSoftmaxArgMaxLayerForwardAutoTest(128 * 128, 21, 1, false, false, f1, f2);
+        result = result && SynetSoftmaxArgMaxLayerForwardAutoTest(1, 21, 128 * 128 + 3, true, false, f1, f2);
+        result = result && SynetSoftmaxArgMaxLayerForwardAutoTest(1, 21, 128 * 128 + 3, false, false, f1, f2);
+        result = result && SynetSoftmaxArgMaxLayerForwardAutoTest(50, 10, 100, true, false, f1, f2);
+        result = result && SynetSoftmaxArgMaxLayerForwardAutoTest(1024, 37, 1, false, true, f1, f2);
+        result = result && SynetSoftmaxArgMaxLayerForwardAutoTest(16, 10, 100, false, true, f1, f2);
+
+        return result;
+    }
+
+    bool SynetSoftmaxArgMaxLayerForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetSoftmaxArgMaxLayerForwardAutoTest(FUNC_SMA(Simd::Base::SynetSoftmaxArgMaxLayerForward), FUNC_SMA(SimdSynetSoftmaxArgMaxLayerForward));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetSoftmaxArgMaxLayerForwardAutoTest(FUNC_SMA(Simd::Sse2::SynetSoftmaxArgMaxLayerForward), FUNC_SMA(SimdSynetSoftmaxArgMaxLayerForward));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetSoftmaxArgMaxLayerForwardAutoTest(FUNC_SMA(Simd::Avx2::SynetSoftmaxArgMaxLayerForward), FUNC_SMA(SimdSynetSoftmaxArgMaxLayerForward));
+#endif
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetSoftmaxArgMaxLayerForwardAutoTest(FUNC_SMA(Simd::Avx512f::SynetSoftmaxArgMaxLayerForward), FUNC_SMA(SimdSynetSoftmaxArgMaxLayerForward));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncSDPA
+        {
+            typedef void(*FuncPtr)(size_t batch, size_t queries, size_t keys, size_t depth, size_t valueDepth,
+                const float* query, const float* key, const float* value, const float* scale, float* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncSDPA(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t batch, size_t queries, size_t keys, size_t depth, size_t valueDepth)
+            {
+                desc = desc + "[" + ToString(batch) + "x" + ToString(queries) + "x" + ToString(keys) + "-" + ToString(depth) + "-" + ToString(valueDepth) + "]";
+            }
+
+            void Call(const Tensor32f& query, const Tensor32f& key, const Tensor32f& value, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(query.Axis(0), query.Axis(1), key.Axis(1), query.Axis(2), value.Axis(2), query.Data(), key.Data(), value.Data(), NULL, dst.Data());
+            }
+        };
+    }
+
+#define FUNC_SDPA(function) FuncSDPA(function, #function)
+
+    bool SynetScaledDotProductAttention32fAutoTest(size_t batch, size_t queries, size_t keys, size_t depth, size_t valueDepth, FuncSDPA f1, FuncSDPA f2)
+    {
+        bool result = true;
+
+        f1.Update(batch, queries, keys, depth, valueDepth);
+        f2.Update(batch, queries, keys, depth, valueDepth);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f query({ batch, queries, depth }), key({ batch, keys, depth }), value({ batch, keys, valueDepth });
+        FillRandom(query.Data(), query.Size(), -3.0, 3.0f);
+        FillRandom(key.Data(), key.Size(), -3.0, 3.0f);
+        FillRandom(value.Data(), value.Size(), -1.0, 1.0f);
+
+        Tensor32f dst1({ batch, queries, valueDepth });
+        Tensor32f dst2({ batch, queries, valueDepth });
+        Fill(dst1.Data(), dst1.Size(), 1.0f);
+        Fill(dst2.Data(), dst2.Size(), 2.0f);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(query, key, value, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(query, key, value, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetScaledDotProductAttention32fAutoTest(const FuncSDPA& f1, const FuncSDPA& f2)
+    {
+        bool result = true;
+
+        result = result && SynetScaledDotProductAttention32fAutoTest(12, 197, 197, 64, 64, f1, f2);
+        result = result && SynetScaledDotProductAttention32fAutoTest(8, 100, 777, 32, 48, f1, f2);
+        result = result && SynetScaledDotProductAttention32fAutoTest(3, 17, 301, 37, 19, f1, f2);
+        result = result && SynetScaledDotProductAttention32fAutoTest(2, 5, 0, 16, 16, f1, f2);
+
+        return result;
+    }
+
+    bool SynetScaledDotProductAttention32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetScaledDotProductAttention32fAutoTest(FUNC_SDPA(Simd::Base::SynetScaledDotProductAttention32f), FUNC_SDPA(SimdSynetScaledDotProductAttention32f));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetScaledDotProductAttention32fAutoTest(FUNC_SDPA(Simd::Avx2::SynetScaledDotProductAttention32f), FUNC_SDPA(SimdSynetScaledDotProductAttention32f));
+#endif
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetScaledDotProductAttention32fAutoTest(FUNC_SDPA(Simd::Avx512f::SynetScaledDotProductAttention32f), FUNC_SDPA(SimdSynetScaledDotProductAttention32f));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    SIMD_INLINE String ToString(SimdSynetBinaryOperation32fType type)
+    {
+        switch (type)
+        {
+        case SimdSynetBinaryOperation32fAdd:
+            return "Add";
+        case SimdSynetBinaryOperation32fDiv:
+            return "Div";
+        case SimdSynetBinaryOperation32fMax:
+            return "Max";
+        case SimdSynetBinaryOperation32fMin:
+            return "Min";
+        case SimdSynetBinaryOperation32fMul:
+            return "Mul";
+        case SimdSynetBinaryOperation32fPow:
+            return "Pow";
+        case SimdSynetBinaryOperation32fSub:
+            return "Sub";
+        }
+        assert(0);
+        return "???";
+    }
+
+    SIMD_INLINE String ToString(const Shape& shape)
+    {
+        std::stringstream ss;
+        ss << "{";
+        for (size_t i = 0; i < shape.size(); ++i)
+            ss << (i ? " " : "") << shape[i];
+        ss << "}";
+        return ss.str();
+    }
+
+    namespace
+    {
+        struct FuncBO
+        {
+            typedef void(*FuncPtr)(const float* a, const size_t* aShape, size_t aCount, const float* b, const size_t* bShape, size_t bCount,
+                SimdSynetBinaryOperation32fType type, float* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncBO(const FuncPtr & f, const String& d) : func(f), desc(d) {}
+
+            void Update(const Shape& a, const Shape& b, SimdSynetBinaryOperation32fType type)
+            {
+                desc = desc + "[" + ToString(a) + "-" + ToString(b) + "-" + ToString(type) + "]";
+            }
+
+            void Call(const Tensor32f& a, const Tensor32f& b, SimdSynetBinaryOperation32fType type, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(a.Data(), a.Shape().data(), a.Count(), b.Data(), b.Shape().data(), b.Count(), type, dst.Data());
+            }
+        };
+    }
+
+#define FUNC_BO(function) FuncBO(function, #function)
+
+    bool SynetBinaryOperation32fLayerForwardAutoTest(const Shape& aShape, const Shape& bShape, SimdSynetBinaryOperation32fType type, FuncBO f1, FuncBO f2)
+    {
+        bool result = true;
+
+        f1.Update(aShape, bShape, type);
+        f2.Update(aShape, bShape, type);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Shape dstShape(Simd::Max(aShape.size(), bShape.size()), 1);
+        for (size_t i = 0; i < dstShape.size(); ++i)
+        {
+            size_t aDim = i < aShape.size() ? aShape[aShape.size() - 1 - i] : 1;
+            size_t bDim = i < bShape.size() ? bShape[bShape.size() - 1 - i] : 1;
+            dstShape[dstShape.size() - 1 - i] = Simd::Max(aDim, bDim);
+        }
+
+        Tensor32f a(aShape), b(bShape);
+        float lo = -10.0, hi = 10.0f;
+        if (type == SimdSynetBinaryOperation32fPow)
+            lo = 0.1f, hi = 2.0f;
+        FillRandom(a.Data(), a.Size(), lo, hi);
+        FillRandom(b.Data(), b.Size(), lo, hi);
+        if (type == SimdSynetBinaryOperation32fDiv)
+        {
+            for (size_t i = 0; i < b.Size(); ++i)
+                b.Data()[i] = b.Data()[i] < 0.0f ? b.Data()[i] - 0.1f : b.Data()[i] + 0.1f;
+        }
+
+        Tensor32f dst1(dstShape);
+        Tensor32f dst2(dstShape);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(a, b, type, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(a, b, type, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetBinaryOperation32fLayerForwardAutoTest(const FuncBO& f1, const FuncBO& f2)
+    {
+        bool result = true;
+
+        const size_t C = 64, S = H * W / C;
+        for (int type = (int)SimdSynetBinaryOperation32fAdd; type <= (int)SimdSynetBinaryOperation32fSub; type++)
+        {
+            SimdSynetBinaryOperation32fType t = (SimdSynetBinaryOperation32fType)type;
+            result = result && SynetBinaryOperation32fLayerForwardAutoTest(Shape({ C, S + O }), Shape({ C, S + O }), t, f1, f2);
+            result = result && SynetBinaryOperation32fLayerForwardAutoTest(Shape({ C, S + O }), Shape({ 1 }), t, f1, f2);
+            result = result && SynetBinaryOperation32fLayerForwardAutoTest(Shape({ 1 }), Shape({ C, S + O }), t, f1, f2);
+            result = result && SynetBinaryOperation32fLayerForwardAutoTest(Shape({ 1, C, S / 7, 7 }), Shape({ C, 1, 1 }), t, f1, f2);
+            result = result && SynetBinaryOperation32fLayerForwardAutoTest(Shape({ 1, S / 7, 7, C + 3 }), Shape({ C + 3 }), t, f1, f2);
+            result = result && SynetBinaryOperation32fLayerForwardAutoTest(Shape({ 3, 1, S + O }), Shape({ 1, C, 1 }), t, f1, f2);
+            result = result && SynetBinaryOperation32fLayerForwardAutoTest(Shape({ 2, C, 1, S / 2 }), Shape({ 2, 1, 5, S / 2 }), t, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool SynetBinaryOperation32fLayerForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetBinaryOperation32fLayerForwardAutoTest(FUNC_BO(Simd::Base::SynetBinaryOperation32fLayerForward), FUNC_BO(SimdSynetBinaryOperation32fLayerForward));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetBinaryOperation32fLayerForwardAutoTest(FUNC_BO(Simd::Sse2::SynetBinaryOperation32fLayerForward), FUNC_BO(SimdSynetBinaryOperation32fLayerForward));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetBinaryOperation32fLayerForwardAutoTest(FUNC_BO(Simd::Avx2::SynetBinaryOperation32fLayerForward), FUNC_BO(SimdSynetBinaryOperation32fLayerForward));
+#endif
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetBinaryOperation32fLayerForwardAutoTest(FUNC_BO(Simd::Avx512f::SynetBinaryOperation32fLayerForward), FUNC_BO(SimdSynetBinaryOperation32fLayerForward));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
     SIMD_INLINE String ToString(SimdSynetUnaryOperation32fType type)
     {
         switch (type)
@@ -488,5 +488,108 @@ namespace Test
 
         return result;
     }
+
+    //---------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncP
+        {
+            typedef void(*FuncPtr)(const float* src, const size_t* shape, const size_t* order, size_t count, float* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncP(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(const Shape& shape, const Shape& order)
+            {
+                std::stringstream ss;
+                ss << desc << "[";
+                for (size_t i = 0; i < shape.size(); ++i)
+                    ss << (i ? "x" : "") << shape[i];
+                ss << "-";
+                for (size_t i = 0; i < order.size(); ++i)
+                    ss << order[i];
+                ss << "]";
+                desc = ss.str();
+            }
+
+            void Call(const Tensor32f& src, const Shape& order, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), src.Shape().data(), order.data(), order.size(), dst.Data());
+            }
+        };
+    }
+
+#define FUNC_P(function) FuncP(function, #function)
+
+    bool SynetPermute32fAutoTest(const Shape& shape, const Shape& order, FuncP f1, FuncP f2)
+    {
+        bool result = true;
+
+        f1.Update(shape, order);
+        f2.Update(shape, order);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << "].");
+
+        Shape dstShape(shape.size());
+        for (size_t i = 0; i < order.size(); ++i)
+            dstShape[i] = shape[order[i]];
+
+        Tensor32f src(shape);
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f dst1(dstShape);
+        Tensor32f dst2(dstShape);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, order, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, order, dst2));
+
+        result = result && Compare(dst1, dst2, 0.0f, true, 64, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool SynetPermute32fAutoTest(const FuncP& f1, const FuncP& f2)
+    {
+        bool result = true;
+
+        result = result && SynetPermute32fAutoTest(Shape({ 1, 256, 38, 50 }), Shape({ 0, 2, 3, 1 }), f1, f2);
+        result = result && SynetPermute32fAutoTest(Shape({ 1, 38, 50, 256 }), Shape({ 0, 3, 1, 2 }), f1, f2);
+        result = result && SynetPermute32fAutoTest(Shape({ 2, 197, 12, 64 }), Shape({ 0, 2, 1, 3 }), f1, f2);
+        result = result && SynetPermute32fAutoTest(Shape({ 3, 17, 23, 5, 11 }), Shape({ 4, 2, 0, 3, 1 }), f1, f2);
+        result = result && SynetPermute32fAutoTest(Shape({ 2, 4, 7, 16, 33 }), Shape({ 0, 3, 1, 4, 2 }), f1, f2);
+
+        return result;
+    }
+
+    bool SynetPermute32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetPermute32fAutoTest(FUNC_P(Simd::Base::SynetPermute32f), FUNC_P(SimdSynetPermute32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetPermute32fAutoTest(FUNC_P(Simd::Sse2::SynetPermute32f), FUNC_P(SimdSynetPermute32f));
+#endif 
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && SynetPermute32fAutoTest(FUNC_P(Simd::Avx::SynetPermute32f), FUNC_P(SimdSynetPermute32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetPermute32fAutoTest(FUNC_P(Simd::Avx512f::SynetPermute32f), FUNC_P(SimdSynetPermute32f));
+#endif 
+
+        return result;
+    }
 #endif
 }
@@ -25,6 +25,7 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 #include "Test/TestTensor.h"
+#include "Test/TestString.h"
 #include "Test/TestSynetConvolutionParam.h"
 
 #include "Simd/SimdSynetConvolution32f.h"
@@ -550,6 +551,18 @@ namespace Test
         result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 512, 14, 14, 1536, _1, _1, _1, _0, _0, 1, a, t), f1, f2);
         result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 512, 14, 14, 512, _1, _1, _1, _0, _0, 1, a, t), f1, f2);
 #endif
+#if 1
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 240, 28, 28, 240, _1, _1, _1, _0, _0, 3, a, t), f1, f2);
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 64, 40, 23, 64, _3, _1, _1, _1, _1, 4, a, t), f1, f2);
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 60, 40, 23, 60, _3, _1, _2, _1, _1, 3, a, t), f1, f2);
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 64, 40, 23, 96, _3, _2, _1, _2, _2, 2, a, t), f1, f2);
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 256, 33, 33, 256, _3, Size(6, 6), _1, Size(6, 6), Size(6, 6), 1, a, t), f1, f2);
+#endif
+#if 1
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 128, 38, 38, 128, _3, _1, _1, _1, _1, 1, a, t), f1, f2);
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 64, 40, 27, 96, _3, _1, _1, _0, _0, 1, a, t), f1, f2);
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 256, 56, 56, 128, _3, _1, _1, _1, _1, 1, a, t), f1, f2);
+#endif
 #else
         result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 128, 14, 14, 128, _1, _1, _1, _0, _0, 1, a, t), f1, f2);
         result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 128, 14, 14, 128, _3, _1, _1, _0, _0, 1, a, t), f1, f2);
@@ -618,5 +631,398 @@ namespace Test
 
         return result;
     }
+
+    //---------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncCW
+        {
+            typedef void*(*FuncPtr)(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm, SimdTensorDataType weightType);
+
+            FuncPtr func;
+            String desc;
+
+            FuncCW(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(const Param & p, SimdTensorDataType w)
+            {
+                desc = desc + p.Decription() + (w == SimdTensorData16f ? "-16f" : "-16b");
+            }
+        };
+    }
+
+#define FUNC_CW(function) \
+    FuncCW(function, std::string(#function))
+
+    bool SynetConvolution32fWeight16ForwardAutoTest(const Param & p, SimdTensorDataType w, FuncCW f)
+    {
+        bool result = true;
+
+        f.Update(p, w);
+
+        TEST_LOG_SS(Info, "Test [" << f.desc << " & SimdSynetConvolution32fInit].");
+
+        const SimdConvolutionParameters & c = p.conv;
+        Tensor32f src({ p.batch, p.trans ? c.srcH : c.srcC, p.trans ? c.srcW : c.srcH, p.trans ? c.srcC : c.srcW });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight({ p.trans ? c.kernelY : c.dstC, p.trans ? c.kernelX : c.srcC / c.group,
+            p.trans ? c.srcC / c.group : c.kernelY, p.trans ? c.dstC : c.kernelX });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f dst32f({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+        Tensor32f dst16({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+
+        void * context32f = ::SimdSynetConvolution32fInit(p.batch, &p.conv, NULL);
+        void * context16 = f.func(p.batch, &p.conv, NULL, w);
+
+        ::SimdSynetConvolution32fSetParams(context32f, weight.Data(), NULL, bias.Data(), NULL);
+        ::SimdSynetConvolution32fSetParams(context16, weight.Data(), NULL, bias.Data(), NULL);
+
+        ::SimdSynetConvolution32fForward(context32f, src.Data(), NULL, dst32f.Data());
+        {
+            TEST_PERFORMANCE_TEST(f.desc);
+            ::SimdSynetConvolution32fForward(context16, src.Data(), NULL, dst16.Data());
+        }
+
+        ::SimdRelease(context32f);
+        ::SimdRelease(context16);
+
+        if (p.trans && c.kernelY == 1 && c.kernelX == 1 && c.strideY == 1 && c.strideX == 1 && c.group == 1)
+        {
+            // Relative error of 16-bit weight is less than 2^-mantissa (10 bits for FP16, 7 bits for BF16), 
+            // FP16 subnormals add absolute error 2^-24, FP32 accumulation adds srcC * 2^-24 relative error.
+            const float unit = w == SimdTensorData16f ? 1.0f / 1024.0f : 1.0f / 128.0f;
+            const float tiny = w == SimdTensorData16f ? 1.0f / float(1 << 24) : 0.0f;
+            const float accum = float(c.srcC) / float(1 << 24);
+            size_t M = p.batch * c.dstH * c.dstW, K = c.srcC, N = c.dstC;
+            for (size_t i = 0; i < M && result; ++i)
+            {
+                const float * ps = src.Data() + i * K;
+                for (size_t j = 0; j < N && result; ++j)
+                {
+                    float sumAbs = 0.0f, srcAbs = 0.0f;
+                    for (size_t k = 0; k < K; ++k)
+                    {
+                        sumAbs += ::fabs(ps[k] * weight.Data()[k * N + j]);
+                        srcAbs += ::fabs(ps[k]);
+                    }
+                    float d32f = dst32f.Data()[i * N + j], d16 = dst16.Data()[i * N + j];
+                    float error = ::fabs(d32f - d16), limit = (unit + 2.0f * accum) * sumAbs + tiny * srcAbs;
+                    if (error > limit)
+                    {
+                        TEST_LOG_SS(Error, "Error at [" << i << ", " << j << "]: " << d32f << " != " << d16 << ", error " << error << " > " << limit << " !");
+                        result = false;
+                    }
+                }
+            }
+        }
+        else
+            result = result && Compare(dst32f, dst16, 0.002f, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetConvolution32fWeight16ForwardAutoTest(const FuncCW & f)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _3(3, 3);
+        ::SimdConvolutionActivationType aId = ::SimdConvolutionActivationIdentity, aRe = ::SimdConvolutionActivationRelu;
+        ::SimdBool t = ::SimdTrue, n = ::SimdFalse;
+        SimdTensorDataType w16f = SimdTensorData16f, w16b = SimdTensorData16b;
+
+        result = result && SynetConvolution32fWeight16ForwardAutoTest(Param(1, 256, 7, 7, 512, _1, _1, _1, _0, _0, 1, aId, t), w16f, f);
+        result = result && SynetConvolution32fWeight16ForwardAutoTest(Param(1, 256, 7, 7, 512, _1, _1, _1, _0, _0, 1, aRe, t), w16b, f);
+        result = result && SynetConvolution32fWeight16ForwardAutoTest(Param(2, 35, 5, 3, 67, _1, _1, _1, _0, _0, 1, aRe, t), w16f, f);
+        result = result && SynetConvolution32fWeight16ForwardAutoTest(Param(2, 35, 5, 3, 67, _1, _1, _1, _0, _0, 1, aId, t), w16b, f);
+        result = result && SynetConvolution32fWeight16ForwardAutoTest(Param(1, 32, 9, 9, 64, _3, _1, _1, _1, _1, 1, aRe, t), w16f, f);
+        result = result && SynetConvolution32fWeight16ForwardAutoTest(Param(1, 32, 9, 9, 64, _1, _1, _1, _0, _0, 1, aRe, n), w16b, f);
+
+        return result;
+    }
+
+    bool SynetConvolution32fWeight16ForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetConvolution32fWeight16ForwardAutoTest(FUNC_CW(Simd::Base::SynetConvolution32fInitV2));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetConvolution32fWeight16ForwardAutoTest(FUNC_CW(Simd::Sse2::SynetConvolution32fInitV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvolution32fWeight16ForwardAutoTest(FUNC_CW(Simd::Avx2::SynetConvolution32fInitV2));
+#endif
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetConvolution32fWeight16ForwardAutoTest(FUNC_CW(Simd::Avx512f::SynetConvolution32fInitV2));
+#endif
+
+        result = result && SynetConvolution32fWeight16ForwardAutoTest(FUNC_CW(SimdSynetConvolution32fInitV2));
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace
+    {
+        void * SynetConvolution32fGemmNNInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
+        {
+            Simd::ConvParam32f param(batch, conv, gemm);
+            if (!param.Valid())
+                return NULL;
+            return new Simd::Base::SynetConvolution32fGemmNN(param);
+        }
+
+#ifdef SIMD_AVX512F_ENABLE
+        void * SynetConvolution32fGemmNNAvx512fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
+        {
+            Simd::ConvParam32f param(batch, conv, gemm);
+            if (!param.Valid())
+                return NULL;
+            return new Simd::Avx512f::SynetConvolution32fGemmNN(param);
+        }
+#endif
+
+        void PruneWeight(float * weight, size_t N, size_t K, size_t ldN, size_t ldK, size_t block, float density)
+        {
+            for (size_t n = 0; n < N; n += block)
+                for (size_t k = 0; k < K; ++k)
+                    if (Random() > density)
+                        for (size_t i = n, end = std::min(N, n + block); i < end; ++i)
+                            weight[i * ldN + k * ldK] = 0.0f;
+        }
+    }
+
+    bool SynetConvolution32fSparseForwardAutoTest(float eps, const Param & p, size_t block, float density, FuncC f1, FuncC f2)
+    {
+        bool result = true;
+
+        f1.Update(p);
+        f2.Update(p);
+        f1.desc = f1.desc + "-" + ToString(block);
+        f2.desc = f2.desc + "-" + ToString(block);
+
+        TEST_LOG_SS(Info, "Test [" << f1.desc << " & " << f2.desc << "].");
+
+        const SimdConvolutionParameters & c = p.conv;
+        Tensor32f src({ p.batch, p.trans ? c.srcH : c.srcC, p.trans ? c.srcW : c.srcH, p.trans ? c.srcC : c.srcW });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight({ p.trans ? c.srcC : c.dstC, p.trans ? c.dstC : c.srcC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        if (p.trans)
+            PruneWeight(weight.Data(), c.dstC, c.srcC, 1, c.dstC, block, density);
+        else
+            PruneWeight(weight.Data(), c.dstC, c.srcC, c.srcC, 1, block, density);
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f buf;
+
+        Tensor32f dst1({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+        Tensor32f dst2({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+
+        ::SimdFill32f(dst1.Data(), dst1.Size(), params.Data() + 0);
+        ::SimdFill32f(dst2.Data(), dst2.Size(), params.Data() + 1);
+
+        void * context1 = f1.func(p.batch, &p.conv, NULL);
+        void * context2 = f2.func(p.batch, &p.conv, NULL);
+
+        buf.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context1) });
+        buf.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context2) });
+
+        ::SimdSynetConvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetConvolution32fSetParams(context2, weight.Data(), NULL, bias.Data(), params.Data());
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, buf, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, buf, dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        result = result && Compare(dst1, dst2, eps, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetConvolution32fSparseForwardAutoTest(float eps, ::SimdConvolutionActivationType a, ::SimdBool t, const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1);
+
+        result = result && SynetConvolution32fSparseForwardAutoTest(eps, Param(1, 128, 14, 14, 256, _1, _1, _1, _0, _0, 1, a, t), 16, 0.2f, f1, f2);
+        result = result && SynetConvolution32fSparseForwardAutoTest(eps, Param(1, 96, 13, 15, 84, _1, _1, _1, _0, _0, 1, a, t), 8, 0.2f, f1, f2);
+        result = result && SynetConvolution32fSparseForwardAutoTest(eps, Param(2, 64, 9, 7, 100, _1, _1, _1, _0, _0, 1, a, t), 4, 0.2f, f1, f2);
+        result = result && SynetConvolution32fSparseForwardAutoTest(eps, Param(1, 256, 7, 7, 129, _1, _1, _1, _0, _0, 1, a, t), 1, 0.08f, f1, f2);
+
+        return result;
+    }
+
+    bool SynetConvolution32fSparseForwardAutoTest(float eps, const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        result = result && SynetConvolution32fSparseForwardAutoTest(eps, ::SimdConvolutionActivationRelu, ::SimdFalse, f1, f2);
+        result = result && SynetConvolution32fSparseForwardAutoTest(eps, ::SimdConvolutionActivationPrelu, ::SimdTrue, f1, f2);
+        result = result && SynetConvolution32fSparseForwardAutoTest(eps, ::SimdConvolutionActivationIdentity, ::SimdTrue, f1, f2);
+        result = result && SynetConvolution32fSparseForwardAutoTest(eps, ::SimdConvolutionActivationLeakyRelu, ::SimdFalse, f1, f2);
+
+        return result;
+    }
+
+    bool SynetConvolution32fSparseForwardAutoTest()
+    {
+        const float EPS = 0.001f;
+        bool result = true;
+
+        result = result && SynetConvolution32fSparseForwardAutoTest(EPS, FUNC_C(SynetConvolution32fGemmNNInit), FUNC_C(Simd::Base::SynetConvolution32fInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetConvolution32fSparseForwardAutoTest(EPS, FUNC_C(SynetConvolution32fGemmNNInit), FUNC_C(Simd::Sse2::SynetConvolution32fInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvolution32fSparseForwardAutoTest(EPS, FUNC_C(SynetConvolution32fGemmNNInit), FUNC_C(Simd::Avx2::SynetConvolution32fInit));
+#endif
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetConvolution32fSparseForwardAutoTest(EPS, FUNC_C(SynetConvolution32fGemmNNInit), FUNC_C(Simd::Avx512f::SynetConvolution32fInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetConvolution32fSparseForwardAutoTest(EPS, FUNC_C(SynetConvolution32fGemmNNInit), FUNC_C(Simd::Neon::SynetConvolution32fInit));
+#endif
+
+        result = result && SynetConvolution32fSparseForwardAutoTest(EPS, FUNC_C(SynetConvolution32fGemmNNInit), FUNC_C(SimdSynetConvolution32fInit));
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------
+
+    bool SynetConvolution32fGemmNNForwardAutoTest(float eps, const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        ::SimdConvolutionActivationType a = ::SimdConvolutionActivationRelu;
+
+        // Gathering image to column: right padding is wider than the last (masked) block of output row.
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 8, 6, 40, 16, _3, Size(16, 1), _1, Size(16, 1), Size(16, 1), 1, a, ::SimdFalse), f1, f2);
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 8, 6, 70, 16, _3, Size(8, 1), _2, Size(8, 1), Size(24, 1), 1, a, ::SimdFalse), f1, f2);
+        // Gathering image to column: left padding is wider than the first (masked) block of output row.
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 8, 6, 40, 16, _3, _2, _1, Size(20, 1), Size(0, 1), 1, a, ::SimdFalse), f1, f2);
+        // Ordinary gathering.
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 8, 12, 70, 16, _3, _2, _2, _2, _2, 1, a, ::SimdFalse), f1, f2);
+
+        return result;
+    }
+
+    bool SynetConvolution32fGemmNNForwardAutoTest()
+    {
+        const float EPS = 0.001f;
+        bool result = true;
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetConvolution32fGemmNNForwardAutoTest(EPS, FuncC(SynetConvolution32fGemmNNInit, "Simd::Base::SynetConvolution32fGemmNN"),
+                FuncC(SynetConvolution32fGemmNNAvx512fInit, "Simd::Avx512f::SynetConvolution32fGemmNN"));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------
+
+    bool SynetConvolution32fForwardStridedAutoTest(const Param & p, size_t offset, size_t stride)
+    {
+        bool result = true;
+
+        const SimdConvolutionParameters & c = p.conv;
+        TEST_LOG_SS(Info, "Test SimdSynetConvolution32fForwardStrided" << p.Decription() << "[" << offset << "-" << stride << "].");
+
+        Tensor32f src({ p.batch, p.trans ? c.srcH : c.srcC, p.trans ? c.srcW : c.srcH, p.trans ? c.srcC : c.srcW });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight({ p.trans ? c.kernelY : c.dstC, p.trans ? c.kernelX : c.srcC / c.group,
+            p.trans ? c.srcC / c.group : c.kernelY, p.trans ? c.dstC : c.kernelX });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f dense({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+        Tensor32f strided({ p.batch, p.trans ? c.dstH : stride, p.trans ? c.dstW : c.dstH, p.trans ? stride : c.dstW });
+        FillRandom(strided.Data(), strided.Size(), -1.0, 1.0f);
+        Tensor32f control;
+        control.Clone(strided);
+
+        void * context = ::SimdSynetConvolution32fInit(p.batch, &c, NULL);
+        ::SimdSynetConvolution32fSetParams(context, weight.Data(), NULL, bias.Data(), NULL);
+        ::SimdSynetConvolution32fForward(context, src.Data(), NULL, dense.Data());
+        {
+            TEST_PERFORMANCE_TEST("SimdSynetConvolution32fForwardStrided");
+            ::SimdSynetConvolution32fForwardStrided(context, src.Data(), NULL, strided.Data() + offset * (p.trans ? 1 : c.dstH * c.dstW), stride);
+        }
+        ::SimdRelease(context);
+
+        size_t spatial = c.dstH * c.dstW;
+        for (size_t b = 0; b < p.batch; ++b)
+        {
+            for (size_t s = 0; s < spatial; ++s)
+            {
+                for (size_t d = 0; d < c.dstC; ++d)
+                {
+                    size_t i = p.trans ? (b * spatial + s) * c.dstC + d : (b * c.dstC + d) * spatial + s;
+                    size_t o = p.trans ? (b * spatial + s) * stride + offset + d : (b * stride + offset + d) * spatial + s;
+                    control.Data()[o] = dense.Data()[i];
+                }
+            }
+        }
+
+        result = result && Compare(control, strided, 0.0f, true, 64, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool SynetConvolution32fForwardStridedAutoTest()
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _3(3, 3);
+        ::SimdConvolutionActivationType a = ::SimdConvolutionActivationRelu;
+
+        result = result && SynetConvolution32fForwardStridedAutoTest(Param(2, 16, 10, 12, 24, _3, _1, _1, _1, _1, 1, a, ::SimdTrue), 8, 40);
+        result = result && SynetConvolution32fForwardStridedAutoTest(Param(2, 16, 10, 12, 24, _3, _1, _1, _1, _1, 1, a, ::SimdFalse), 8, 40);
+        result = result && SynetConvolution32fForwardStridedAutoTest(Param(1, 32, 7, 7, 16, _1, _1, _1, _0, _0, 1, a, ::SimdTrue), 0, 48);
+        result = result && SynetConvolution32fForwardStridedAutoTest(Param(1, 32, 7, 7, 16, _1, _1, _1, _0, _0, 1, a, ::SimdTrue), 0, 16);
+
+        return result;
+    }
 #endif
 }
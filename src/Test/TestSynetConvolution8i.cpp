@@ -76,24 +76,15 @@ namespace Test
         SetDstStat(p.conv.dstC, neg, comp, dst, dstMin, dstMax, dstScale, dstShift);
     }
 
-    bool SynetConvolution8iForwardAutoTest(float eps, Param p, int neg, SimdSynetCompatibilityType comp, FuncC f1, FuncC f2)
+    void FillWeightBiasParams(const Param& p, Tensor32f& weight, Tensor32f& bias, Tensor32f& params)
     {
-        bool result = true;
-
-        f1.Update(p, comp);
-        f2.Update(p, comp);
-
-        TEST_LOG_SS(Info, "Test [" << f1.desc << " & " << f2.desc << "].");
-
-        const SimdConvolutionParameters & c = p.conv;
-
-        Tensor32f weight(p.WeightShape());
+        weight.Reshape(p.WeightShape());
         FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
 
-        Tensor32f bias({ c.dstC });
+        bias.Reshape({ p.conv.dstC });
         FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
 
-        Tensor32f params({ c.dstC });
+        params.Reshape({ p.conv.dstC });
         FillRandom(params.Data(), params.Size(), -3.0f, 3.0f);
         if (p.conv.activation == ::SimdConvolutionActivationHswish)
         {
@@ -112,6 +103,21 @@ namespace Test
             params.Data()[0] = 0.1f;
             params.Data()[1] = 1.1f;
         }
+    }
+
+    bool SynetConvolution8iForwardAutoTest(float eps, Param p, int neg, SimdSynetCompatibilityType comp, FuncC f1, FuncC f2)
+    {
+        bool result = true;
+
+        f1.Update(p, comp);
+        f2.Update(p, comp);
+
+        TEST_LOG_SS(Info, "Test [" << f1.desc << " & " << f2.desc << "].");
+
+        const SimdConvolutionParameters & c = p.conv;
+
+        Tensor32f weight, bias, params;
+        FillWeightBiasParams(p, weight, bias, params);
 
         Tensor32f srcMin({ c.srcC }), srcMax({ c.srcC }), dstMin({ c.dstC }), dstMax({ c.dstC });
         Tensor32f src32f(p.SrcShape(), p.conv.srcF), dst32f1(p.DstShape(), p.conv.dstF), dst32f2(p.DstShape(), p.conv.dstF), buf32f;
@@ -283,5 +289,135 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------
+
+    bool SynetConvolution8iNchwcForwardAutoTest(float eps, Param p, SimdTensorFormatType format, int neg, SimdSynetCompatibilityType comp, FuncC f1, FuncC f2)
+    {
+        bool result = true;
+
+        Param pc = p;
+        pc.conv.srcF = format;
+        pc.conv.dstF = format;
+
+        f1.Update(p, comp);
+        f2.Update(p, comp);
+        f2.desc = f2.desc + "-" + ToString(format);
+
+        TEST_LOG_SS(Info, "Test [" << f1.desc << " & " << f2.desc << "].");
+
+        const SimdConvolutionParameters& c = p.conv;
+
+        Tensor32f weight, bias, params;
+        FillWeightBiasParams(p, weight, bias, params);
+
+        Tensor32f srcMin({ c.srcC }), srcMax({ c.srcC }), dstMin({ c.dstC }), dstMax({ c.dstC });
+        Tensor32f src32f(p.SrcShape(), c.srcF), dst32f1(p.DstShape(), c.dstF), dst32f2(p.DstShape(), c.dstF), buf32f;
+        Tensor8u src8u(p.SrcShape(), c.srcF), dst8u1(p.DstShape(), c.dstF), dst8u2(p.DstShape(), c.dstF), buf8u;
+        Tensor32f src32fc(ToShape(p.batch, c.srcC, c.srcH, c.srcW, format), format), dst32fc(ToShape(p.batch, c.dstC, c.dstH, c.dstW, format), format);
+        Tensor8u src8uc(ToShape(p.batch, c.srcC, c.srcH, c.srcW, format), format), dst8uc(ToShape(p.batch, c.dstC, c.dstH, c.dstW, format), format);
+
+        FillRandom(src32f, srcMin.Data(), srcMax.Data(), c.srcC, neg);
+        SetSrc32fTo8u(src32f, srcMin.Data(), srcMax.Data(), c.srcC, neg, comp, NULL, NULL, src8u);
+        FillDstStat(p, neg, comp, weight, bias, params, src32f, buf32f, dst32f1, dstMin.Data(), dstMax.Data(), NULL, NULL);
+
+        ::SimdSynetReorderImage(p.batch, c.srcC, c.srcH * c.srcW, src32f.Data(), c.srcF, src32fc.Data(), format);
+        ::SimdSynetReorderImage8u(p.batch, c.srcC, c.srcH * c.srcW, src8u.Data(), c.srcF, src8uc.Data(), format);
+
+        const float* stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+        const uint8_t* src1 = c.srcT == SimdTensorData32f ? (uint8_t*)src32f.Data() : src8u.Data();
+        const uint8_t* src2 = c.srcT == SimdTensorData32f ? (uint8_t*)src32fc.Data() : src8uc.Data();
+        uint8_t* dst1 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : dst8u1.Data();
+        uint8_t* dst2 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32fc.Data() : dst8uc.Data();
+
+        Fill(dst32f1, 0.1f);
+        Fill(dst32fc, 1.1f);
+
+        Fill(dst8u1, uint8_t(1));
+        Fill(dst8uc, uint8_t(2));
+
+        void* context1 = f1.func(p.batch, &p.conv, comp);
+        void* context2 = f2.func(pc.batch, &pc.conv, comp);
+
+        buf8u.Extend({ ::SimdSynetConvolution8iExternalBufferSize(context1) });
+        buf8u.Extend({ ::SimdSynetConvolution8iExternalBufferSize(context2) });
+
+        ::SimdSynetConvolution8iSetParams(context1, weight.Data(), bias.Data(), params.Data(), stats);
+        ::SimdSynetConvolution8iSetParams(context2, weight.Data(), bias.Data(), params.Data(), stats);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src1, buf8u.Data(), dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src2, buf8u.Data(), dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        if (c.dstT == SimdTensorData32f)
+        {
+            ::SimdSynetReorderImage(p.batch, c.dstC, c.dstH * c.dstW, dst32fc.Data(), format, dst32f2.Data(), c.dstF);
+            result = result && Compare(dst32f1, dst32f2, eps * eps, true, 64, DifferenceBoth);
+        }
+        else
+        {
+            ::SimdSynetReorderImage8u(p.batch, c.dstC, c.dstH * c.dstW, dst8uc.Data(), format, dst8u2.Data(), c.dstF);
+            result = result && Compare(dst8u1, dst8u2, 1, true, 64);
+        }
+
+        return result;
+    }
+
+    bool SynetConvolution8iNchwcForwardAutoTest(const FuncC& f1, const FuncC& f2, SimdTensorFormatType f, SimdSynetCompatibilityType c)
+    {
+        bool result = true;
+
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3), _5(5, 5);
+        const float e = EPS;
+        const SimdBool t0 = SimdFalse;
+        const SimdTensorDataType f32 = SimdTensorData32f, u8 = SimdTensorData8u;
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu,
+            aPr = SimdConvolutionActivationPrelu, aHs = SimdConvolutionActivationHswish;
+
+        result = result && SynetConvolution8iNchwcForwardAutoTest(e, Param(1, 64, 20, 20, 48, _1, _1, _1, _0, _0, 1, aRe, t0, u8, u8), f, 0, c, f1, f2);
+        result = result && SynetConvolution8iNchwcForwardAutoTest(e, Param(1, 35, 17, 23, 37, _3, _1, _1, _1, _1, 1, aPr, t0, f32, u8), f, 0, c, f1, f2);
+        result = result && SynetConvolution8iNchwcForwardAutoTest(e, Param(2, 32, 24, 24, 16, _3, _1, _2, _1, _1, 1, aHs, t0, u8, f32), f, 1, c, f1, f2);
+        result = result && SynetConvolution8iNchwcForwardAutoTest(e, Param(1, 48, 30, 30, 48, _3, _1, _1, _1, _1, 48, aRe, t0, u8, u8), f, 0, c, f1, f2);
+        result = result && SynetConvolution8iNchwcForwardAutoTest(e, Param(1, 37, 19, 21, 37, _5, _1, _2, _2, _2, 37, aId, t0, f32, f32), f, 1, c, f1, f2);
+
+        return result;
+    }
+
+    bool SynetConvolution8iNchwcForwardAutoTest(const FuncC& f1, const FuncC& f2)
+    {
+        bool result = true;
+
+        SimdSynetCompatibilityType n = (SimdSynetCompatibilityType)(SimdSynetCompatibility8iNarrowed | SimdSynetCompatibilityFmaAvoid);
+
+        result = result && SynetConvolution8iNchwcForwardAutoTest(f1, f2, SimdTensorFormatNchw4c, n);
+        result = result && SynetConvolution8iNchwcForwardAutoTest(f1, f2, SimdTensorFormatNchw8c, n);
+        result = result && SynetConvolution8iNchwcForwardAutoTest(f1, f2, SimdTensorFormatNchw16c, n);
+
+        return result;
+    }
+
+    bool SynetConvolution8iNchwcForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetConvolution8iNchwcForwardAutoTest(FUNC_C(Simd::Base::SynetConvolution8iInit), FUNC_C(SimdSynetConvolution8iInit));
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetConvolution8iNchwcForwardAutoTest(FUNC_C(Simd::Base::SynetConvolution8iInit), FUNC_C(Simd::Avx512bw::SynetConvolution8iInit));
+#endif
+
+#ifdef SIMD_AVX512VNNI_ENABLE
+        if (Simd::Avx512vnni::Enable)
+            result = result && SynetConvolution8iNchwcForwardAutoTest(FUNC_C(Simd::Base::SynetConvolution8iInit), FUNC_C(Simd::Avx512vnni::SynetConvolution8iInit));
+#endif
+
+        return result;
+    }
 #endif
 }
@@ -0,0 +1,325 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2021 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+#include "Test/TestTensor.h"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        struct FuncDs
+        {
+            typedef void(*FuncPtr)(const float* loc, const float* prior, const float* variance, size_t count, float* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncDs(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Call(const Tensor32f& loc, const Tensor32f& prior, const Tensor32f& variance, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(loc.Data(), prior.Data(), variance.Data(), loc.Axis(0), dst.Data());
+            }
+        };
+    }
+
+#define FUNC_DS(func) FuncDs(func, #func)
+
+    static void FillPriorBoxes(Tensor32f& prior)
+    {
+        for (size_t i = 0; i < prior.Axis(0); ++i)
+        {
+            float* box = prior.Data() + i * 4;
+            float cx = Random(), cy = Random(), hw = 0.01f + 0.2f * Random(), hh = 0.01f + 0.2f * Random();
+            box[0] = cx - hw;
+            box[1] = cy - hh;
+            box[2] = cx + hw;
+            box[3] = cy + hh;
+        }
+    }
+
+    bool SynetDecodeSsd32fAutoTest(size_t count, const FuncDs& f1, const FuncDs& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << count << "].");
+
+        Tensor32f loc({ count, 4 }), prior({ count, 4 }), variance({ count, 4 });
+        Tensor32f dst1({ count, 4 }), dst2({ count, 4 });
+
+        FillRandom(loc, -2.0f, 2.0f);
+        FillPriorBoxes(prior);
+        for (size_t i = 0; i < count; ++i)
+        {
+            float* var = variance.Data() + i * 4;
+            var[0] = 0.1f, var[1] = 0.1f, var[2] = 0.2f, var[3] = 0.2f;
+        }
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(loc, prior, variance, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(loc, prior, variance, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetDecodeSsd32fAutoTest(const FuncDs& f1, const FuncDs& f2)
+    {
+        bool result = true;
+
+        result = result && SynetDecodeSsd32fAutoTest(8732, f1, f2);
+        result = result && SynetDecodeSsd32fAutoTest(1917, f1, f2);
+        result = result && SynetDecodeSsd32fAutoTest(15, f1, f2);
+
+        return result;
+    }
+
+    bool SynetDecodeSsd32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetDecodeSsd32fAutoTest(FUNC_DS(Simd::Base::SynetDecodeSsd32f), FUNC_DS(SimdSynetDecodeSsd32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetDecodeSsd32fAutoTest(FUNC_DS(Simd::Sse2::SynetDecodeSsd32f), FUNC_DS(SimdSynetDecodeSsd32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetDecodeSsd32fAutoTest(FUNC_DS(Simd::Avx2::SynetDecodeSsd32f), FUNC_DS(SimdSynetDecodeSsd32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetDecodeSsd32fAutoTest(FUNC_DS(Simd::Avx512f::SynetDecodeSsd32f), FUNC_DS(SimdSynetDecodeSsd32f));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncDy
+        {
+            typedef void(*FuncPtr)(const float* src, size_t anchors, size_t classes, size_t height, size_t width, const float* sizes, float* boxes, float* scores);
+
+            FuncPtr func;
+            String desc;
+
+            FuncDy(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t a, size_t c, size_t h, size_t w)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << a << "x" << c << "x" << h << "x" << w << "]";
+                desc = ss.str();
+            }
+
+            void Call(const Tensor32f& src, size_t anchors, size_t classes, size_t height, size_t width, const Tensor32f& sizes, Tensor32f& boxes, Tensor32f& scores) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), anchors, classes, height, width, sizes.Data(), boxes.Data(), scores.Data());
+            }
+        };
+    }
+
+#define FUNC_DY(func) FuncDy(func, #func)
+
+    bool SynetDecodeYolo32fAutoTest(size_t anchors, size_t classes, size_t height, size_t width, FuncDy f1, FuncDy f2)
+    {
+        bool result = true;
+
+        f1.Update(anchors, classes, height, width);
+        f2.Update(anchors, classes, height, width);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        size_t count = anchors * height * width;
+        Tensor32f src({ anchors, 5 + classes, height, width }), sizes({ anchors, 2 });
+        Tensor32f boxes1({ count, 4 }), boxes2({ count, 4 });
+        Tensor32f scores1({ classes, count }), scores2({ classes, count });
+
+        FillRandom(src, -4.0f, 4.0f);
+        FillRandom(sizes, 0.02f, 0.5f);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, anchors, classes, height, width, sizes, boxes1, scores1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, anchors, classes, height, width, sizes, boxes2, scores2));
+
+        result = result && Compare(boxes1, boxes2, EPS, true, 32, DifferenceBoth, "boxes");
+        result = result && Compare(scores1, scores2, EPS, true, 32, DifferenceBoth, "scores");
+
+        return result;
+    }
+
+    bool SynetDecodeYolo32fAutoTest(const FuncDy& f1, const FuncDy& f2)
+    {
+        bool result = true;
+
+        result = result && SynetDecodeYolo32fAutoTest(3, 80, 13, 13, f1, f2);
+        result = result && SynetDecodeYolo32fAutoTest(3, 80, 26, 26, f1, f2);
+        result = result && SynetDecodeYolo32fAutoTest(5, 20, 13, 13, f1, f2);
+        result = result && SynetDecodeYolo32fAutoTest(2, 3, 7, 9, f1, f2);
+
+        return result;
+    }
+
+    bool SynetDecodeYolo32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetDecodeYolo32fAutoTest(FUNC_DY(Simd::Base::SynetDecodeYolo32f), FUNC_DY(SimdSynetDecodeYolo32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetDecodeYolo32fAutoTest(FUNC_DY(Simd::Sse2::SynetDecodeYolo32f), FUNC_DY(SimdSynetDecodeYolo32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetDecodeYolo32fAutoTest(FUNC_DY(Simd::Avx2::SynetDecodeYolo32f), FUNC_DY(SimdSynetDecodeYolo32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetDecodeYolo32fAutoTest(FUNC_DY(Simd::Avx512f::SynetDecodeYolo32f), FUNC_DY(SimdSynetDecodeYolo32f));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncDo
+        {
+            typedef size_t(*FuncPtr)(const float* boxes, const float* scores, size_t count, size_t classes, size_t background,
+                const float* confidence, const float* overlap, size_t topK, size_t keepTopK, float* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncDo(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t n, size_t c, size_t t, size_t k)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << n << "x" << c << "-" << t << "-" << k << "]";
+                desc = ss.str();
+            }
+
+            void Call(const Tensor32f& boxes, const Tensor32f& scores, size_t background, float confidence, float overlap, 
+                size_t topK, size_t keepTopK, Tensor32f& dst, size_t & size) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                size = func(boxes.Data(), scores.Data(), boxes.Axis(0), scores.Axis(0), background, &confidence, &overlap, topK, keepTopK, dst.Data());
+            }
+        };
+    }
+
+#define FUNC_DO(func) FuncDo(func, #func)
+
+    bool SynetDetectionOutput32fAutoTest(size_t count, size_t classes, size_t topK, size_t keepTopK, FuncDo f1, FuncDo f2)
+    {
+        bool result = true;
+
+        f1.Update(count, classes, topK, keepTopK);
+        f2.Update(count, classes, topK, keepTopK);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f boxes({ count, 4 }), scores({ classes, count });
+        Tensor32f dst1({ keepTopK, 6 }), dst2({ keepTopK, 6 });
+        size_t size1 = 0, size2 = 0;
+
+        FillPriorBoxes(boxes);
+        FillRandom(scores, 0.0f, 1.0f);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(boxes, scores, 0, 0.3f, 0.45f, topK, keepTopK, dst1, size1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(boxes, scores, 0, 0.3f, 0.45f, topK, keepTopK, dst2, size2));
+
+        if (size1 != size2)
+        {
+            TEST_LOG_SS(Error, "There are different number of detections: " << size1 << " != " << size2 << " !");
+            return false;
+        }
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetDetectionOutput32fAutoTest(const FuncDo& f1, const FuncDo& f2)
+    {
+        bool result = true;
+
+        result = result && SynetDetectionOutput32fAutoTest(8732, 21, 400, 200, f1, f2);
+        result = result && SynetDetectionOutput32fAutoTest(1917, 91, 100, 100, f1, f2);
+        result = result && SynetDetectionOutput32fAutoTest(507, 3, 300, 500, f1, f2);
+
+        return result;
+    }
+
+    bool SynetDetectionOutput32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetDetectionOutput32fAutoTest(FUNC_DO(Simd::Base::SynetDetectionOutput32f), FUNC_DO(SimdSynetDetectionOutput32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetDetectionOutput32fAutoTest(FUNC_DO(Simd::Sse2::SynetDetectionOutput32f), FUNC_DO(SimdSynetDetectionOutput32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetDetectionOutput32fAutoTest(FUNC_DO(Simd::Avx2::SynetDetectionOutput32f), FUNC_DO(SimdSynetDetectionOutput32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetDetectionOutput32fAutoTest(FUNC_DO(Simd::Avx512f::SynetDetectionOutput32f), FUNC_DO(SimdSynetDetectionOutput32f));
+#endif 
+
+        return result;
+    }
+#endif
+}
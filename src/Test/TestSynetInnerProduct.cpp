@@ -29,6 +29,7 @@
 #include "Simd/SimdSynet.h"
 
 #include "Simd/SimdSynetInnerProduct32f.h"
+#include "Simd/SimdSynetInnerProduct8i.h"
 
 namespace Test
 {
@@ -37,16 +38,17 @@ namespace Test
     {
         struct FuncIP32F
         {
-            typedef void* (*FuncPtr)(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+            typedef void* (*FuncPtr)(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType);
 
             FuncPtr func;
             String desc;
 
             FuncIP32F(const FuncPtr& f, const String& d) : func(f), desc(d) {}
 
-            void Update(size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a)
+            void Update(size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a, SimdTensorDataType w)
             {
-                desc = desc + "[" + ToString(b) + "-" + ToString(i) + "-" + ToString(o) + "-" + ToString((int)t) + "]";
+                desc = desc + "[" + ToString(b) + "-" + ToString(i) + "-" + ToString(o) + "-" + ToString((int)t) + 
+                    (w == SimdTensorData16f ? "-16f" : (w == SimdTensorData16b ? "-16b" : "")) + "]";
             }
 
             void Call(void* context, const Tensor32f& src, Tensor32f& dst) const
@@ -60,12 +62,12 @@ namespace Test
 #define FUNC_IP32F(function) \
     FuncIP32F(function, std::string(#function))
 
-    bool SynetInnerProduct32fForwardAutoTest(float eps, size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a, FuncIP32F f1, FuncIP32F f2)
+    bool SynetInnerProduct32fForwardAutoTest(float eps, size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a, SimdTensorDataType w, FuncIP32F f1, FuncIP32F f2)
     {
         bool result = true;
 
-        f1.Update(b, i, o, t, a);
-        f2.Update(b, i, o, t, a);
+        f1.Update(b, i, o, t, a, w);
+        f2.Update(b, i, o, t, a, w);
 
         TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
 
@@ -102,8 +104,8 @@ namespace Test
         ::SimdFill32f(dst1.Data(), dst1.Size(), params.Data() + 0);
         ::SimdFill32f(dst2.Data(), dst2.Size(), params.Data() + 1);
 
-        void* context1 = f1.func(b, i, o, t, a);
-        void* context2 = f2.func(b, i, o, t, a);
+        void* context1 = f1.func(b, i, o, t, a, w);
+        void* context2 = f2.func(b, i, o, t, a, w);
 
         ::SimdSynetInnerProduct32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
         ::SimdSynetInnerProduct32fSetParams(context2, weight.Data(), NULL, bias.Data(), params.Data());
@@ -128,50 +130,61 @@ namespace Test
 
         SimdBool t = SimdTrue, f = SimdFalse;
         SimdConvolutionActivationType a = SimdConvolutionActivationIdentity;
+        SimdTensorDataType w32f = SimdTensorData32f, w16f = SimdTensorData16f, w16b = SimdTensorData16b;
 
 #ifdef NDEBUG
 #if 0
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 96, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 192, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 96, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 192, f, a, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 96, f, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 192, f, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 96, f, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 192, f, a, w32f, f1, f2);
 #endif
 #if 0
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 96, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 192, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 96, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 192, f, a, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 96, f, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 192, f, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 96, f, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 192, f, a, w32f, f1, f2);
 #endif
 #if 1        
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 96, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 192, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 96, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 192, t, a, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 96, t, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 192, t, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 96, t, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 192, t, a, w32f, f1, f2);
 #endif
 #if 0
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 96, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 192, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 96, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 192, t, a, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 96, t, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 192, t, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 96, t, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 192, t, a, w32f, f1, f2);
 #endif
 #if 1
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 1024, 4096, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 256, 1024, f, a, f1, f2);       
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 4096, 254, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 1024, 4096, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 256, 1024, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 4096, 254, t, a, f1, f2);
-        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, f, a, f1, f2);
-        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 256, 1024, f, a, f1, f2);
-        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 254, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 1024, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 1024, f, a, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 1024, 4096, f, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 256, 1024, f, a, w32f, f1, f2);       
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 4096, 254, f, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 1024, 4096, t, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 256, 1024, t, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 4096, 254, t, a, w32f, f1, f2);
+        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, f, a, w32f, f1, f2);
+        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 256, 1024, f, a, w32f, f1, f2);
+        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 254, f, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, t, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 1024, t, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, f, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 1024, f, a, w32f, f1, f2);
+#endif
+#if 1
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 1024, 4096, t, a, w16f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 4096, 1000, f, a, w16f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 1024, 4096, t, a, w16b, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 4096, 1000, f, a, w16b, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 97, t, a, w16f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 97, f, a, w16b, f1, f2);
 #endif
 #else
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 1024, t, a, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, t, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 1024, t, a, w32f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 97, t, a, w16f, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 97, f, a, w16b, f1, f2);
 #endif
 
         return result;
@@ -182,33 +195,248 @@ namespace Test
         const float EPS = 0.001f;
         bool result = true;
 
-        result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Base::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInit));
+        result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Base::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInitV2));
 
 #ifdef SIMD_SSE41_ENABLE
         if (Simd::Sse41::Enable)
-            result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Sse41::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInit));
+            result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Sse41::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInitV2));
 #endif 
 
 #ifdef SIMD_AVX_ENABLE
         if (Simd::Avx::Enable)
-            result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Avx::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInit));
+            result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Avx::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInitV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Avx2::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInitV2));
+#endif
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Avx512f::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInitV2));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Neon::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInitV2));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool SynetInnerProduct32fWeight16ForwardAutoTest(size_t b, size_t i, size_t o, SimdBool t, SimdTensorDataType w, FuncIP32F f)
+    {
+        bool result = true;
+
+        SimdConvolutionActivationType a = SimdConvolutionActivationIdentity;
+        f.Update(b, i, o, t, a, w);
+
+        TEST_LOG_SS(Info, "Test " << f.desc << " & SimdSynetInnerProduct32fInit.");
+
+        Tensor32f src({ b, i });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight({ t ? o : i, t ? i : o });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ o });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f dst32f({ b, o });
+        Tensor32f dst16({ b, o });
+
+        void* context32f = ::SimdSynetInnerProduct32fInit(b, i, o, t, a);
+        void* context16 = f.func(b, i, o, t, a, w);
+
+        ::SimdSynetInnerProduct32fSetParams(context32f, weight.Data(), NULL, bias.Data(), NULL);
+        ::SimdSynetInnerProduct32fSetParams(context16, weight.Data(), NULL, bias.Data(), NULL);
+
+        ::SimdSynetInnerProduct32fForward(context32f, src.Data(), dst32f.Data());
+        f.Call(context16, src, dst16);
+
+        ::SimdRelease(context32f);
+        ::SimdRelease(context16);
+
+        // Relative error of 16-bit weight is less than 2^-mantissa (10 bits for FP16, 7 bits for BF16), 
+        // FP16 subnormals add absolute error 2^-24, FP32 accumulation adds i * 2^-24 relative error.
+        const float unit = w == SimdTensorData16f ? 1.0f / 1024.0f : 1.0f / 128.0f;
+        const float tiny = w == SimdTensorData16f ? 1.0f / float(1 << 24) : 0.0f;
+        const float accum = float(i) / float(1 << 24);
+        for (size_t r = 0; r < b && result; ++r)
+        {
+            const float* ps = src.Data() + r * i;
+            for (size_t n = 0; n < o && result; ++n)
+            {
+                float sumAbs = 0.0f, srcAbs = 0.0f;
+                for (size_t k = 0; k < i; ++k)
+                {
+                    sumAbs += ::fabs(ps[k] * weight.Data()[t ? n * i + k : k * o + n]);
+                    srcAbs += ::fabs(ps[k]);
+                }
+                float d32f = dst32f.Data()[r * o + n], d16 = dst16.Data()[r * o + n];
+                float error = ::fabs(d32f - d16), limit = (unit + 2.0f * accum) * sumAbs + tiny * srcAbs;
+                if (error > limit)
+                {
+                    TEST_LOG_SS(Error, "Error at [" << r << ", " << n << "]: " << d32f << " != " << d16 << ", error " << error << " > " << limit << " !");
+                    result = false;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool SynetInnerProduct32fWeight16ForwardAutoTest(const FuncIP32F& func)
+    {
+        bool result = true;
+
+        SimdBool t = SimdTrue, f = SimdFalse;
+        SimdTensorDataType w16f = SimdTensorData16f, w16b = SimdTensorData16b;
+
+        result = result && SynetInnerProduct32fWeight16ForwardAutoTest(1, 1024, 1000, t, w16f, func);
+        result = result && SynetInnerProduct32fWeight16ForwardAutoTest(1, 1024, 1000, t, w16b, func);
+        result = result && SynetInnerProduct32fWeight16ForwardAutoTest(3, 4096, 257, f, w16f, func);
+        result = result && SynetInnerProduct32fWeight16ForwardAutoTest(3, 4096, 257, f, w16b, func);
+        result = result && SynetInnerProduct32fWeight16ForwardAutoTest(1, 33, 17, t, w16f, func);
+        result = result && SynetInnerProduct32fWeight16ForwardAutoTest(1, 33, 17, f, w16b, func);
+
+        return result;
+    }
+
+    bool SynetInnerProduct32fWeight16ForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetInnerProduct32fWeight16ForwardAutoTest(FUNC_IP32F(Simd::Base::SynetInnerProduct32fInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetInnerProduct32fWeight16ForwardAutoTest(FUNC_IP32F(Simd::Avx2::SynetInnerProduct32fInit));
+#endif
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetInnerProduct32fWeight16ForwardAutoTest(FUNC_IP32F(Simd::Avx512f::SynetInnerProduct32fInit));
+#endif
+
+        result = result && SynetInnerProduct32fWeight16ForwardAutoTest(FUNC_IP32F(SimdSynetInnerProduct32fInitV2));
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        void* SynetInnerProduct32fGemmInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdTensorDataType weightType)
+        {
+            Simd::InnerProductParam32f param(batch, input, output, transpose, activation, weightType);
+            if (!param.Valid())
+                return NULL;
+            return new Simd::Base::SynetInnerProduct32fGemm(param);
+        }
+    }
+
+    bool SynetInnerProduct32fSparseForwardAutoTest(float eps, size_t b, size_t i, size_t o, SimdBool t, size_t block, float density, FuncIP32F f1, FuncIP32F f2)
+    {
+        bool result = true;
+
+        SimdConvolutionActivationType a = SimdConvolutionActivationIdentity;
+        f1.Update(b, i, o, t, a, SimdTensorData32f);
+        f2.Update(b, i, o, t, a, SimdTensorData32f);
+        f1.desc = f1.desc + "-" + ToString(block);
+        f2.desc = f2.desc + "-" + ToString(block);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src({ b, i });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight({ t ? o : i, t ? i : o });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        for (size_t n = 0; n < o; n += block)
+        {
+            for (size_t k = 0; k < i; ++k)
+            {
+                if (Random() <= density)
+                    continue;
+                for (size_t j = n, end = std::min(o, n + block); j < end; ++j)
+                    weight.Data()[t ? j * i + k : k * o + j] = 0.0f;
+            }
+        }
+
+        Tensor32f bias({ o });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f dst1({ b, o });
+        Tensor32f dst2({ b, o });
+
+        void* context1 = f1.func(b, i, o, t, a, SimdTensorData32f);
+        void* context2 = f2.func(b, i, o, t, a, SimdTensorData32f);
+
+        ::SimdSynetInnerProduct32fSetParams(context1, weight.Data(), NULL, bias.Data(), NULL);
+        ::SimdSynetInnerProduct32fSetParams(context2, weight.Data(), NULL, bias.Data(), NULL);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        result = result && Compare(dst1, dst2, eps, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetInnerProduct32fSparseForwardAutoTest(float eps, const FuncIP32F& f1, const FuncIP32F& f2)
+    {
+        bool result = true;
+
+        SimdBool t = SimdTrue, f = SimdFalse;
+
+        result = result && SynetInnerProduct32fSparseForwardAutoTest(eps, 1, 512, 256, t, 16, 0.2f, f1, f2);
+        result = result && SynetInnerProduct32fSparseForwardAutoTest(eps, 3, 384, 200, f, 8, 0.2f, f1, f2);
+        result = result && SynetInnerProduct32fSparseForwardAutoTest(eps, 10, 256, 130, t, 4, 0.2f, f1, f2);
+        result = result && SynetInnerProduct32fSparseForwardAutoTest(eps, 5, 1024, 99, f, 1, 0.08f, f1, f2);
+
+        return result;
+    }
+
+    bool SynetInnerProduct32fSparseForwardAutoTest()
+    {
+        const float EPS = 0.001f;
+        bool result = true;
+
+        result = result && SynetInnerProduct32fSparseForwardAutoTest(EPS, FUNC_IP32F(SynetInnerProduct32fGemmInit), FUNC_IP32F(Simd::Base::SynetInnerProduct32fInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetInnerProduct32fSparseForwardAutoTest(EPS, FUNC_IP32F(SynetInnerProduct32fGemmInit), FUNC_IP32F(Simd::Sse41::SynetInnerProduct32fInit));
 #endif 
 
 #ifdef SIMD_AVX2_ENABLE
         if (Simd::Avx2::Enable)
-            result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Avx2::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInit));
+            result = result && SynetInnerProduct32fSparseForwardAutoTest(EPS, FUNC_IP32F(SynetInnerProduct32fGemmInit), FUNC_IP32F(Simd::Avx2::SynetInnerProduct32fInit));
 #endif
 
 #ifdef SIMD_AVX512F_ENABLE
         if (Simd::Avx512f::Enable)
-            result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Avx512f::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInit));
+            result = result && SynetInnerProduct32fSparseForwardAutoTest(EPS, FUNC_IP32F(SynetInnerProduct32fGemmInit), FUNC_IP32F(Simd::Avx512f::SynetInnerProduct32fInit));
 #endif
 
 #ifdef SIMD_NEON_ENABLE
         if (Simd::Neon::Enable)
-            result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Neon::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInit));
+            result = result && SynetInnerProduct32fSparseForwardAutoTest(EPS, FUNC_IP32F(SynetInnerProduct32fGemmInit), FUNC_IP32F(Simd::Neon::SynetInnerProduct32fInit));
 #endif
 
+        result = result && SynetInnerProduct32fSparseForwardAutoTest(EPS, FUNC_IP32F(SynetInnerProduct32fGemmInit), FUNC_IP32F(SimdSynetInnerProduct32fInitV2));
+
         return result;
     }
 
@@ -421,5 +649,166 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncIP8IF
+        {
+            typedef void*(*FuncPtr)(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+
+            FuncPtr func;
+            String desc;
+
+            FuncIP8IF(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t b, size_t i, size_t o, SimdBool t, SimdTensorDataType s, SimdTensorDataType d, SimdConvolutionActivationType a, SimdSynetCompatibilityType c)
+            {
+                const char* afs[] = { "id", "re", "lr", "rr", "pr", "el", "hs", "mi", "hi" };
+                desc = desc + "[" + ToString(b) + "x" + ToString(i) + "x" + ToString(o) + "-" + ToString((int)t) + "-" + afs[a] + "-"
+                    + (s == SimdTensorData8u ? "u" : "f") + (d == SimdTensorData8u ? "u" : "f") + "-"
+                    + (Simd::Base::Narrowed(c) ? "n" : Simd::Base::Overflow(c) ? "o" : "p") + "]";
+            }
+
+            void Call(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetInnerProduct8iForward(context, src, buf, dst);
+            }
+        };
+    }
+
+#define FUNC_IP8IF(function) FuncIP8IF(function, #function)
+
+    bool SynetInnerProduct8iForwardAutoTest(float eps, size_t b, size_t i, size_t o, SimdBool t, SimdTensorDataType s, SimdTensorDataType d, 
+        SimdConvolutionActivationType a, SimdSynetCompatibilityType c, FuncIP8IF f1, FuncIP8IF f2)
+    {
+        bool result = true;
+
+        f1.Update(b, i, o, t, s, d, a, c);
+        f2.Update(b, i, o, t, s, d, a, c);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc);
+
+        Tensor32f weight(t ? Shp(o, i) : Shp(i, o)), bias(Shp(o)), params(Shp(o));
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), -3.0f, 3.0f);
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f srcMin(Shp(i)), srcMax(Shp(i)), dstMin(Shp(o)), dstMax(Shp(o));
+        Tensor32f src32f(Shp(b, i)), dst32f1(Shp(b, o)), dst32f2(Shp(b, o)), buf32f;
+        Tensor8u src8u(Shp(b, i)), dst8u1(Shp(b, o)), dst8u2(Shp(b, o)), buf8u;
+
+        FillRandom(src32f, srcMin.Data(), srcMax.Data(), i, 0);
+        SetSrc32fTo8u(src32f, srcMin.Data(), srcMax.Data(), i, 0, c, NULL, NULL, src8u);
+
+        Tensor32f weightT(Shp(i, o));
+        for (size_t k = 0; k < i; ++k)
+            for (size_t j = 0; j < o; ++j)
+                weightT.Data()[k * o + j] = t ? weight.Data()[j * i + k] : weight.Data()[k * o + j];
+        SimdConvolutionParameters conv = { i, 1, b, SimdTensorData32f, SimdTensorFormatNhwc, o, 1, b, SimdTensorData32f, 
+            SimdTensorFormatNhwc, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, a };
+        void* context = SimdSynetConvolution32fInit(1, &conv, NULL);
+        buf32f.Extend({ SimdSynetConvolution32fExternalBufferSize(context) });
+        SimdSynetConvolution32fSetParams(context, weightT.Data(), NULL, bias.Data(), params.Data());
+        SimdSynetConvolution32fForward(context, src32f.Data(), buf32f.Data(), dst32f1.Data());
+        SimdRelease(context);
+        SetDstStat(o, 0, c, dst32f1, dstMin.Data(), dstMax.Data(), NULL, NULL);
+
+        const float* stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+        const uint8_t* src = s == SimdTensorData32f ? (uint8_t*)src32f.Data() : src8u.Data();
+        uint8_t* dst1 = d == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : dst8u1.Data();
+        uint8_t* dst2 = d == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : dst8u2.Data();
+
+        Fill(dst32f1, 0.1f);
+        Fill(dst32f2, 1.1f);
+        Fill(dst8u1, uint8_t(1));
+        Fill(dst8u2, uint8_t(2));
+
+        void* context1 = f1.func(b, i, o, t, s, d, a, c);
+        void* context2 = f2.func(b, i, o, t, s, d, a, c);
+
+        buf8u.Extend({ ::SimdSynetInnerProduct8iExternalBufferSize(context1) });
+        buf8u.Extend({ ::SimdSynetInnerProduct8iExternalBufferSize(context2) });
+
+        ::SimdSynetInnerProduct8iSetParams(context1, weight.Data(), bias.Data(), params.Data(), stats);
+        ::SimdSynetInnerProduct8iSetParams(context2, weight.Data(), bias.Data(), params.Data(), stats);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, buf8u.Data(), dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, buf8u.Data(), dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+#if defined(SIMD_X64_ENABLE) || defined(SIMD_X86_ENABLE)
+        int differenceMax = (Simd::Base::FmaAvoid(c) ? 0 : 1);
+#else
+        int differenceMax = 1;
+#endif
+
+        if (d == SimdTensorData32f)
+            result = result && Compare(dst32f1, dst32f2, eps * eps, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst8u1, dst8u2, differenceMax, true, 64);
+
+        return result;
+    }
+
+    bool SynetInnerProduct8iForwardAutoTest(const FuncIP8IF& f1, const FuncIP8IF& f2)
+    {
+        bool result = true;
+
+        const float e = EPS;
+        const SimdBool t0 = SimdFalse, t1 = SimdTrue;
+        const SimdTensorDataType f32 = SimdTensorData32f, u8 = SimdTensorData8u;
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu, aRr = SimdConvolutionActivationRestrictRange;
+        const SimdSynetCompatibilityType c = (SimdSynetCompatibilityType)(SimdSynetCompatibility8iNarrowed | SimdSynetCompatibilityFmaAvoid);
+
+        result = result && SynetInnerProduct8iForwardAutoTest(e, 1, 1024, 1000, t1, f32, f32, aId, c, f1, f2);
+        result = result && SynetInnerProduct8iForwardAutoTest(e, 10, 512, 256, t0, u8, u8, aRe, c, f1, f2);
+        result = result && SynetInnerProduct8iForwardAutoTest(e, 15, 255, 65, t1, u8, f32, aRr, c, f1, f2);
+
+        return result;
+    }
+
+    bool SynetInnerProduct8iForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetInnerProduct8iForwardAutoTest(FUNC_IP8IF(Simd::Base::SynetInnerProduct8iInit), FUNC_IP8IF(SimdSynetInnerProduct8iInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(FUNC_IP8IF(Simd::Sse41::SynetInnerProduct8iInit), FUNC_IP8IF(SimdSynetInnerProduct8iInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(FUNC_IP8IF(Simd::Avx2::SynetInnerProduct8iInit), FUNC_IP8IF(SimdSynetInnerProduct8iInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(FUNC_IP8IF(Simd::Avx512bw::SynetInnerProduct8iInit), FUNC_IP8IF(SimdSynetInnerProduct8iInit));
+#endif
+
+#ifdef SIMD_AVX512VNNI_ENABLE
+        if (Simd::Avx512vnni::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(FUNC_IP8IF(Simd::Avx512vnni::SynetInnerProduct8iInit), FUNC_IP8IF(SimdSynetInnerProduct8iInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(FUNC_IP8IF(Simd::Neon::SynetInnerProduct8iInit), FUNC_IP8IF(SimdSynetInnerProduct8iInit));
+#endif
+
+        return result;
+    }
 #endif
 }
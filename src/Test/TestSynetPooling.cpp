@@ -57,41 +57,40 @@ namespace Test
 
     //---------------------------------------------------------------------
 
-    namespace
+    template<class T> struct FuncPA
     {
-        struct FuncPA
-        {
-            typedef void(*FuncPtr)(const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
-                size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
+        typedef void(*FuncPtr)(const T* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+            size_t strideY, size_t strideX, size_t padY, size_t padX, T* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
 
-            FuncPtr func;
-            String desc;
+        FuncPtr func;
+        String desc;
 
-            FuncPA(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+        FuncPA(const FuncPtr& f, const String& d) : func(f), desc(d) {}
 
-            void Update(const ParamP& p)
-            {
-                std::stringstream ss;
-                ss << desc;
-                ss << "[" << p.srcC << "x" << p.srcH << "x" << p.srcW;
-                ss << "-" << p.kernelY << "x" << p.kernelX;
-                ss << "-" << p.strideX << "-" << Simd::Max(p.padX, p.padY) << "-" << p.excludePad << "-" << p.format;
-                ss << "]";
-                desc = ss.str();
-            }
+        void Update(const ParamP& p)
+        {
+            std::stringstream ss;
+            ss << desc;
+            ss << "[" << p.srcC << "x" << p.srcH << "x" << p.srcW;
+            ss << "-" << p.kernelY << "x" << p.kernelX;
+            ss << "-" << p.strideX << "-" << Simd::Max(p.padX, p.padY) << "-" << p.excludePad << "-" << p.format;
+            ss << "]";
+            desc = ss.str();
+        }
 
-            void Call(const ParamP& p, const Tensor32f& src, Tensor32f& dst) const
-            {
-                TEST_PERFORMANCE_TEST(desc);
-                func(src.Data(), p.srcC, p.srcH, p.srcW, p.kernelY, p.kernelX, p.strideY, p.strideX,
-                    p.padY, p.padX, dst.Data(), p.dstH, p.dstW, p.excludePad, p.format);
-            }
-        };
-    }
+        void Call(const ParamP& p, const Tensor<T>& src, Tensor<T>& dst) const
+        {
+            TEST_PERFORMANCE_TEST(desc);
+            func(src.Data(), p.srcC, p.srcH, p.srcW, p.kernelY, p.kernelX, p.strideY, p.strideX,
+                p.padY, p.padX, dst.Data(), p.dstH, p.dstW, p.excludePad, p.format);
+        }
+    };
+
+    typedef FuncPA<float> FuncPA32f;
 
-#define FUNC_PA(function) FuncPA(function, #function)
+#define FUNC_PA(function) FuncPA32f(function, #function)
 
-    bool SynetPoolingForwardAverageAutoTest(const ParamP& p, FuncPA f1, FuncPA f2)
+    bool SynetPoolingForwardAverageAutoTest(const ParamP& p, FuncPA32f f1, FuncPA32f f2)
     {
         bool result = true;
 
@@ -117,7 +116,7 @@ namespace Test
         return result;
     }
 
-    bool SynetPoolingForwardAverageAutoTest(::SimdTensorFormatType f, ::SimdBool c, ::SimdBool e, const FuncPA& f1, const FuncPA& f2)
+    bool SynetPoolingForwardAverageAutoTest(::SimdTensorFormatType f, ::SimdBool c, ::SimdBool e, const FuncPA32f& f1, const FuncPA32f& f2)
     {
         bool result = true;
 
@@ -130,7 +129,7 @@ namespace Test
         return result;
     }
 
-    bool SynetPoolingForwardAverageAutoTest(const FuncPA& f1, const FuncPA& f2)
+    bool SynetPoolingForwardAverageAutoTest(const FuncPA32f& f1, const FuncPA32f& f2)
     {
         bool result = true;
 
@@ -173,6 +172,123 @@ namespace Test
 
     //---------------------------------------------------------------------
 
+    typedef FuncPA<uint8_t> FuncPA8u;
+
+#define FUNC_PA8U(function) FuncPA8u(function, #function)
+
+    bool SynetPoolingForwardAverage8uAutoTest(const ParamP& p, FuncPA8u f1, FuncPA8u f2)
+    {
+        bool result = true;
+
+        f1.Update(p);
+        f2.Update(p);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << "].");
+
+        Tensor8u src(ToShape(p.srcC, p.srcH, p.srcW, p.format));
+        FillRandom(src.Data(), src.Size(), 0, 255);
+
+        Tensor8u dst1(ToShape(p.srcC, p.dstH, p.dstW, p.format));
+        Tensor8u dst2(ToShape(p.srcC, p.dstH, p.dstW, p.format));
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(p, src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(p, src, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool SynetPoolingForwardAverage8uAutoTest(::SimdTensorFormatType f, ::SimdBool c, ::SimdBool e, const FuncPA8u& f1, const FuncPA8u& f2)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3), _7(7, 7), _56(56, 56);
+
+        result = result && SynetPoolingForwardAverage8uAutoTest(ParamP(10, 238, 132, _2, _2, _0, _0, f, c, e), f1, f2);
+        result = result && SynetPoolingForwardAverage8uAutoTest(ParamP(32, 99, 99, _3, _1, _1, _1, f, c, e), f1, f2);
+        result = result && SynetPoolingForwardAverage8uAutoTest(ParamP(72, 46, 46, _3, _2, _0, _1, f, c, e), f1, f2);
+        result = result && SynetPoolingForwardAverage8uAutoTest(ParamP(1000, 7, 7, _7, _1, _0, _0, f, c, e), f1, f2);
+        result = result && SynetPoolingForwardAverage8uAutoTest(ParamP(97, 56, 56, _56, _1, _0, _0, f, c, e), f1, f2);
+
+        return result;
+    }
+
+    bool SynetPoolingForwardAverage8uBigAreaAutoTest(::SimdTensorFormatType f, FuncPA8u f1, FuncPA8u f2)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _600(600, 600);
+        ParamP p(35, 600, 600, _600, _1, _0, _0, f, ::SimdFalse, ::SimdTrue);
+
+        f1.Update(p);
+        f2.Update(p);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << "].");
+
+        // sum = 249.5 * area - 1: exact average is 249.4999..., but FP32 sum + area/2 is rounded up to 250 * area.
+        size_t size = p.srcH * p.srcW, big = size / 2 - 1;
+        Tensor8u src(ToShape(p.srcC, p.srcH, p.srcW, p.format));
+        for (size_t c = 0; c < p.srcC; ++c)
+            for (size_t i = 0; i < size; ++i)
+                src.Data()[f == ::SimdTensorFormatNhwc ? i * p.srcC + c : c * size + i] = i < big ? 250 : 249;
+
+        Tensor8u dst1(ToShape(p.srcC, p.dstH, p.dstW, p.format));
+        Tensor8u dst2(ToShape(p.srcC, p.dstH, p.dstW, p.format));
+        Tensor8u control(ToShape(p.srcC, p.dstH, p.dstW, p.format), p.format, 249);
+
+        f1.Call(p, src, dst1);
+        f2.Call(p, src, dst2);
+
+        result = result && Compare(dst1, control, 0, true, 64);
+        result = result && Compare(dst2, control, 0, true, 64);
+
+        return result;
+    }
+
+    bool SynetPoolingForwardAverage8uAutoTest(const FuncPA8u& f1, const FuncPA8u& f2)
+    {
+        bool result = true;
+
+        result = result && SynetPoolingForwardAverage8uAutoTest(::SimdTensorFormatNchw, ::SimdTrue, ::SimdTrue, f1, f2);
+        result = result && SynetPoolingForwardAverage8uAutoTest(::SimdTensorFormatNhwc, ::SimdTrue, ::SimdTrue, f1, f2);
+        result = result && SynetPoolingForwardAverage8uAutoTest(::SimdTensorFormatNchw, ::SimdTrue, ::SimdFalse, f1, f2);
+        result = result && SynetPoolingForwardAverage8uAutoTest(::SimdTensorFormatNhwc, ::SimdTrue, ::SimdFalse, f1, f2);
+        result = result && SynetPoolingForwardAverage8uBigAreaAutoTest(::SimdTensorFormatNchw, f1, f2);
+        result = result && SynetPoolingForwardAverage8uBigAreaAutoTest(::SimdTensorFormatNhwc, f1, f2);
+
+        return result;
+    }
+
+    bool SynetPoolingForwardAverage8uAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetPoolingForwardAverage8uAutoTest(FUNC_PA8U(Simd::Base::SynetPoolingForwardAverage8u), FUNC_PA8U(SimdSynetPoolingForwardAverage8u));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetPoolingForwardAverage8uAutoTest(FUNC_PA8U(Simd::Sse41::SynetPoolingForwardAverage8u), FUNC_PA8U(SimdSynetPoolingForwardAverage8u));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetPoolingForwardAverage8uAutoTest(FUNC_PA8U(Simd::Avx2::SynetPoolingForwardAverage8u), FUNC_PA8U(SimdSynetPoolingForwardAverage8u));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetPoolingForwardAverage8uAutoTest(FUNC_PA8U(Simd::Avx512bw::SynetPoolingForwardAverage8u), FUNC_PA8U(SimdSynetPoolingForwardAverage8u));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------
+
     template<class T> struct FuncPM
     {
         typedef void(*FuncPtr)(const T * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
@@ -291,6 +407,69 @@ namespace Test
 
     //---------------------------------------------------------------------
 
+    bool SynetPoolingForwardStridedAutoTest(const ParamP& p, size_t offset, size_t stride, bool max)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdSynetPoolingForward" << (max ? "Max32f" : "Average") << "Strided [" << p.srcC << "x" << p.srcH << "x" << p.srcW
+            << (p.format == SimdTensorFormatNhwc ? "-nhwc" : "-nchw") << "-" << offset << "-" << stride << "].");
+
+        Tensor32f src(ToShape(p.srcC, p.srcH, p.srcW, p.format));
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f dense(ToShape(p.srcC, p.dstH, p.dstW, p.format));
+        Tensor32f strided(ToShape(stride, p.dstH, p.dstW, p.format));
+        FillRandom(strided.Data(), strided.Size(), -1.0, 1.0f);
+        Tensor32f control;
+        control.Clone(strided);
+
+        bool trans = p.format == SimdTensorFormatNhwc;
+        size_t spatial = p.dstH * p.dstW;
+        float* dst = strided.Data() + offset * (trans ? 1 : spatial);
+        if (max)
+        {
+            ::SimdSynetPoolingForwardMax32f(src.Data(), p.srcC, p.srcH, p.srcW, p.kernelY, p.kernelX, p.strideY, p.strideX,
+                p.padY, p.padX, dense.Data(), p.dstH, p.dstW, p.format);
+            TEST_PERFORMANCE_TEST("SimdSynetPoolingForwardMax32fStrided");
+            ::SimdSynetPoolingForwardMax32fStrided(src.Data(), p.srcC, p.srcH, p.srcW, p.kernelY, p.kernelX, p.strideY, p.strideX,
+                p.padY, p.padX, dst, p.dstH, p.dstW, stride, p.format);
+        }
+        else
+        {
+            ::SimdSynetPoolingForwardAverage(src.Data(), p.srcC, p.srcH, p.srcW, p.kernelY, p.kernelX, p.strideY, p.strideX,
+                p.padY, p.padX, dense.Data(), p.dstH, p.dstW, p.excludePad, p.format);
+            TEST_PERFORMANCE_TEST("SimdSynetPoolingForwardAverageStrided");
+            ::SimdSynetPoolingForwardAverageStrided(src.Data(), p.srcC, p.srcH, p.srcW, p.kernelY, p.kernelX, p.strideY, p.strideX,
+                p.padY, p.padX, dst, p.dstH, p.dstW, stride, p.excludePad, p.format);
+        }
+
+        for (size_t s = 0; s < spatial; ++s)
+            for (size_t c = 0; c < p.srcC; ++c)
+                control.Data()[trans ? s * stride + offset + c : (offset + c) * spatial + s] = dense.Data()[trans ? s * p.srcC + c : c * spatial + s];
+
+        result = result && Compare(control, strided, 0.0f, true, 64, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool SynetPoolingForwardStridedAutoTest()
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        ::SimdTensorFormatType nchw = ::SimdTensorFormatNchw, nhwc = ::SimdTensorFormatNhwc;
+
+        result = result && SynetPoolingForwardStridedAutoTest(ParamP(32, 28, 28, _3, _2, _1, _1, nhwc, ::SimdTrue, ::SimdTrue), 16, 80, true);
+        result = result && SynetPoolingForwardStridedAutoTest(ParamP(32, 28, 28, _3, _2, _1, _1, nchw, ::SimdTrue, ::SimdTrue), 16, 80, true);
+        result = result && SynetPoolingForwardStridedAutoTest(ParamP(35, 17, 17, _3, _1, _1, _1, nhwc, ::SimdFalse, ::SimdFalse), 13, 64, false);
+        result = result && SynetPoolingForwardStridedAutoTest(ParamP(35, 17, 17, _3, _1, _1, _1, nchw, ::SimdFalse, ::SimdFalse), 13, 64, false);
+        result = result && SynetPoolingForwardStridedAutoTest(ParamP(16, 8, 8, _2, _2, _0, _0, nhwc, ::SimdFalse, ::SimdTrue), 0, 16, false);
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------
+
     typedef FuncPM<uint8_t> FuncPM8u;
 
 #define FUNC_PM8U(function) FuncPM8u(function, #function)
@@ -373,5 +552,252 @@ namespace Test
 
         return result;
     }
+
+    //---------------------------------------------------------------------
+
+    namespace
+    {
+        struct ParamR
+        {
+            size_t batch, channels, height, width, number, pooledH, pooledW, samplingRatio;
+            float spatialScale;
+            SimdBool aligned;
+            SimdTensorFormatType format;
+
+            ParamR(size_t b, size_t c, size_t h, size_t w, size_t n, size_t ph, size_t pw, size_t sr, float ss, SimdBool a, SimdTensorFormatType f)
+                : batch(b), channels(c), height(h), width(w), number(n), pooledH(ph), pooledW(pw), samplingRatio(sr), spatialScale(ss), aligned(a), format(f)
+            {
+            }
+        };
+
+        struct FuncRA
+        {
+            typedef void(*FuncPtr)(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+                size_t pooledH, size_t pooledW, const float* spatialScale, size_t samplingRatio, SimdBool aligned, float* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncRA(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(const ParamR& p)
+            {
+                std::stringstream ss;
+                ss << desc;
+                ss << "[" << p.batch << "x" << p.channels << "x" << p.height << "x" << p.width;
+                ss << "-" << p.number << "-" << p.pooledH << "x" << p.pooledW << "-" << p.samplingRatio << "-" << p.aligned << "-" << p.format;
+                ss << "]";
+                desc = ss.str();
+            }
+
+            void Call(const ParamR& p, const Tensor32f& src, const Tensor32f& rois, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), p.channels, p.height, p.width, p.format, rois.Data(), p.number, p.pooledH, p.pooledW, &p.spatialScale, p.samplingRatio, p.aligned, dst.Data());
+            }
+        };
+    }
+
+    static void FillRois(const ParamR& p, Tensor32f& rois)
+    {
+        float height = p.height / p.spatialScale, width = p.width / p.spatialScale;
+        for (size_t i = 0; i < p.number; ++i)
+        {
+            float* roi = rois.Data() + i * 5;
+            float x = width * (1.2f * Random() - 0.1f), y = height * (1.2f * Random() - 0.1f);
+            roi[0] = float(i % p.batch);
+            roi[1] = x;
+            roi[2] = y;
+            roi[3] = x + width * 0.7f * Random();
+            roi[4] = y + height * 0.7f * Random();
+        }
+    }
+
+#define FUNC_RA(function) FuncRA(function, #function)
+
+    bool SynetRoiAlign32fAutoTest(const ParamR& p, FuncRA f1, FuncRA f2)
+    {
+        bool result = true;
+
+        f1.Update(p);
+        f2.Update(p);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << "].");
+
+        Tensor32f src(ToShape(p.batch, p.channels, p.height, p.width, p.format));
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f rois({ p.number, 5 });
+        FillRois(p, rois);
+
+        Tensor32f dst1(ToShape(p.number, p.channels, p.pooledH, p.pooledW, p.format));
+        Tensor32f dst2(ToShape(p.number, p.channels, p.pooledH, p.pooledW, p.format));
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(p, src, rois, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(p, src, rois, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetRoiAlign32fAutoTest(::SimdTensorFormatType f, const FuncRA& f1, const FuncRA& f2)
+    {
+        bool result = true;
+
+        result = result && SynetRoiAlign32fAutoTest(ParamR(1, 256, 38, 50, 300, 7, 7, 2, 1.0f / 16, ::SimdFalse, f), f1, f2);
+        result = result && SynetRoiAlign32fAutoTest(ParamR(2, 256, 50, 68, 100, 14, 14, 0, 1.0f / 8, ::SimdTrue, f), f1, f2);
+        result = result && SynetRoiAlign32fAutoTest(ParamR(2, 35, 17, 23, 55, 6, 5, 0, 1.0f / 4, ::SimdFalse, f), f1, f2);
+        result = result && SynetRoiAlign32fAutoTest(ParamR(1, 3, 17, 23, 20, 6, 5, 0, 1.0f / 4, ::SimdTrue, f), f1, f2);
+        result = result && SynetRoiAlign32fAutoTest(ParamR(1, 19, 17, 23, 20, 6, 5, 0, 1.0f / 4, ::SimdTrue, f), f1, f2);
+
+        return result;
+    }
+
+    bool SynetRoiAlign32fAutoTest(const FuncRA& f1, const FuncRA& f2)
+    {
+        bool result = true;
+
+        result = result && SynetRoiAlign32fAutoTest(::SimdTensorFormatNchw, f1, f2);
+        result = result && SynetRoiAlign32fAutoTest(::SimdTensorFormatNhwc, f1, f2);
+
+        return result;
+    }
+
+    bool SynetRoiAlign32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetRoiAlign32fAutoTest(FUNC_RA(Simd::Base::SynetRoiAlign32f), FUNC_RA(SimdSynetRoiAlign32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetRoiAlign32fAutoTest(FUNC_RA(Simd::Sse2::SynetRoiAlign32f), FUNC_RA(SimdSynetRoiAlign32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetRoiAlign32fAutoTest(FUNC_RA(Simd::Avx2::SynetRoiAlign32f), FUNC_RA(SimdSynetRoiAlign32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetRoiAlign32fAutoTest(FUNC_RA(Simd::Avx512f::SynetRoiAlign32f), FUNC_RA(SimdSynetRoiAlign32f));
+#endif 
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncRP
+        {
+            typedef void(*FuncPtr)(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* rois, size_t number,
+                size_t pooledH, size_t pooledW, const float* spatialScale, float* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncRP(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(const ParamR& p)
+            {
+                std::stringstream ss;
+                ss << desc;
+                ss << "[" << p.batch << "x" << p.channels << "x" << p.height << "x" << p.width;
+                ss << "-" << p.number << "-" << p.pooledH << "x" << p.pooledW << "-" << p.format;
+                ss << "]";
+                desc = ss.str();
+            }
+
+            void Call(const ParamR& p, const Tensor32f& src, const Tensor32f& rois, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), p.channels, p.height, p.width, p.format, rois.Data(), p.number, p.pooledH, p.pooledW, &p.spatialScale, dst.Data());
+            }
+        };
+    }
+
+#define FUNC_RP(function) FuncRP(function, #function)
+
+    bool SynetRoiPooling32fAutoTest(const ParamR& p, FuncRP f1, FuncRP f2)
+    {
+        bool result = true;
+
+        f1.Update(p);
+        f2.Update(p);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << "].");
+
+        Tensor32f src(ToShape(p.batch, p.channels, p.height, p.width, p.format));
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f rois({ p.number, 5 });
+        FillRois(p, rois);
+
+        Tensor32f dst1(ToShape(p.number, p.channels, p.pooledH, p.pooledW, p.format));
+        Tensor32f dst2(ToShape(p.number, p.channels, p.pooledH, p.pooledW, p.format));
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(p, src, rois, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(p, src, rois, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool SynetRoiPooling32fAutoTest(::SimdTensorFormatType f, const FuncRP& f1, const FuncRP& f2)
+    {
+        bool result = true;
+
+        result = result && SynetRoiPooling32fAutoTest(ParamR(1, 256, 38, 50, 300, 7, 7, 0, 1.0f / 16, ::SimdFalse, f), f1, f2);
+        result = result && SynetRoiPooling32fAutoTest(ParamR(2, 35, 17, 23, 55, 6, 5, 0, 1.0f / 4, ::SimdFalse, f), f1, f2);
+        result = result && SynetRoiPooling32fAutoTest(ParamR(1, 3, 17, 23, 20, 6, 5, 0, 1.0f / 4, ::SimdFalse, f), f1, f2);
+        result = result && SynetRoiPooling32fAutoTest(ParamR(1, 19, 17, 23, 20, 6, 5, 0, 1.0f / 4, ::SimdFalse, f), f1, f2);
+
+        return result;
+    }
+
+    bool SynetRoiPooling32fAutoTest(const FuncRP& f1, const FuncRP& f2)
+    {
+        bool result = true;
+
+        result = result && SynetRoiPooling32fAutoTest(::SimdTensorFormatNchw, f1, f2);
+        result = result && SynetRoiPooling32fAutoTest(::SimdTensorFormatNhwc, f1, f2);
+
+        return result;
+    }
+
+    bool SynetRoiPooling32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetRoiPooling32fAutoTest(FUNC_RP(Simd::Base::SynetRoiPooling32f), FUNC_RP(SimdSynetRoiPooling32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetRoiPooling32fAutoTest(FUNC_RP(Simd::Sse2::SynetRoiPooling32f), FUNC_RP(SimdSynetRoiPooling32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetRoiPooling32fAutoTest(FUNC_RP(Simd::Avx2::SynetRoiPooling32f), FUNC_RP(SimdSynetRoiPooling32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetRoiPooling32fAutoTest(FUNC_RP(Simd::Avx512f::SynetRoiPooling32f), FUNC_RP(SimdSynetRoiPooling32f));
+#endif 
+
+        return result;
+    }
 #endif
 }
@@ -334,6 +334,7 @@ namespace Test
 
     typedef Tensor<float> Tensor32f;
     typedef Tensor<uint8_t> Tensor8u;
+    typedef Tensor<uint32_t> Tensor32u;
 
     //-------------------------------------------------------------------------
 
@@ -380,7 +381,7 @@ namespace Test
     }
 
     inline void Compare(const Tensor32f & a, const Tensor32f & b, float differenceMax, bool printError, int errorCountMax, DifferenceType differenceType, const String & description,
-        Shape index, size_t order, int & errorCount, std::stringstream & message)
+        Shape & index, size_t order, int & errorCount, std::stringstream & message)
     {
         if (order == a.Count())
         {
@@ -436,7 +437,7 @@ namespace Test
     }
 
     template<class T> inline void Compare(const Tensor<T>& a, const Tensor<T>& b, int differenceMax, bool printError, int errorCountMax, const String& description,
-        Shape index, size_t order, int& errorCount, std::stringstream& message)
+        Shape& index, size_t order, int& errorCount, std::stringstream& message)
     {
         if (order == a.Count())
         {
@@ -309,6 +309,22 @@ namespace Test
         return result;
     }
 
+    bool WinogradKernel3x3Block6x6SetFilterAutoTest()
+    {
+        bool result = true;
+
+        Size _3x3(3, 3), _6x6(6, 6);
+
+        result = result && WinogradSetFilterAutoTest(_6x6, _3x3, FUNC_WF(Simd::Base::WinogradKernel3x3Block6x6SetFilter), FUNC_WF(SimdWinogradKernel3x3Block6x6SetFilter));
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && WinogradSetFilterAutoTest(_6x6, _3x3, FUNC_WF(Simd::Avx512f::WinogradKernel3x3Block6x6SetFilter), FUNC_WF(SimdWinogradKernel3x3Block6x6SetFilter));
+#endif
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     namespace
@@ -676,6 +692,20 @@ namespace Test
         return result;
     }
 
+    bool WinogradKernel3x3Block6x6SetInputAutoTest()
+    {
+        bool result = true;
+
+        result = result && WinogradKernel3x3SetInputAutoTest(6, FUNC_WI(Simd::Base::WinogradKernel3x3Block6x6SetInput), FUNC_WI(SimdWinogradKernel3x3Block6x6SetInput));
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && WinogradKernel3x3SetInputAutoTest(6, FUNC_WI(Simd::Avx512f::WinogradKernel3x3Block6x6SetInput), FUNC_WI(SimdWinogradKernel3x3Block6x6SetInput));
+#endif 
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     namespace
@@ -1024,6 +1054,20 @@ namespace Test
         return result;
     }
 
+    bool WinogradKernel3x3Block6x6SetOutputAutoTest()
+    {
+        bool result = true;
+
+        result = result && WinogradKernel3x3SetOutputAutoTest(6, FUNC_WO(Simd::Base::WinogradKernel3x3Block6x6SetOutput), FUNC_WO(SimdWinogradKernel3x3Block6x6SetOutput));
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && WinogradKernel3x3SetOutputAutoTest(6, FUNC_WO(Simd::Avx512f::WinogradKernel3x3Block6x6SetOutput), FUNC_WO(SimdWinogradKernel3x3Block6x6SetOutput));
+#endif
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     void ImgToCol(const float * src, size_t srcC, size_t srcH, size_t srcW, const Size& core, const Size& padB, const Size& padE, float * dst)
@@ -1315,5 +1359,10 @@ namespace Test
     {
         return WinogradKernel3x3SpecialTest(4, FUNC_WF(SimdWinogradKernel3x3Block4x4SetFilter), FUNC_WI(SimdWinogradKernel3x3Block4x4SetInput), FUNC_WO(SimdWinogradKernel3x3Block4x4SetOutput));
     }
+
+    bool WinogradKernel3x3Block6x6SpecialTest()
+    {
+        return WinogradKernel3x3SpecialTest(6, FUNC_WF(SimdWinogradKernel3x3Block6x6SetFilter), FUNC_WI(SimdWinogradKernel3x3Block6x6SetInput), FUNC_WO(SimdWinogradKernel3x3Block6x6SetOutput));
+    }
 #endif
 }